@@ -0,0 +1,20 @@
+#ifndef GUARD_CYCLE_TIMER_H
+#define GUARD_CYCLE_TIMER_H
+
+// Times short stretches of code on timer 2, which nothing else uses.
+// Sound has timer 0, the boot-time random seed timer 1 and link timer 3.
+// At TIMER_1CLK one tick is one CPU cycle and the count wraps after 65535,
+// a little under a frame (280896 cycles); TIMER_64CLK covers whole frames.
+
+#define CYCLE_TIMER_START(prescaler)           \
+{                                              \
+    REG_TM2CNT_H = 0;                          \
+    REG_TM2CNT_L = 0;                          \
+    REG_TM2CNT_H = TIMER_ENABLE | (prescaler); \
+}
+
+#define CYCLE_TIMER_READ() (REG_TM2CNT_L)
+
+#define CYCLE_TIMER_STOP() (REG_TM2CNT_H = 0)
+
+#endif // GUARD_CYCLE_TIMER_H
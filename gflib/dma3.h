@@ -46,6 +46,20 @@
 #define Dma3FillLarge16_(value, dest, size) Dma3FillLarge_(value, dest, size, 16)
 #define Dma3FillLarge32_(value, dest, size) Dma3FillLarge_(value, dest, size, 32)
 
+#ifdef DMA3_PRIORITY_QUEUE
+struct Dma3Stats
+{
+    u16 queueDepth;
+    u16 peakQueueDepth;
+    u32 numMerged;       // requests added onto the end of a queued one
+    u32 numDeduplicated; // repeats of a queued request
+    u32 numSpills;       // frames that left requests for the next frame
+    u32 numFailed;       // requests refused because the queue was full
+};
+
+extern struct Dma3Stats gDma3Stats;
+#endif
+
 void ClearDma3Requests(void);
 void ProcessDma3Requests(void);
 s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode);
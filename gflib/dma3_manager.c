@@ -8,6 +8,31 @@
 #define DMA_REQUEST_COPY16 3
 #define DMA_REQUEST_FILL16 4
 
+#ifdef DMA3_PRIORITY_QUEUE
+// Requests wait in one queue per class and the classes are served in this
+// order. The classes write to separate parts of video memory, so serving
+// them out of order is safe. Anything written elsewhere could be read back
+// by a later request, so it switches to sDma3KeepOrder.
+enum
+{
+    DMA3_CLASS_PALETTE,   // palettes and OAM
+    DMA3_CLASS_OBJ_TILES, // sprite tiles
+    DMA3_CLASS_BG,        // BG tiles, tilemaps and anything else
+    NUM_DMA3_CLASSES
+};
+
+#define DMA3_QUEUE_END 0xFF
+
+// Requests are started while VCOUNT is at most this, as before.
+#define DMA3_LAST_LINE 224
+#define CYCLES_PER_SCANLINE 1232
+#define MAX_DMA3_BYTES_PER_FRAME (40 * 1024)
+#define DMA3_VBLANK_CYCLES ((DMA3_LAST_LINE + 1 - DISPLAY_HEIGHT) * CYCLES_PER_SCANLINE)
+
+// Rough cost of setting up each MAX_DMA_BLOCK_SIZE block, in cycles.
+#define DMA3_SETUP_CYCLES 32
+#endif
+
 struct Dma3Request
 {
     const u8 *src;
@@ -15,6 +40,10 @@ struct Dma3Request
     u16 size;
     u16 mode;
     u32 value;
+#ifdef DMA3_PRIORITY_QUEUE
+    u16 order; // when it was queued, for sDma3KeepOrder
+    u8 next;
+#endif
 };
 
 static struct Dma3Request sDma3Requests[MAX_DMA_REQUESTS];
@@ -22,6 +51,24 @@ static struct Dma3Request sDma3Requests[MAX_DMA_REQUESTS];
 static vbool8 sDma3ManagerLocked;
 static u8 sDma3RequestCursor;
 
+#ifdef DMA3_PRIORITY_QUEUE
+static u8 sDma3QueueHeads[NUM_DMA3_CLASSES];
+static u8 sDma3QueueTails[NUM_DMA3_CLASSES];
+static u16 sDma3NextOrder;
+
+// Set when a request could overlap another class's, by reading from video
+// memory, writing outside it or writing across two classes. Until the queue
+// next empties, requests are then run strictly in the order they came in
+// and aren't merged.
+static bool8 sDma3KeepOrder;
+
+// Set when a frame left requests waiting, so the oldest goes first next
+// frame rather than behind everything of a higher class.
+static bool8 sDma3Spilled;
+
+EWRAM_DATA struct Dma3Stats gDma3Stats = {0};
+#endif
+
 void ClearDma3Requests(void)
 {
     int i;
@@ -36,8 +83,445 @@ void ClearDma3Requests(void)
         sDma3Requests[i].dest = NULL;
     }
 
+#ifdef DMA3_PRIORITY_QUEUE
+    for (i = 0; i < NUM_DMA3_CLASSES; i++)
+    {
+        sDma3QueueHeads[i] = DMA3_QUEUE_END;
+        sDma3QueueTails[i] = DMA3_QUEUE_END;
+    }
+    sDma3KeepOrder = FALSE;
+    sDma3Spilled = FALSE;
+    gDma3Stats.queueDepth = 0;
+#endif
+
+    sDma3ManagerLocked = FALSE;
+}
+
+#ifdef DMA3_PRIORITY_QUEUE
+static u32 GetDma3Class(const u8 *addr)
+{
+    if ((u32)addr >= OAM || ((u32)addr >= PLTT && (u32)addr < VRAM))
+        return DMA3_CLASS_PALETTE;
+    if ((u32)addr >= OBJ_VRAM0 && (u32)addr < OBJ_VRAM0 + OBJ_VRAM0_SIZE)
+        return DMA3_CLASS_OBJ_TILES;
+    return DMA3_CLASS_BG;
+}
+
+static bool32 IsInVideoMemory(const u8 *addr)
+{
+    return (u32)addr >= PLTT && (u32)addr < OAM + OAM_SIZE;
+}
+
+// Cycles for one 16- or 32-bit access to addr in a DMA, with the waitstates
+// set up in InitMainCallbacks.
+static u32 GetAccessCycles(const u8 *addr, bool32 is32Bit)
+{
+    switch ((u32)addr >> 24)
+    {
+    case 0x2: // EWRAM, 16-bit bus with 2 waitstates
+        return is32Bit ? 6 : 3;
+    case 0x3: // IWRAM
+    case 0x4: // I/O
+    case 0x7: // OAM
+        return 1;
+    case 0x5: // palette, 16-bit bus
+    case 0x6: // VRAM, 16-bit bus
+        return is32Bit ? 2 : 1;
+    default:  // ROM, 16-bit bus with 1 sequential waitstate
+        return is32Bit ? 4 : 2;
+    }
+}
+
+// Estimates how long a request will take. Copying 40 KiB from EWRAM to
+// VRAM, the old per-frame cap, comes to about one VBlank.
+static u32 GetDma3RequestCycles(struct Dma3Request *request)
+{
+    u32 numBlocks = (request->size + MAX_DMA_BLOCK_SIZE - 1) / MAX_DMA_BLOCK_SIZE;
+    u32 perUnit;
+
+    switch (request->mode)
+    {
+    case DMA_REQUEST_COPY32:
+        perUnit = GetAccessCycles(request->src, TRUE) + GetAccessCycles(request->dest, TRUE);
+        return numBlocks * DMA3_SETUP_CYCLES + (request->size / 4) * perUnit;
+    case DMA_REQUEST_FILL32:
+        perUnit = 1 + GetAccessCycles(request->dest, TRUE);
+        return numBlocks * DMA3_SETUP_CYCLES + (request->size / 4) * perUnit;
+    case DMA_REQUEST_COPY16:
+        perUnit = GetAccessCycles(request->src, FALSE) + GetAccessCycles(request->dest, FALSE);
+        return numBlocks * DMA3_SETUP_CYCLES + (request->size / 2) * perUnit;
+    case DMA_REQUEST_FILL16:
+    default:
+        perUnit = 1 + GetAccessCycles(request->dest, FALSE);
+        return numBlocks * DMA3_SETUP_CYCLES + (request->size / 2) * perUnit;
+    }
+}
+
+static u32 GetDma3CyclesLeft(void)
+{
+    u32 vcount = REG_VCOUNT;
+
+    if (vcount > DMA3_LAST_LINE)
+        return 0;
+
+    return (DMA3_LAST_LINE + 1 - vcount) * CYCLES_PER_SCANLINE;
+}
+
+// The first request of a frame only has to start before VBlank ends, as all
+// of them did before the cycle estimates, so that one the estimate puts over
+// a whole VBlank still runs.
+static bool32 CanRunDma3Request(struct Dma3Request *request, u32 bytesTransferred)
+{
+    u32 cyclesLeft = GetDma3CyclesLeft();
+
+    if (cyclesLeft == 0 || bytesTransferred + request->size > MAX_DMA3_BYTES_PER_FRAME)
+        return FALSE;
+
+    return bytesTransferred == 0 || GetDma3RequestCycles(request) <= cyclesLeft;
+}
+
+static bool32 Dma3RequestsOverlap(struct Dma3Request *a, struct Dma3Request *b)
+{
+    return a->dest < b->dest + b->size && b->dest < a->dest + a->size;
+}
+
+static void RunDma3Request(struct Dma3Request *request)
+{
+    switch (request->mode)
+    {
+    case DMA_REQUEST_COPY32:
+        Dma3CopyLarge32_(request->src, request->dest, request->size);
+        break;
+    case DMA_REQUEST_FILL32:
+        Dma3FillLarge32_(request->value, request->dest, request->size);
+        break;
+    case DMA_REQUEST_COPY16:
+        Dma3CopyLarge16_(request->src, request->dest, request->size);
+        break;
+    case DMA_REQUEST_FILL16:
+        Dma3FillLarge16_(request->value, request->dest, request->size);
+        break;
+    }
+}
+
+// Takes a request off its queue, after prevIndex, and frees it.
+static void RemoveDma3Request(u32 dma3Class, u8 prevIndex, u8 index)
+{
+    struct Dma3Request *request = &sDma3Requests[index];
+
+    if (prevIndex == DMA3_QUEUE_END)
+        sDma3QueueHeads[dma3Class] = request->next;
+    else
+        sDma3Requests[prevIndex].next = request->next;
+
+    if (sDma3QueueTails[dma3Class] == index)
+        sDma3QueueTails[dma3Class] = prevIndex;
+
+    request->src = NULL;
+    request->dest = NULL;
+    request->size = 0;
+    request->mode = 0;
+    request->value = 0;
+    gDma3Stats.queueDepth--;
+}
+
+// Returns the class whose head was queued first, or NUM_DMA3_CLASSES if
+// every queue is empty. Each queue is in order, so that's the oldest request.
+static u32 GetOldestDma3Class(void)
+{
+    u32 dma3Class, oldestClass;
+    u8 index;
+
+    oldestClass = NUM_DMA3_CLASSES;
+    for (dma3Class = 0; dma3Class < NUM_DMA3_CLASSES; dma3Class++)
+    {
+        index = sDma3QueueHeads[dma3Class];
+        if (index != DMA3_QUEUE_END
+         && (oldestClass == NUM_DMA3_CLASSES
+          || (s16)(sDma3Requests[index].order - sDma3Requests[sDma3QueueHeads[oldestClass]].order) < 0))
+            oldestClass = dma3Class;
+    }
+
+    return oldestClass;
+}
+
+// Runs requests in the order they were queued, stopping at the first that
+// doesn't fit.
+static void ProcessDma3RequestsInOrder(void)
+{
+    u32 bytesTransferred = 0;
+    u32 firstClass;
+    u8 index;
+
+    while (1)
+    {
+        firstClass = GetOldestDma3Class();
+        if (firstClass == NUM_DMA3_CLASSES)
+        {
+            sDma3KeepOrder = FALSE;
+            sDma3Spilled = FALSE;
+            return;
+        }
+
+        index = sDma3QueueHeads[firstClass];
+        if (!CanRunDma3Request(&sDma3Requests[index], bytesTransferred))
+        {
+            sDma3Spilled = TRUE;
+            gDma3Stats.numSpills++;
+            return;
+        }
+
+        bytesTransferred += sDma3Requests[index].size;
+        RunDma3Request(&sDma3Requests[index]);
+        RemoveDma3Request(firstClass, DMA3_QUEUE_END, index);
+    }
+}
+
+// Serves the classes in priority order, running every request that fits in
+// what's left of VBlank. A request that doesn't fit waits for the next
+// frame, and so does anything after it in its class that overlaps it.
+void ProcessDma3Requests(void)
+{
+    u32 bytesTransferred = 0;
+    u32 dma3Class;
+    u8 index, prevIndex, nextIndex, blocker;
+    bool8 spilled = FALSE;
+
+    if (sDma3ManagerLocked)
+        return;
+
+    if (sDma3KeepOrder)
+    {
+        ProcessDma3RequestsInOrder();
+        return;
+    }
+
+    // The head of its queue never waits on anything, and going first it
+    // always runs, so a steady stream of higher classes can't hold a
+    // leftover request back for good.
+    if (sDma3Spilled)
+    {
+        dma3Class = GetOldestDma3Class();
+        if (dma3Class != NUM_DMA3_CLASSES)
+        {
+            index = sDma3QueueHeads[dma3Class];
+            if (CanRunDma3Request(&sDma3Requests[index], bytesTransferred))
+            {
+                bytesTransferred += sDma3Requests[index].size;
+                RunDma3Request(&sDma3Requests[index]);
+                RemoveDma3Request(dma3Class, DMA3_QUEUE_END, index);
+            }
+        }
+    }
+
+    for (dma3Class = 0; dma3Class < NUM_DMA3_CLASSES; dma3Class++)
+    {
+        prevIndex = DMA3_QUEUE_END;
+        index = sDma3QueueHeads[dma3Class];
+        while (index != DMA3_QUEUE_END)
+        {
+            nextIndex = sDma3Requests[index].next;
+
+            if (GetDma3CyclesLeft() == 0)
+            {
+                spilled = TRUE;
+                break;
+            }
+
+            // Everything before this request in its queue is waiting.
+            for (blocker = sDma3QueueHeads[dma3Class]; blocker != index; blocker = sDma3Requests[blocker].next)
+            {
+                if (Dma3RequestsOverlap(&sDma3Requests[blocker], &sDma3Requests[index]))
+                    break;
+            }
+
+            if (blocker == index && CanRunDma3Request(&sDma3Requests[index], bytesTransferred))
+            {
+                bytesTransferred += sDma3Requests[index].size;
+                RunDma3Request(&sDma3Requests[index]);
+                RemoveDma3Request(dma3Class, prevIndex, index);
+            }
+            else
+            {
+                spilled = TRUE;
+                prevIndex = index;
+            }
+            index = nextIndex;
+        }
+    }
+
+    sDma3Spilled = spilled;
+    if (spilled)
+        gDma3Stats.numSpills++;
+}
+
+// Returns the index of a queued request that already does what's asked,
+// or can be stretched to, or -1. A request is only stretched as far as one
+// frame's worth, so the result can still run.
+static s16 MergeDma3Request(u32 dma3Class, struct Dma3Request *newRequest)
+{
+    struct Dma3Request *request;
+    struct Dma3Request merged;
+    u8 index, match;
+    u8 *start, *end;
+    u32 alignMask;
+
+    // A repeat of a queued request can share it, as long as nothing queued
+    // since writes over the same memory.
+    match = DMA3_QUEUE_END;
+    for (index = sDma3QueueHeads[dma3Class]; index != DMA3_QUEUE_END; index = sDma3Requests[index].next)
+    {
+        request = &sDma3Requests[index];
+        if (request->dest == newRequest->dest
+         && request->size == newRequest->size
+         && request->mode == newRequest->mode
+         && request->src == newRequest->src
+         && request->value == newRequest->value)
+            match = index;
+        else if (match != DMA3_QUEUE_END && Dma3RequestsOverlap(request, newRequest))
+            match = DMA3_QUEUE_END;
+    }
+
+    if (match != DMA3_QUEUE_END)
+    {
+        gDma3Stats.numDeduplicated++;
+        return match;
+    }
+
+    // A request next to or overlapping the last one queued, from the same
+    // place in the source, or filling with the same value, can extend it.
+    index = sDma3QueueTails[dma3Class];
+    if (index == DMA3_QUEUE_END)
+        return -1;
+
+    request = &sDma3Requests[index];
+    if (request->mode != newRequest->mode
+     || request->dest > newRequest->dest + newRequest->size
+     || newRequest->dest > request->dest + request->size)
+        return -1;
+
+    // Only whole units are transferred, so both must be made of whole units
+    // lined up with each other.
+    alignMask = (newRequest->mode == DMA_REQUEST_COPY32 || newRequest->mode == DMA_REQUEST_FILL32) ? 3 : 1;
+    if ((((u32)newRequest->dest - (u32)request->dest) | newRequest->size | request->size) & alignMask)
+        return -1;
+
+    if (newRequest->mode == DMA_REQUEST_COPY32 || newRequest->mode == DMA_REQUEST_COPY16)
+    {
+        if (newRequest->src - request->src != newRequest->dest - request->dest)
+            return -1;
+    }
+    else if (newRequest->value != request->value)
+    {
+        return -1;
+    }
+
+    start = min(request->dest, newRequest->dest);
+    end = max(request->dest + request->size, newRequest->dest + newRequest->size);
+    if (end - start > MAX_DMA3_BYTES_PER_FRAME)
+        return -1;
+
+    merged = *request;
+    if (newRequest->dest < request->dest)
+    {
+        merged.src = newRequest->src;
+        merged.dest = newRequest->dest;
+    }
+    merged.size = end - start;
+    if (GetDma3RequestCycles(&merged) > DMA3_VBLANK_CYCLES)
+        return -1;
+
+    *request = merged;
+    gDma3Stats.numMerged++;
+    return index;
+}
+
+static s16 QueueDma3Request(const u8 *src, u8 *dest, u16 size, u16 mode, u32 value)
+{
+    struct Dma3Request newRequest;
+    u32 dma3Class;
+    s16 index;
+    int i;
+
+    newRequest.src = src;
+    newRequest.dest = dest;
+    newRequest.size = size;
+    newRequest.mode = mode;
+    newRequest.value = value;
+
+    dma3Class = GetDma3Class(dest);
+    if (size != 0
+     && (!IsInVideoMemory(dest)
+      || GetDma3Class(dest + size - 1) != dma3Class
+      || ((mode == DMA_REQUEST_COPY32 || mode == DMA_REQUEST_COPY16) && IsInVideoMemory(src))))
+        sDma3KeepOrder = TRUE;
+
+    if (size != 0 && !sDma3KeepOrder)
+    {
+        index = MergeDma3Request(dma3Class, &newRequest);
+        if (index != -1)
+            return index;
+    }
+
+    index = sDma3RequestCursor;
+    for (i = 0; i < MAX_DMA_REQUESTS; i++)
+    {
+        if (sDma3Requests[index].size == 0) // an empty request was found.
+            break;
+        if (++index >= MAX_DMA_REQUESTS) // loop back to start.
+            index = 0;
+    }
+
+    if (i == MAX_DMA_REQUESTS)
+    {
+        gDma3Stats.numFailed++;
+        return -1;  // no free DMA request was found
+    }
+
+    if (size == 0)
+        return index;
+
+    // Start looking after this one next time, so a caller waiting on it with
+    // CheckForSpaceForDma3Request isn't handed the same index straight away.
+    sDma3RequestCursor = (index + 1) % MAX_DMA_REQUESTS;
+
+    newRequest.order = sDma3NextOrder++;
+    newRequest.next = DMA3_QUEUE_END;
+    sDma3Requests[index] = newRequest;
+
+    if (sDma3QueueTails[dma3Class] == DMA3_QUEUE_END)
+        sDma3QueueHeads[dma3Class] = index;
+    else
+        sDma3Requests[sDma3QueueTails[dma3Class]].next = index;
+    sDma3QueueTails[dma3Class] = index;
+
+    gDma3Stats.queueDepth++;
+    if (gDma3Stats.queueDepth > gDma3Stats.peakQueueDepth)
+        gDma3Stats.peakQueueDepth = gDma3Stats.queueDepth;
+
+    return index;
+}
+
+s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
+{
+    s16 index;
+
+    sDma3ManagerLocked = TRUE;
+    index = QueueDma3Request(src, dest, size, (mode == 1) ? DMA_REQUEST_COPY32 : DMA_REQUEST_COPY16, 0);
+    sDma3ManagerLocked = FALSE;
+    return index;
+}
+
+s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
+{
+    s16 index;
+
+    sDma3ManagerLocked = TRUE;
+    index = QueueDma3Request(NULL, dest, size, (mode == 1) ? DMA_REQUEST_FILL32 : DMA_REQUEST_FILL16, value);
     sDma3ManagerLocked = FALSE;
+    return index;
 }
+#else
 
 void ProcessDma3Requests(void)
 {
@@ -159,6 +643,7 @@ s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
     sDma3ManagerLocked = FALSE;
     return -1;  // no free DMA request was found
 }
+#endif // DMA3_PRIORITY_QUEUE
 
 s16 CheckForSpaceForDma3Request(s16 index)
 {
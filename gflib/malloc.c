@@ -1,8 +1,9 @@
 #include "global.h"
+#include "malloc.h"
 
 static void *sHeapStart;
 static u32 sHeapSize;
-static u32 sFiller; // needed to align dma3_manager.o(.bss)
+static UNUSED u32 sFiller; // needed to align dma3_manager.o(.bss)
 
 #define MALLOC_SYSTEM_ID 0xA3A3
 
@@ -42,6 +43,7 @@ void PutFirstMemBlockHeader(void *block, u32 size)
     PutMemBlockHeader(block, (struct MemBlock *)block, (struct MemBlock *)block, size - sizeof(struct MemBlock));
 }
 
+#ifndef SIZE_CLASS_HEAP
 void *AllocInternal(void *heapStart, u32 size)
 {
     struct MemBlock *pos = (struct MemBlock *)heapStart;
@@ -129,6 +131,322 @@ void FreeInternal(void *heapStart, void *pointer)
     }
 }
 
+#else
+// Free blocks are kept in bins by size so that allocating doesn't walk the
+// whole heap. Blocks smaller than LARGE_BLOCK_SIZE are in one list per size,
+// with a bitmap of the lists that aren't empty. Larger ones are in a binary
+// tree, from which the smallest one that fits is used. The links are kept
+// in the free blocks' data, and only sHeapStart's heap is binned.
+
+#define SMALL_BIN_COUNT 64
+#define LARGE_BLOCK_SIZE (SMALL_BIN_COUNT * 4)
+
+// The data of a free block must be big enough for next and prev.
+#define MIN_BLOCK_SIZE (2 * sizeof(struct FreeBlock *))
+
+struct FreeBlock {
+    // Next and previous free blocks in the same small bin.
+    struct FreeBlock *next;
+    struct FreeBlock *prev;
+
+    // Links in the tree of large blocks.
+    struct FreeBlock *left;
+    struct FreeBlock *right;
+    struct FreeBlock *parent;
+};
+
+static struct FreeBlock *sSmallBins[SMALL_BIN_COUNT];
+static u32 sSmallBinMask[SMALL_BIN_COUNT / 32];
+static struct FreeBlock *sLargeBlockTree;
+
+EWRAM_DATA struct HeapStats gHeapStats = {0};
+
+static const u8 sDeBruijnBitPositions[32] = {
+     0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+    31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9,
+};
+
+static u32 LowestSetBit(u32 mask)
+{
+    return sDeBruijnBitPositions[((mask & -mask) * 0x077CB531) >> 27];
+}
+
+static struct FreeBlock *GetFreeBlock(struct MemBlock *block)
+{
+    return (struct FreeBlock *)block->data;
+}
+
+static struct MemBlock *GetMemBlock(struct FreeBlock *freeBlock)
+{
+    return (struct MemBlock *)((u8 *)freeBlock - sizeof(struct MemBlock));
+}
+
+static void ReplaceTreeChild(struct FreeBlock *parent, struct FreeBlock *child, struct FreeBlock *replacement)
+{
+    if (parent == NULL)
+        sLargeBlockTree = replacement;
+    else if (parent->left == child)
+        parent->left = replacement;
+    else
+        parent->right = replacement;
+}
+
+// Orders the tree by size, then by address, so the best fit is also the
+// lowest of the blocks that fit best.
+static bool32 IsTreeBlockBefore(struct FreeBlock *a, struct FreeBlock *b)
+{
+    u32 sizeA = GetMemBlock(a)->size;
+    u32 sizeB = GetMemBlock(b)->size;
+
+    return sizeA < sizeB || (sizeA == sizeB && a < b);
+}
+
+static void InsertTreeBlock(struct FreeBlock *freeBlock)
+{
+    struct FreeBlock *parent = NULL;
+    struct FreeBlock **link = &sLargeBlockTree;
+
+    while (*link != NULL) {
+        parent = *link;
+        link = IsTreeBlockBefore(freeBlock, parent) ? &parent->left : &parent->right;
+    }
+
+    freeBlock->left = NULL;
+    freeBlock->right = NULL;
+    freeBlock->parent = parent;
+    *link = freeBlock;
+}
+
+static void RemoveTreeBlock(struct FreeBlock *freeBlock)
+{
+    struct FreeBlock *replacement;
+
+    if (freeBlock->left != NULL && freeBlock->right != NULL) {
+        // The next node, which has no left child, takes this one's place.
+        replacement = freeBlock->right;
+        while (replacement->left != NULL)
+            replacement = replacement->left;
+
+        if (replacement->parent != freeBlock) {
+            ReplaceTreeChild(replacement->parent, replacement, replacement->right);
+            if (replacement->right != NULL)
+                replacement->right->parent = replacement->parent;
+            replacement->right = freeBlock->right;
+            replacement->right->parent = replacement;
+        }
+
+        replacement->left = freeBlock->left;
+        replacement->left->parent = replacement;
+    } else {
+        replacement = (freeBlock->left != NULL) ? freeBlock->left : freeBlock->right;
+    }
+
+    if (replacement != NULL)
+        replacement->parent = freeBlock->parent;
+    ReplaceTreeChild(freeBlock->parent, freeBlock, replacement);
+}
+
+// Returns the lowest of the smallest free blocks in the tree with at least
+// size bytes.
+static struct FreeBlock *FindTreeBlock(u32 size)
+{
+    struct FreeBlock *node = sLargeBlockTree;
+    struct FreeBlock *best = NULL;
+
+    while (node != NULL) {
+        if (GetMemBlock(node)->size < size) {
+            node = node->right;
+        } else {
+            best = node;
+            node = node->left;
+        }
+    }
+
+    return best;
+}
+
+static void AddFreeBlock(struct MemBlock *block)
+{
+    struct FreeBlock *freeBlock = GetFreeBlock(block);
+    u32 bin;
+
+    if (block->size >= LARGE_BLOCK_SIZE) {
+        InsertTreeBlock(freeBlock);
+        return;
+    }
+
+    bin = block->size / 4;
+    freeBlock->prev = NULL;
+    freeBlock->next = sSmallBins[bin];
+    if (freeBlock->next != NULL)
+        freeBlock->next->prev = freeBlock;
+    sSmallBins[bin] = freeBlock;
+    sSmallBinMask[bin / 32] |= 1u << (bin % 32);
+}
+
+static void RemoveFreeBlock(struct MemBlock *block)
+{
+    struct FreeBlock *freeBlock = GetFreeBlock(block);
+    u32 bin;
+
+    if (block->size >= LARGE_BLOCK_SIZE) {
+        RemoveTreeBlock(freeBlock);
+        return;
+    }
+
+    bin = block->size / 4;
+
+    if (freeBlock->prev != NULL) {
+        freeBlock->prev->next = freeBlock->next;
+    } else {
+        sSmallBins[bin] = freeBlock->next;
+        if (freeBlock->next == NULL)
+            sSmallBinMask[bin / 32] &= ~(1u << (bin % 32));
+    }
+
+    if (freeBlock->next != NULL)
+        freeBlock->next->prev = freeBlock->prev;
+}
+
+// Returns a free block with at least size bytes: one of exactly that size
+// if there is one, otherwise one from the next non-empty small bin or the
+// best fit from the tree.
+static struct FreeBlock *FindFreeBlock(u32 size)
+{
+    u32 bin, i, mask;
+
+    if (size < LARGE_BLOCK_SIZE) {
+        bin = size / 4;
+
+        if (sSmallBins[bin] != NULL)
+            return sSmallBins[bin];
+
+        for (i = bin / 32; i < SMALL_BIN_COUNT / 32; i++) {
+            mask = sSmallBinMask[i];
+            if (i == bin / 32)
+                mask &= ~0u << (bin % 32);
+            if (mask != 0)
+                return sSmallBins[i * 32 + LowestSetBit(mask)];
+        }
+    }
+
+    return FindTreeBlock(size);
+}
+
+static void InitFreeBlocks(void *heapStart)
+{
+    u32 i;
+
+    for (i = 0; i < SMALL_BIN_COUNT; i++)
+        sSmallBins[i] = NULL;
+    for (i = 0; i < SMALL_BIN_COUNT / 32; i++)
+        sSmallBinMask[i] = 0;
+    sLargeBlockTree = NULL;
+
+    gHeapStats.usedBytes = 0;
+    gHeapStats.peakUsedBytes = 0;
+    gHeapStats.numAllocs = 0;
+    gHeapStats.peakNumAllocs = 0;
+    gHeapStats.numFailedAllocs = 0;
+
+    AddFreeBlock((struct MemBlock *)heapStart);
+}
+
+void *AllocInternal(void *heapStart, u32 size)
+{
+    struct FreeBlock *freeBlock;
+    struct MemBlock *head = (struct MemBlock *)heapStart;
+    struct MemBlock *pos;
+    struct MemBlock *splitBlock;
+    u32 foundBlockSize;
+
+    // Alignment
+    if (size & 3)
+        size = 4 * ((size / 4) + 1);
+
+    if (size < MIN_BLOCK_SIZE)
+        size = MIN_BLOCK_SIZE;
+
+    freeBlock = FindFreeBlock(size);
+
+    if (freeBlock == NULL) {
+        gHeapStats.numFailedAllocs++;
+        return NULL;
+    }
+
+    pos = GetMemBlock(freeBlock);
+    RemoveFreeBlock(pos);
+    pos->flag = TRUE;
+    foundBlockSize = pos->size;
+
+    if (foundBlockSize - size >= 2 * sizeof(struct MemBlock)) {
+        // The block is significantly bigger than the requested size, so
+        // split the rest into a separate free block.
+        foundBlockSize -= sizeof(struct MemBlock);
+        foundBlockSize -= size;
+
+        splitBlock = (struct MemBlock *)(pos->data + size);
+        pos->size = size;
+
+        PutMemBlockHeader(splitBlock, pos, pos->next, foundBlockSize);
+
+        pos->next = splitBlock;
+
+        if (splitBlock->next != head)
+            splitBlock->next->prev = splitBlock;
+
+        AddFreeBlock(splitBlock);
+    }
+
+    gHeapStats.usedBytes += sizeof(struct MemBlock) + pos->size;
+    if (gHeapStats.usedBytes > gHeapStats.peakUsedBytes)
+        gHeapStats.peakUsedBytes = gHeapStats.usedBytes;
+    if (++gHeapStats.numAllocs > gHeapStats.peakNumAllocs)
+        gHeapStats.peakNumAllocs = gHeapStats.numAllocs;
+
+    return pos->data;
+}
+
+void FreeInternal(void *heapStart, void *pointer)
+{
+    if (pointer) {
+        struct MemBlock *head = (struct MemBlock *)heapStart;
+        struct MemBlock *block = (struct MemBlock *)((u8 *)pointer - sizeof(struct MemBlock));
+        block->flag = FALSE;
+
+        gHeapStats.usedBytes -= sizeof(struct MemBlock) + block->size;
+        gHeapStats.numAllocs--;
+
+        // If the freed block isn't the last one, merge with the next block
+        // if it's not in use.
+        if (block->next != head && !block->next->flag) {
+            RemoveFreeBlock(block->next);
+            block->size += sizeof(struct MemBlock) + block->next->size;
+            block->next->magic = 0;
+            block->next = block->next->next;
+            if (block->next != head)
+                block->next->prev = block;
+        }
+
+        // If the freed block isn't the first one, merge with the previous block
+        // if it's not in use.
+        if (block != head && !block->prev->flag) {
+            RemoveFreeBlock(block->prev);
+            block->prev->next = block->next;
+
+            if (block->next != head)
+                block->next->prev = block->prev;
+
+            block->magic = 0;
+            block->prev->size += sizeof(struct MemBlock) + block->size;
+            block = block->prev;
+        }
+
+        AddFreeBlock(block);
+    }
+}
+#endif // SIZE_CLASS_HEAP
+
 void *AllocZeroedInternal(void *heapStart, u32 size)
 {
     void *mem = AllocInternal(heapStart, size);
@@ -174,8 +492,12 @@ void InitHeap(void *heapStart, u32 heapSize)
     sHeapStart = heapStart;
     sHeapSize = heapSize;
     PutFirstMemBlockHeader(heapStart, heapSize);
+#ifdef SIZE_CLASS_HEAP
+    InitFreeBlocks(heapStart);
+#endif
 }
 
+#ifndef HEAP_TRACE
 void *Alloc(u32 size)
 {
     return AllocInternal(sHeapStart, size);
@@ -190,6 +512,29 @@ void Free(void *pointer)
 {
     FreeInternal(sHeapStart, pointer);
 }
+#else
+// Logs each call in the format tools/heapbench replays.
+void *Alloc(u32 size)
+{
+    void *mem = AllocInternal(sHeapStart, size);
+    AGBPrintf("heap a %x %u\n", (u32)mem, size);
+    return mem;
+}
+
+void *AllocZeroed(u32 size)
+{
+    void *mem = AllocZeroedInternal(sHeapStart, size);
+    AGBPrintf("heap a %x %u\n", (u32)mem, size);
+    return mem;
+}
+
+void Free(void *pointer)
+{
+    if (pointer != NULL)
+        AGBPrintf("heap f %x\n", (u32)pointer);
+    FreeInternal(sHeapStart, pointer);
+}
+#endif // HEAP_TRACE
 
 bool32 CheckMemBlock(void *pointer)
 {
@@ -200,11 +545,140 @@ bool32 CheckHeap()
 {
     struct MemBlock *pos = (struct MemBlock *)sHeapStart;
 
+#ifdef SIZE_CLASS_HEAP
+    gHeapStats.freeBytes = 0;
+    gHeapStats.largestFreeBlock = 0;
+    gHeapStats.numFreeBlocks = 0;
+#endif
+
     do {
         if (!CheckMemBlockInternal(sHeapStart, pos->data))
             return FALSE;
+#ifdef SIZE_CLASS_HEAP
+        if (!pos->flag) {
+            gHeapStats.freeBytes += pos->size;
+            gHeapStats.numFreeBlocks++;
+            if (pos->size > gHeapStats.largestFreeBlock)
+                gHeapStats.largestFreeBlock = pos->size;
+        }
+#endif
         pos = pos->next;
     } while (pos != (struct MemBlock *)sHeapStart);
 
+#ifdef SIZE_CLASS_HEAP
+    // The share of free memory outside the largest free block.
+    if (gHeapStats.freeBytes != 0)
+        gHeapStats.fragmentation = 100 - gHeapStats.largestFreeBlock * 100 / gHeapStats.freeBytes;
+    else
+        gHeapStats.fragmentation = 0;
+#endif
+
     return TRUE;
 }
+
+#ifdef SCENE_ARENAS
+// Each block in an arena is preceded by a word holding the offset of the
+// previous block, with bit 0 set once the block is freed. top is the offset
+// of the last block, or 0 if there are none; freeing it moves used back
+// past it and any freed blocks below it.
+struct SceneArena {
+    u8 *start;
+    u32 size;
+    u32 used;
+    u32 top;
+    bool32 active;
+};
+
+#define ARENA_BLOCK_HEADER(arena, offset) (*(u32 *)((arena)->start + (offset) - 4))
+
+static struct SceneArena sSceneArenas[NUM_SCENE_ARENAS];
+
+EWRAM_DATA struct SceneArenaStats gSceneArenaStats[NUM_SCENE_ARENAS] = {0};
+
+void SceneArenaBegin(u8 arenaId, u32 size)
+{
+    struct SceneArena *arena = &sSceneArenas[arenaId];
+
+    // A scene that is entered again without being left keeps its arena.
+    if (arena->active)
+        return;
+
+    arena->start = Alloc(size);
+    arena->size = size;
+    arena->used = 0;
+    arena->top = 0;
+    arena->active = (arena->start != NULL);
+    gSceneArenaStats[arenaId].size = size;
+}
+
+void SceneArenaEnd(u8 arenaId)
+{
+    struct SceneArena *arena = &sSceneArenas[arenaId];
+
+    if (!arena->active)
+        return;
+
+    AGBPrintf("scene arena %d: %u of %u bytes, %u overflows\n", arenaId,
+        gSceneArenaStats[arenaId].highWaterMark, arena->size, gSceneArenaStats[arenaId].numOverflows);
+    Free(arena->start);
+    arena->active = FALSE;
+}
+
+void *SceneArenaAlloc(u8 arenaId, u32 size)
+{
+    struct SceneArena *arena = &sSceneArenas[arenaId];
+    u32 offset;
+
+    // Alignment
+    if (size & 3)
+        size = 4 * ((size / 4) + 1);
+
+    if (!arena->active || arena->size - arena->used < size + 4) {
+        if (arena->active)
+            gSceneArenaStats[arenaId].numOverflows++;
+        return Alloc(size);
+    }
+
+    offset = arena->used + 4;
+    ARENA_BLOCK_HEADER(arena, offset) = arena->top;
+    arena->top = offset;
+    arena->used = offset + size;
+
+    if (arena->used > gSceneArenaStats[arenaId].highWaterMark)
+        gSceneArenaStats[arenaId].highWaterMark = arena->used;
+
+    return arena->start + offset;
+}
+
+void *SceneArenaAllocZeroed(u8 arenaId, u32 size)
+{
+    void *mem = SceneArenaAlloc(arenaId, size);
+
+    if (mem != NULL) {
+        if (size & 3)
+            size = 4 * ((size / 4) + 1);
+
+        CpuFill32(0, mem, size);
+    }
+
+    return mem;
+}
+
+void SceneArenaFree(u8 arenaId, void *pointer)
+{
+    struct SceneArena *arena = &sSceneArenas[arenaId];
+    u8 *mem = pointer;
+
+    if (!arena->active || mem < arena->start || mem >= arena->start + arena->size) {
+        Free(pointer);
+        return;
+    }
+
+    ARENA_BLOCK_HEADER(arena, mem - arena->start) |= 1;
+
+    while (arena->top != 0 && (ARENA_BLOCK_HEADER(arena, arena->top) & 1)) {
+        arena->used = arena->top - 4;
+        arena->top = ARENA_BLOCK_HEADER(arena, arena->top) & ~1;
+    }
+}
+#endif // SCENE_ARENAS
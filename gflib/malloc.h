@@ -16,9 +16,84 @@
 
 extern u8 gHeap[];
 
+#ifdef SIZE_CLASS_HEAP
+struct HeapStats
+{
+    // Updated by every Alloc and Free. Sizes include block headers.
+    u32 usedBytes;
+    u32 peakUsedBytes;
+    u32 numAllocs;
+    u32 peakNumAllocs;
+    u32 numFailedAllocs;
+
+    // Updated by CheckHeap.
+    u32 freeBytes;
+    u32 largestFreeBlock;
+    u32 numFreeBlocks;
+    u32 fragmentation; // percent of freeBytes not in largestFreeBlock
+};
+
+extern struct HeapStats gHeapStats;
+
+bool32 CheckHeap(void);
+#endif
+
 void *Alloc(u32 size);
 void *AllocZeroed(u32 size);
 void Free(void *pointer);
 void InitHeap(void *pointer, u32 size);
 
+// Screens that allocate most of their memory on entry and free it on exit
+// can take it from a scene arena instead: a slice of the heap reserved by
+// SCENE_ARENA_BEGIN, allocated from in order and released in one piece by
+// SCENE_ARENA_END. Blocks freed with SCENE_FREE are reused once every block
+// allocated after them is freed too. An arena that's full, or not begun,
+// hands out heap blocks instead, so everything an arena allocates must be
+// freed with SCENE_FREE, before SCENE_ARENA_END. Without SCENE_ARENAS in
+// include/config.h these are plain Alloc and Free calls, and the arena ids
+// are never looked at.
+#ifdef SCENE_ARENAS
+enum
+{
+    SCENE_ARENA_SUMMARY_SCREEN,
+    SCENE_ARENA_POKEDEX,
+    SCENE_ARENA_STORAGE,
+    SCENE_ARENA_PARTY_MENU,
+    NUM_SCENE_ARENAS
+};
+
+struct SceneArenaStats
+{
+    u32 size;
+    u32 highWaterMark; // most bytes used at once by any visit to the scene
+    u32 numOverflows;  // allocations that didn't fit and came from the heap
+};
+
+extern struct SceneArenaStats gSceneArenaStats[NUM_SCENE_ARENAS];
+
+void SceneArenaBegin(u8 arenaId, u32 size);
+void SceneArenaEnd(u8 arenaId);
+void *SceneArenaAlloc(u8 arenaId, u32 size);
+void *SceneArenaAllocZeroed(u8 arenaId, u32 size);
+void SceneArenaFree(u8 arenaId, void *pointer);
+
+#define SCENE_ARENA_BEGIN(arenaId, size) SceneArenaBegin(arenaId, size)
+#define SCENE_ARENA_END(arenaId) SceneArenaEnd(arenaId)
+#define SCENE_ALLOC(arenaId, size) SceneArenaAlloc(arenaId, size)
+#define SCENE_ALLOC_ZEROED(arenaId, size) SceneArenaAllocZeroed(arenaId, size)
+#define SCENE_FREE(arenaId, ptr) SceneArenaFree(arenaId, ptr)
+#else
+#define SCENE_ARENA_BEGIN(arenaId, size)
+#define SCENE_ARENA_END(arenaId)
+#define SCENE_ALLOC(arenaId, size) Alloc(size)
+#define SCENE_ALLOC_ZEROED(arenaId, size) AllocZeroed(size)
+#define SCENE_FREE(arenaId, ptr) Free(ptr)
+#endif
+
+#define SCENE_FREE_AND_SET_NULL(arenaId, ptr) \
+{                                             \
+    SCENE_FREE(arenaId, ptr);                 \
+    ptr = NULL;                               \
+}
+
 #endif // GUARD_ALLOC_H
@@ -2,6 +2,7 @@
 #include "sprite.h"
 #include "main.h"
 #include "palette.h"
+#include "cycle_timer.h"
 
 #define MAX_SPRITE_COPY_REQUESTS 64
 
@@ -48,6 +49,9 @@ struct OamDimensions
 static void UpdateOamCoords(void);
 static void BuildSpritePriorities(void);
 static void SortSprites(void);
+#ifdef INCREMENTAL_SPRITE_SORT
+static void UpdateSpriteOrder(void);
+#endif
 static void CopyMatricesToOamBuffer(void);
 static void AddSpritesToOamBuffer(void);
 static u8 CreateSpriteAt(u8 index, const struct SpriteTemplate *template, s16 x, s16 y, u8 subpriority);
@@ -309,6 +313,11 @@ u8 gReservedSpritePaletteCount;
 EWRAM_DATA struct Sprite gSprites[MAX_SPRITES + 1] = {0};
 EWRAM_DATA static u16 sSpritePriorities[MAX_SPRITES] = {0};
 EWRAM_DATA static u8 sSpriteOrder[MAX_SPRITES] = {0};
+#ifdef INCREMENTAL_SPRITE_SORT
+EWRAM_DATA static u32 sSpriteSortKeys[MAX_SPRITES] = {0};
+EWRAM_DATA static bool8 sSpriteOrderIsSorted = FALSE;
+EWRAM_DATA struct SpriteSortStats gSpriteSortStats = {0};
+#endif
 EWRAM_DATA static bool8 sShouldProcessSpriteCopyRequests = 0;
 EWRAM_DATA static u8 sSpriteCopyRequestCount = 0;
 EWRAM_DATA static struct SpriteCopyRequest sSpriteCopyRequests[MAX_SPRITES] = {0};
@@ -354,15 +363,30 @@ void AnimateSprites(void)
 void BuildOamBuffer(void)
 {
     u8 temp;
+#ifdef INCREMENTAL_SPRITE_SORT
+    u16 cycles;
+
+    CYCLE_TIMER_START(TIMER_1CLK);
+    UpdateOamCoords();
+    UpdateSpriteOrder();
+#else
     UpdateOamCoords();
     BuildSpritePriorities();
     SortSprites();
+#endif
     temp = gMain.oamLoadDisabled;
     gMain.oamLoadDisabled = TRUE;
     AddSpritesToOamBuffer();
     CopyMatricesToOamBuffer();
     gMain.oamLoadDisabled = temp;
     sShouldProcessSpriteCopyRequests = TRUE;
+#ifdef INCREMENTAL_SPRITE_SORT
+    cycles = CYCLE_TIMER_READ();
+    CYCLE_TIMER_STOP();
+    gSpriteSortStats.cycles = cycles;
+    if (cycles > gSpriteSortStats.maxCycles)
+        gSpriteSortStats.maxCycles = cycles;
+#endif
 }
 
 void UpdateOamCoords(void)
@@ -495,6 +519,178 @@ void SortSprites(void)
     }
 }
 
+#ifdef INCREMENTAL_SPRITE_SORT
+
+// Sort keys put sprites in the same order as SortSprites: by priority and
+// subpriority, then from the bottom of the screen up, with y wrapped the
+// same way for sprites hanging off the top of the screen.
+#define SORT_KEY_Y_BITS 9
+#define SORT_KEY_BITS (10 + SORT_KEY_Y_BITS)
+#define SORT_RADIX_BITS 7
+#define SORT_RADIX (1 << SORT_RADIX_BITS)
+
+// Past this many changed sprites, radix sorting all of them is quicker
+// than insertion sorting the changed ones.
+#define MAX_MERGED_SPRITES 16
+
+static u32 GetSpriteSortKey(struct Sprite *sprite)
+{
+    u32 priority = sprite->subpriority | (sprite->oam.priority << 8);
+    s16 y = sprite->oam.y;
+
+    if (y >= DISPLAY_HEIGHT)
+        y = y - 256;
+
+    if (sprite->oam.affineMode == ST_OAM_AFFINE_DOUBLE
+     && sprite->oam.size == ST_OAM_SIZE_3)
+    {
+        u32 shape = sprite->oam.shape;
+        if (shape == ST_OAM_SQUARE || shape == ST_OAM_V_RECTANGLE)
+        {
+            if (y > 128)
+                y = y - 256;
+        }
+    }
+
+    return (priority << SORT_KEY_Y_BITS) | (DISPLAY_HEIGHT - 1 - y);
+}
+
+// Stable LSD radix sort of sSpriteOrder by sort key.
+static void RadixSortSprites(void)
+{
+    u8 buffer[MAX_SPRITES];
+    u8 counts[SORT_RADIX];
+    u8 *src = sSpriteOrder;
+    u8 *dest = buffer;
+    u8 *swap;
+    u32 shift, i, digit, total, count;
+
+    for (shift = 0; shift < SORT_KEY_BITS; shift += SORT_RADIX_BITS)
+    {
+        for (i = 0; i < SORT_RADIX; i++)
+            counts[i] = 0;
+
+        for (i = 0; i < MAX_SPRITES; i++)
+            counts[(sSpriteSortKeys[src[i]] >> shift) % SORT_RADIX]++;
+
+        total = 0;
+        for (i = 0; i < SORT_RADIX; i++)
+        {
+            count = counts[i];
+            counts[i] = total;
+            total += count;
+        }
+
+        for (i = 0; i < MAX_SPRITES; i++)
+        {
+            digit = (sSpriteSortKeys[src[i]] >> shift) % SORT_RADIX;
+            dest[counts[digit]++] = src[i];
+        }
+
+        swap = src;
+        src = dest;
+        dest = swap;
+    }
+
+    if (src != sSpriteOrder)
+    {
+        for (i = 0; i < MAX_SPRITES; i++)
+            sSpriteOrder[i] = src[i];
+    }
+}
+
+// Takes the changed sprites out of sSpriteOrder, insertion sorts them and
+// merges them back in among the rest, which are still sorted from last
+// frame. Equal keys keep last frame's order, as they do in RadixSortSprites.
+static void MergeChangedSprites(const bool8 *changed)
+{
+    u8 order[MAX_SPRITES];
+    u8 unchanged[MAX_SPRITES]; // positions in order
+    u8 moved[MAX_SPRITES];     // positions in order, sorted by key
+    u32 numUnchanged = 0;
+    u32 numMoved = 0;
+    u32 i, j, key;
+
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        order[i] = sSpriteOrder[i];
+        if (!changed[order[i]])
+        {
+            unchanged[numUnchanged++] = i;
+        }
+        else
+        {
+            key = sSpriteSortKeys[order[i]];
+            for (j = numMoved; j > 0 && sSpriteSortKeys[order[moved[j - 1]]] > key; j--)
+                moved[j] = moved[j - 1];
+            moved[j] = i;
+            numMoved++;
+        }
+    }
+
+    i = 0;
+    j = 0;
+    while (i + j < MAX_SPRITES)
+    {
+        if (j == numMoved
+         || (i < numUnchanged
+          && (sSpriteSortKeys[order[unchanged[i]]] < sSpriteSortKeys[order[moved[j]]]
+           || (sSpriteSortKeys[order[unchanged[i]]] == sSpriteSortKeys[order[moved[j]]]
+            && unchanged[i] < moved[j]))))
+        {
+            sSpriteOrder[i + j] = order[unchanged[i]];
+            i++;
+        }
+        else
+        {
+            sSpriteOrder[i + j] = order[moved[j]];
+            j++;
+        }
+    }
+}
+
+// Re-sorts sSpriteOrder after sprites have moved. SortSprites' insertion
+// sort is stable, so any stable sort of last frame's order by the same
+// keys gives the same result, and sprites whose key hasn't changed since
+// last frame are already in order among themselves.
+static void UpdateSpriteOrder(void)
+{
+    bool8 changed[MAX_SPRITES];
+    u32 numChanged = 0;
+    u32 i, key;
+
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        key = GetSpriteSortKey(&gSprites[i]);
+        changed[i] = (key != sSpriteSortKeys[i]);
+        if (changed[i])
+        {
+            sSpriteSortKeys[i] = key;
+            numChanged++;
+        }
+    }
+
+    gSpriteSortStats.numChanged = numChanged;
+
+    if (!sSpriteOrderIsSorted || numChanged > MAX_MERGED_SPRITES)
+    {
+        RadixSortSprites();
+        sSpriteOrderIsSorted = TRUE;
+        gSpriteSortStats.numRadixSorted++;
+    }
+    else if (numChanged != 0)
+    {
+        MergeChangedSprites(changed);
+        gSpriteSortStats.numMerged++;
+    }
+    else
+    {
+        gSpriteSortStats.numSkipped++;
+    }
+}
+
+#endif // INCREMENTAL_SPRITE_SORT
+
 void CopyMatricesToOamBuffer(void)
 {
     u8 i;
@@ -888,6 +1084,9 @@ void ResetAllSprites(void)
     }
 
     ResetSprite(&gSprites[i]);
+#ifdef INCREMENTAL_SPRITE_SORT
+    sSpriteOrderIsSorted = FALSE;
+#endif
 }
 
 // UB: template pointer may point to freed temporary storage
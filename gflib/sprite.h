@@ -259,6 +259,20 @@ extern s16 gSpriteCoordOffsetY;
 extern struct OamMatrix gOamMatrices[];
 extern bool8 gAffineAnimsDisabled;
 
+#ifdef INCREMENTAL_SPRITE_SORT
+struct SpriteSortStats
+{
+    u16 cycles;          // spent in the last BuildOamBuffer
+    u16 maxCycles;
+    u8 numChanged;       // sprites whose sort key changed in the last frame
+    u32 numSkipped;      // frames where no sort key changed
+    u32 numMerged;       // frames that re-sorted only the changed sprites
+    u32 numRadixSorted;  // frames that re-sorted every sprite
+};
+
+extern struct SpriteSortStats gSpriteSortStats;
+#endif
+
 void ResetSpriteData(void);
 void AnimateSprites(void);
 void BuildOamBuffer(void);
@@ -21,6 +21,16 @@ MISCGFXDIR := graphics/misc
 types := normal fight flying poison ground rock bug ghost steel mystery fire water grass electric psychic ice dragon dark
 contest_types := cool beauty cute smart tough
 
+# With GFX_BATCH=1, the gbagfx conversions needed by the requested goals are
+# collected from a dry run and done by a single `gbagfx batch` process before
+# any rule runs, so the per-file rules below find their targets up to date.
+ifeq ($(GFX_BATCH),1)
+ifeq ($(SCAN_DEPS),1)
+GFX_BATCH_MANIFEST := $(OBJ_DIR)/gfx_batch.txt
+$(call infoshell, $(MAKE) -n -k GFX_BATCH=0 MID_BATCH=0 $(MAKECMDGOALS) 2>/dev/null | sed -n 's|^$(GFX) ||p' > $(GFX_BATCH_MANIFEST); $(GFX) batch $(GFX_BATCH_MANIFEST))
+endif
+endif
+
 
 
 ### Castform ###
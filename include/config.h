@@ -26,6 +26,40 @@
 // Uncomment to fix some identified minor bugs
 //#define BUGFIX
 
+// Uncomment to replace the first-fit heap in gflib/malloc.c with one that
+// keeps free blocks in bins by size and counts usage in gHeapStats. The
+// ROM will no longer match. tools/heapbench compares the two.
+//#define SIZE_CLASS_HEAP
+
+// Uncomment to give the summary screen, Pokedex, PC storage and party menu
+// each an arena for the memory they use while open (see gflib/malloc.h),
+// with high-water marks in gSceneArenaStats. The ROM will no longer match.
+//#define SCENE_ARENAS
+
+// Uncomment to have BuildOamBuffer re-sort only the sprites whose priority,
+// subpriority or y changed since the last frame, and time itself into
+// gSpriteSortStats. The ROM will no longer match.
+//#define INCREMENTAL_SPRITE_SORT
+
+// Uncomment to keep the task list in buckets by priority, with a bitmap of
+// active tasks, so CreateTask doesn't walk the list and FindTaskIdByFunc
+// and friends only look at active tasks. The ROM will no longer match.
+//#define TASK_PRIORITY_BUCKETS
+
+// Uncomment to have RunTasks time every task into gTaskCycleCounts.
+// The ROM will no longer match.
+//#define TASK_CYCLE_COUNTS
+
+// Uncomment to have ProcessDma3Requests serve palettes first, then sprite
+// tiles, then BG tiles and tilemaps, fitting as many requests into VBlank
+// as an estimate of their cost allows. Repeated and adjoining requests are
+// merged. Counts are kept in gDma3Stats. The ROM will no longer match.
+//#define DMA3_PRIORITY_QUEUE
+
+// Uncomment to log every Alloc and Free with AGBPrintf, for replaying with
+// tools/heapbench. NDEBUG above must be commented out too.
+//#define HEAP_TRACE
+
 // Various undefined behavior bugs may or may not prevent compilation with
 // newer compilers. So always fix them when using a modern compiler.
 #if MODERN || defined(BUGFIX)
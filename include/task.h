@@ -22,6 +22,18 @@ struct Task
 
 extern struct Task gTasks[];
 
+#ifdef TASK_CYCLE_COUNTS
+struct TaskCycleCounts
+{
+    TaskFunc func;   // what the task ran during the last RunTasks
+    u32 cycles;      // spent in it during the last RunTasks
+    u32 peakCycles;  // most spent in one RunTasks since the task was created
+};
+
+extern struct TaskCycleCounts gTaskCycleCounts[];
+extern u32 gRunTasksCycles;
+#endif
+
 void ResetTasks(void);
 u8 CreateTask(TaskFunc func, u8 priority);
 void DestroyTask(u8 taskId);
@@ -1,8 +1,16 @@
 # JSON files are run through jsonproc, which is a tool that converts JSON data to an output file
 # based on an Inja template. https://github.com/pantor/inja
 
+# jsonproc leaves its output alone when the contents haven't changed, so the
+# output depends on a stamp rather than directly on the JSON and template.
+# The stamp is also remade when the output is missing, since a deleted output
+# would otherwise look up to date next to it.
 AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/wild_encounters.h
-$(DATA_SRC_SUBDIR)/wild_encounters.h: $(DATA_SRC_SUBDIR)/wild_encounters.json $(DATA_SRC_SUBDIR)/wild_encounters.json.txt
-	$(JSONPROC) $^ $@
+$(DATA_SRC_SUBDIR)/wild_encounters.h: $(OBJ_DIR)/wild_encounters.stamp ;
+$(OBJ_DIR)/wild_encounters.stamp: $(DATA_SRC_SUBDIR)/wild_encounters.json $(DATA_SRC_SUBDIR)/wild_encounters.json.txt \
+		$(if $(wildcard $(DATA_SRC_SUBDIR)/wild_encounters.h),,FORCE)
+	@mkdir -p $(@D)
+	$(JSONPROC) --cache $(OBJ_DIR) $(filter-out FORCE,$^) $(DATA_SRC_SUBDIR)/wild_encounters.h
+	@touch $@
 
 $(C_BUILDDIR)/wild_encounter.o: c_dep += $(DATA_SRC_SUBDIR)/wild_encounters.h
@@ -1,7 +1,7 @@
 
 MAKEFLAGS += --no-print-directory
 
-TOOLDIRS := $(filter-out tools/agbcc tools/binutils,$(wildcard tools/*))
+TOOLDIRS := $(filter-out tools/agbcc tools/binutils tools/common,$(wildcard tools/*))
 
 .PHONY: all $(TOOLDIRS)
 
@@ -1,5 +1,16 @@
 STD_REVERB = 50
 
+# With MID_BATCH=1, the songs that need converting for the requested goals
+# are collected from a dry run and converted by a single `mid2agb --batch`
+# process before any rule runs, so the per-song rules below find their
+# targets up to date.
+ifeq ($(MID_BATCH),1)
+ifeq ($(SCAN_DEPS),1)
+MID_BATCH_MANIFEST := $(OBJ_DIR)/mid_batch.txt
+$(call infoshell, $(MAKE) -n -k MID_BATCH=0 GFX_BATCH=0 $(MAKECMDGOALS) 2>/dev/null | sed -n 's|^$(MID) ||p' > $(MID_BATCH_MANIFEST); $(MID) --batch $(MID_BATCH_MANIFEST))
+endif
+endif
+
 $(MID_BUILDDIR)/%.o: $(MID_SUBDIR)/%.s
 	$(AS) $(ASFLAGS) -I sound -o $@ $<
 
@@ -0,0 +1,1933 @@
+	.include "MPlayDef.s"
+
+	.equ	mus_link_contest_p1_grp, voicegroup039
+	.equ	mus_link_contest_p1_pri, 0
+	.equ	mus_link_contest_p1_rev, reverb_set+50
+	.equ	mus_link_contest_p1_mvl, 79
+	.equ	mus_link_contest_p1_key, 0
+	.equ	mus_link_contest_p1_tbs, 1
+	.equ	mus_link_contest_p1_exg, 1
+	.equ	mus_link_contest_p1_cmp, 1
+
+	.section .rodata
+	.global	mus_link_contest_p1
+	.align	2
+
+@**************** Track 1 (Midi-Chn.1) ****************@
+
+mus_link_contest_p1_1:
+	.byte	KEYSH , mus_link_contest_p1_key+0
+mus_link_contest_p1_1_B1:
+@ 000   ----------------------------------------
+	.byte	TEMPO , 128*mus_link_contest_p1_tbs/2
+	.byte		VOICE , 56
+	.byte		LFOS  , 44
+	.byte		BENDR , 12
+	.byte		PAN   , c_v+0
+	.byte		VOL   , 91*mus_link_contest_p1_mvl/mxv
+	.byte		BEND  , c_v+0
+	.byte		N06   , Fn4 , v112
+	.byte	W12
+	.byte		N03   
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N06   
+	.byte	W12
+	.byte		N03   
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N03   
+	.byte	W03
+	.byte		        Gn4 , v076
+	.byte	W03
+	.byte		        Fn4 , v096
+	.byte	W03
+	.byte		        Gn4 , v076
+	.byte	W03
+	.byte		        Fn4 , v096
+	.byte	W03
+	.byte		        Gn4 , v076
+	.byte	W03
+	.byte		        Fn4 , v096
+	.byte	W03
+	.byte		        Gn4 , v072
+	.byte	W03
+	.byte		N06   , Fn4 , v112
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W06
+	.byte		        Cn4 
+	.byte	W06
+@ 001   ----------------------------------------
+	.byte		        Fn3 
+	.byte	W06
+	.byte		        Cn3 
+	.byte	W06
+	.byte		        Fn3 
+	.byte	W06
+	.byte		        An3 
+	.byte	W06
+	.byte		        Cn4 
+	.byte	W06
+	.byte		        An3 
+	.byte	W06
+	.byte		        Cn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		N24   , Fn4 
+	.byte	W24
+	.byte		N03   , Ds4 , v096
+	.byte	W03
+	.byte		        Dn4 
+	.byte	W03
+	.byte		        Cn4 
+	.byte	W03
+	.byte		        As3 
+	.byte	W03
+	.byte		        An3 
+	.byte	W03
+	.byte		        Gn3 
+	.byte	W03
+	.byte		        Fn3 
+	.byte	W03
+	.byte		        Ds3 , v092
+	.byte	W03
+@ 002   ----------------------------------------
+	.byte		N06   , Dn3 , v112
+	.byte	W12
+	.byte		N18   
+	.byte	W24
+	.byte		N06   
+	.byte	W06
+	.byte		        Ds3 
+	.byte	W06
+	.byte		N18   , Fn3 
+	.byte	W24
+	.byte		        As3 
+	.byte	W24
+@ 003   ----------------------------------------
+	.byte		N06   , Cn4 
+	.byte	W06
+	.byte		        Bn3 
+	.byte	W06
+	.byte		N32   , Cn4 
+	.byte	W36
+	.byte		N06   
+	.byte	W12
+	.byte		N18   , Gs3 
+	.byte	W24
+	.byte		N06   , Ds4 
+	.byte	W12
+@ 004   ----------------------------------------
+	.byte		        Dn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		N78   , Dn4 
+	.byte	W84
+@ 005   ----------------------------------------
+	.byte		N04   , Fs3 
+	.byte	W08
+	.byte		        As3 
+	.byte	W08
+	.byte		        Cs4 
+	.byte	W08
+	.byte		        Fs4 
+	.byte	W08
+	.byte		        Cs4 
+	.byte	W08
+	.byte		        As3 
+	.byte	W08
+	.byte		        Gs3 
+	.byte	W08
+	.byte		        Cn4 
+	.byte	W08
+	.byte		        Ds4 
+	.byte	W08
+	.byte		N18   , Gs4 
+	.byte	W18
+	.byte		N03   , Gn4 , v064
+	.byte	W03
+	.byte		        Fs4 
+	.byte	W03
+@ 006   ----------------------------------------
+	.byte		N06   , Fn4 , v112
+	.byte	W12
+	.byte		N03   , Ds3 
+	.byte	W03
+	.byte		        Dn3 
+	.byte	W03
+	.byte		N06   , Cs3 
+	.byte	W06
+	.byte		        Dn3 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        Ds3 
+	.byte	W06
+	.byte		N18   , Fn3 
+	.byte	W24
+	.byte		        As3 
+	.byte	W24
+@ 007   ----------------------------------------
+	.byte		N03   , Gs3 
+	.byte	W12
+	.byte		N24   , Cn4 
+	.byte	W24
+	.byte		N03   , Bn3 
+	.byte	W12
+	.byte		        Cn4 
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N18   , Gs3 
+	.byte	W24
+	.byte		N06   , Ds4 
+	.byte	W12
+@ 008   ----------------------------------------
+	.byte		        Dn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		N78   , Fn4 
+	.byte	W78
+	.byte		N03   , Ds4 
+	.byte	W03
+	.byte		        En4 
+	.byte	W03
+@ 009   ----------------------------------------
+	.byte		N32   , Fn4 
+	.byte	W36
+	.byte		N02   
+	.byte	W04
+	.byte		N02   
+	.byte	W04
+	.byte		N02   
+	.byte	W04
+	.byte		N24   
+	.byte	W24
+	.byte		        Ds4 
+	.byte	W24
+@ 010   ----------------------------------------
+	.byte		VOICE , 17
+	.byte	W96
+@ 011   ----------------------------------------
+	.byte	W96
+@ 012   ----------------------------------------
+	.byte	W96
+@ 013   ----------------------------------------
+	.byte	W96
+@ 014   ----------------------------------------
+	.byte	W96
+@ 015   ----------------------------------------
+	.byte	W96
+@ 016   ----------------------------------------
+	.byte	W96
+@ 017   ----------------------------------------
+	.byte	W48
+	.byte		        24
+	.byte	W48
+@ 018   ----------------------------------------
+	.byte		VOL   , 62*mus_link_contest_p1_mvl/mxv
+	.byte	W12
+	.byte		N03   , Dn4 
+	.byte	W06
+	.byte		        Dn4 , v088
+	.byte	W06
+	.byte		N06   , Ds4 , v112
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W18
+	.byte		N06   
+	.byte	W12
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W30
+@ 019   ----------------------------------------
+	.byte	W12
+	.byte		N03   
+	.byte	W06
+	.byte		        Dn4 , v092
+	.byte	W06
+	.byte		N06   , Ds4 , v112
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W18
+	.byte		        Fn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W12
+	.byte		        As3 
+	.byte	W18
+	.byte		        Cn4 
+	.byte	W12
+@ 020   ----------------------------------------
+	.byte	W12
+	.byte		        Dn4 
+	.byte	W12
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W18
+	.byte		N03   
+	.byte	W06
+	.byte		        Dn4 , v096
+	.byte	W06
+	.byte		N06   , Ds4 , v112
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W30
+@ 021   ----------------------------------------
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        As3 
+	.byte	W06
+	.byte		        Cn4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W06
+	.byte		N12   , Ds4 
+	.byte	W12
+	.byte		        Fn4 
+	.byte	W12
+	.byte		N24   , Fs4 
+	.byte	W24
+	.byte		N18   , Gs4 
+	.byte	W18
+	.byte		N03   , Gn4 
+	.byte	W03
+	.byte		        Fs4 
+	.byte	W03
+	.byte	GOTO
+	 .word	mus_link_contest_p1_1_B1
+mus_link_contest_p1_1_B2:
+@ 022   ----------------------------------------
+	.byte	FINE
+
+@**************** Track 2 (Midi-Chn.2) ****************@
+
+mus_link_contest_p1_2:
+	.byte	KEYSH , mus_link_contest_p1_key+0
+mus_link_contest_p1_2_B1:
+@ 000   ----------------------------------------
+	.byte		VOICE , 56
+	.byte		LFOS  , 44
+	.byte		BENDR , 12
+	.byte		PAN   , c_v+0
+	.byte		VOL   , 127*mus_link_contest_p1_mvl/mxv
+	.byte		N06   , Fn4 , v112
+	.byte	W12
+	.byte		N03   
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N06   
+	.byte	W12
+	.byte		N03   
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N03   
+	.byte	W03
+	.byte		        Gn4 , v076
+	.byte	W03
+	.byte		        Fn4 , v096
+	.byte	W03
+	.byte		        Gn4 , v076
+	.byte	W03
+	.byte		        Fn4 , v096
+	.byte	W03
+	.byte		        Gn4 , v076
+	.byte	W03
+	.byte		        Fn4 , v096
+	.byte	W03
+	.byte		        Gn4 , v072
+	.byte	W03
+	.byte		N06   , Fn4 , v112
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W06
+	.byte		        Cn4 
+	.byte	W06
+@ 001   ----------------------------------------
+	.byte		        Fn3 
+	.byte	W06
+	.byte		        Cn3 
+	.byte	W06
+	.byte		        Fn3 
+	.byte	W06
+	.byte		        An3 
+	.byte	W06
+	.byte		        Cn4 
+	.byte	W06
+	.byte		        An3 
+	.byte	W06
+	.byte		        Cn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		N24   , Fn4 
+	.byte	W24
+	.byte		N03   , Ds4 , v096
+	.byte	W03
+	.byte		        Dn4 
+	.byte	W03
+	.byte		        Cn4 
+	.byte	W03
+	.byte		        As3 
+	.byte	W03
+	.byte		        An3 
+	.byte	W03
+	.byte		        Gn3 
+	.byte	W03
+	.byte		        Fn3 
+	.byte	W03
+	.byte		        Ds3 , v092
+	.byte	W03
+@ 002   ----------------------------------------
+	.byte		N06   , Dn3 , v112
+	.byte	W12
+	.byte		N18   
+	.byte	W24
+	.byte		N06   
+	.byte	W06
+	.byte		        Ds3 
+	.byte	W06
+	.byte		N18   , Fn3 
+	.byte	W24
+	.byte		        As3 
+	.byte	W24
+@ 003   ----------------------------------------
+	.byte		N06   , Cn4 
+	.byte	W06
+	.byte		        Bn3 
+	.byte	W06
+	.byte		N32   , Cn4 
+	.byte	W36
+	.byte		N06   
+	.byte	W12
+	.byte		N18   , Gs3 
+	.byte	W24
+	.byte		N06   , Ds4 
+	.byte	W12
+@ 004   ----------------------------------------
+	.byte		        Dn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		N78   , Dn4 
+	.byte	W84
+@ 005   ----------------------------------------
+	.byte		N04   , Fs3 
+	.byte	W08
+	.byte		        As3 
+	.byte	W08
+	.byte		        Cs4 
+	.byte	W08
+	.byte		        Fs4 
+	.byte	W08
+	.byte		        Cs4 
+	.byte	W08
+	.byte		        As3 
+	.byte	W08
+	.byte		        Gs3 
+	.byte	W08
+	.byte		        Cn4 
+	.byte	W08
+	.byte		        Ds4 
+	.byte	W08
+	.byte		N18   , Gs4 
+	.byte	W18
+	.byte		N03   , Gn4 , v064
+	.byte	W03
+	.byte		        Fs4 
+	.byte	W03
+@ 006   ----------------------------------------
+	.byte		N06   , Fn4 , v112
+	.byte	W12
+	.byte		N03   , Ds3 
+	.byte	W03
+	.byte		        Dn3 
+	.byte	W03
+	.byte		N06   , Cs3 
+	.byte	W06
+	.byte		        Dn3 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        Ds3 
+	.byte	W06
+	.byte		N18   , Fn3 
+	.byte	W24
+	.byte		        As3 
+	.byte	W24
+@ 007   ----------------------------------------
+	.byte		N03   , Gs3 
+	.byte	W12
+	.byte		N24   , Cn4 
+	.byte	W24
+	.byte		N03   , Bn3 
+	.byte	W12
+	.byte		        Cn4 
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N18   , Gs3 
+	.byte	W24
+	.byte		N06   , Ds4 
+	.byte	W12
+@ 008   ----------------------------------------
+	.byte		        Dn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		N78   , Fn4 
+	.byte	W78
+	.byte		N03   , Ds4 
+	.byte	W03
+	.byte		        En4 
+	.byte	W03
+@ 009   ----------------------------------------
+	.byte		N32   , Fn4 
+	.byte	W36
+	.byte		N02   
+	.byte	W04
+	.byte		N02   
+	.byte	W04
+	.byte		N02   
+	.byte	W04
+	.byte		N24   
+	.byte	W24
+	.byte		        Ds4 
+	.byte	W24
+@ 010   ----------------------------------------
+	.byte		VOICE , 17
+	.byte	W96
+@ 011   ----------------------------------------
+	.byte	W96
+@ 012   ----------------------------------------
+	.byte	W96
+@ 013   ----------------------------------------
+	.byte	W96
+@ 014   ----------------------------------------
+	.byte	W96
+@ 015   ----------------------------------------
+	.byte	W96
+@ 016   ----------------------------------------
+	.byte	W96
+@ 017   ----------------------------------------
+	.byte	W48
+	.byte		        24
+	.byte	W48
+@ 018   ----------------------------------------
+	.byte		VOL   , 102*mus_link_contest_p1_mvl/mxv
+	.byte	W12
+	.byte		N03   , Dn4 
+	.byte	W06
+	.byte		        Dn4 , v088
+	.byte	W06
+	.byte		N06   , Ds4 , v112
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W18
+	.byte		N06   
+	.byte	W12
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W30
+@ 019   ----------------------------------------
+	.byte	W12
+	.byte		N03   
+	.byte	W06
+	.byte		        Dn4 , v092
+	.byte	W06
+	.byte		N06   , Ds4 , v112
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W18
+	.byte		        Fn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W12
+	.byte		        As3 
+	.byte	W18
+	.byte		        Cn4 
+	.byte	W12
+@ 020   ----------------------------------------
+	.byte	W12
+	.byte		        Dn4 
+	.byte	W12
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W18
+	.byte		N03   
+	.byte	W06
+	.byte		        Dn4 , v096
+	.byte	W06
+	.byte		N06   , Ds4 , v112
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W30
+@ 021   ----------------------------------------
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        As3 
+	.byte	W06
+	.byte		        Cn4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W06
+	.byte		N12   , Ds4 
+	.byte	W12
+	.byte		        Fn4 
+	.byte	W12
+	.byte		N24   , Fs4 
+	.byte	W24
+	.byte		N18   , Gs4 
+	.byte	W18
+	.byte		N03   , Gn4 
+	.byte	W03
+	.byte		        Fs4 
+	.byte	W03
+	.byte	GOTO
+	 .word	mus_link_contest_p1_2_B1
+mus_link_contest_p1_2_B2:
+@ 022   ----------------------------------------
+	.byte	FINE
+
+@**************** Track 3 (Midi-Chn.3) ****************@
+
+mus_link_contest_p1_3:
+	.byte	KEYSH , mus_link_contest_p1_key+0
+mus_link_contest_p1_3_B1:
+@ 000   ----------------------------------------
+	.byte		VOICE , 60
+	.byte		LFOS  , 44
+	.byte		BENDR , 12
+	.byte		PAN   , c_v+0
+	.byte		VOL   , 66*mus_link_contest_p1_mvl/mxv
+	.byte		BEND  , c_v+1
+	.byte	W96
+@ 001   ----------------------------------------
+	.byte	W96
+@ 002   ----------------------------------------
+	.byte	W96
+@ 003   ----------------------------------------
+	.byte	W96
+@ 004   ----------------------------------------
+	.byte	W96
+@ 005   ----------------------------------------
+	.byte	W96
+@ 006   ----------------------------------------
+	.byte	W96
+@ 007   ----------------------------------------
+	.byte	W96
+@ 008   ----------------------------------------
+	.byte		VOL   , 102*mus_link_contest_p1_mvl/mxv
+	.byte	W96
+@ 009   ----------------------------------------
+	.byte	W96
+@ 010   ----------------------------------------
+	.byte		VOICE , 73
+	.byte		VOL   , 91*mus_link_contest_p1_mvl/mxv
+	.byte		N04   , Dn4 , v112
+	.byte	W08
+	.byte		        Ds4 
+	.byte	W08
+	.byte		        En4 
+	.byte	W08
+	.byte		N42   , Fn4 
+	.byte	W48
+	.byte		N04   
+	.byte	W08
+	.byte		        Gn4 
+	.byte	W08
+	.byte		        Fn4 
+	.byte	W08
+@ 011   ----------------------------------------
+	.byte		N36   , Cn4 
+	.byte	W36
+	.byte		N06   , An3 
+	.byte	W06
+	.byte		        Cn4 
+	.byte	W06
+	.byte		        An4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        Gn4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		N12   , Fs4 
+	.byte	W12
+@ 012   ----------------------------------------
+	.byte		N36   , Fn4 
+	.byte	W36
+	.byte		N06   , Dn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		N12   , Fn4 
+	.byte	W12
+	.byte		N24   , Ds4 
+	.byte	W24
+	.byte		N12   , Dn4 
+	.byte	W12
+@ 013   ----------------------------------------
+	.byte		        Cn4 
+	.byte	W12
+	.byte		        Bn3 
+	.byte	W12
+	.byte		        Cn4 
+	.byte	W12
+	.byte		        Cs4 
+	.byte	W12
+	.byte		N06   , Dn4 
+	.byte	W06
+	.byte		        Cn4 
+	.byte	W12
+	.byte		        Bn3 
+	.byte	W12
+	.byte		        Dn4 
+	.byte	W06
+	.byte		N12   , Fn4 
+	.byte	W12
+@ 014   ----------------------------------------
+	.byte		N06   
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		TIE   , Gn4 
+	.byte	W72
+@ 015   ----------------------------------------
+	.byte	W48
+	.byte		EOT   
+	.byte		N06   , Fn4 
+	.byte	W06
+	.byte		N03   , Ds4 
+	.byte	W12
+	.byte		        Dn4 
+	.byte	W06
+	.byte		N06   , Ds4 
+	.byte	W06
+	.byte		        Fn4 
+	.byte	W12
+	.byte		        Gn4 
+	.byte	W06
+@ 016   ----------------------------------------
+	.byte		        As4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        An4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        Gn4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        Fn4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        En4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        En4 
+	.byte	W06
+@ 017   ----------------------------------------
+	.byte		        Fn4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        Gn4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        An4 
+	.byte	W06
+	.byte		        Gs4 
+	.byte	W06
+	.byte		        An4 
+	.byte	W06
+	.byte		        As4 
+	.byte	W12
+	.byte		N06   
+	.byte	W12
+	.byte		        Cn5 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+@ 018   ----------------------------------------
+	.byte		VOL   , 73*mus_link_contest_p1_mvl/mxv
+	.byte	W12
+	.byte		N03   , Dn4 
+	.byte	W06
+	.byte		        Dn4 , v088
+	.byte	W06
+	.byte		N06   , Ds4 , v112
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W18
+	.byte		N06   
+	.byte	W12
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W30
+@ 019   ----------------------------------------
+	.byte	W12
+	.byte		N03   
+	.byte	W06
+	.byte		        Dn4 , v092
+	.byte	W06
+	.byte		N06   , Ds4 , v112
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W18
+	.byte		        Fn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W12
+	.byte		        As3 
+	.byte	W18
+	.byte		        Cn4 
+	.byte	W12
+@ 020   ----------------------------------------
+	.byte	W12
+	.byte		        Dn4 
+	.byte	W12
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W18
+	.byte		N03   
+	.byte	W06
+	.byte		        Dn4 , v096
+	.byte	W06
+	.byte		N06   , Ds4 , v112
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W30
+@ 021   ----------------------------------------
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        As3 
+	.byte	W06
+	.byte		        Cn4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W06
+	.byte		N12   , Ds4 
+	.byte	W12
+	.byte		        Fn4 
+	.byte	W12
+	.byte		N24   , Fs4 
+	.byte	W24
+	.byte		N18   , Gs4 
+	.byte	W24
+	.byte	GOTO
+	 .word	mus_link_contest_p1_3_B1
+mus_link_contest_p1_3_B2:
+@ 022   ----------------------------------------
+	.byte	FINE
+
+@**************** Track 4 (Midi-Chn.4) ****************@
+
+mus_link_contest_p1_4:
+	.byte	KEYSH , mus_link_contest_p1_key+0
+mus_link_contest_p1_4_B1:
+@ 000   ----------------------------------------
+	.byte		VOICE , 80
+	.byte		LFOS  , 44
+	.byte		XCMD  , xIECV , 18
+	.byte		        xIECV , 16
+	.byte		BENDR , 12
+	.byte		VOL   , 73*mus_link_contest_p1_mvl/mxv
+	.byte		PAN   , c_v+0
+	.byte	W96
+@ 001   ----------------------------------------
+	.byte	W96
+@ 002   ----------------------------------------
+	.byte	W96
+@ 003   ----------------------------------------
+	.byte	W96
+@ 004   ----------------------------------------
+	.byte	W96
+@ 005   ----------------------------------------
+	.byte	W96
+@ 006   ----------------------------------------
+	.byte	W96
+@ 007   ----------------------------------------
+	.byte	W96
+@ 008   ----------------------------------------
+	.byte	W96
+@ 009   ----------------------------------------
+	.byte	W96
+@ 010   ----------------------------------------
+mus_link_contest_p1_4_010:
+	.byte		N06   , Gn3 , v112
+	.byte	W06
+	.byte		N03   , Gn3 , v096
+	.byte	W06
+	.byte		        Ds3 , v064
+	.byte	W06
+	.byte		N03   
+	.byte	W78
+	.byte	PEND
+@ 011   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_4_010
+@ 012   ----------------------------------------
+mus_link_contest_p1_4_012:
+	.byte		N06   , An3 , v112
+	.byte	W06
+	.byte		N03   , An3 , v096
+	.byte	W06
+	.byte		        Fn3 , v064
+	.byte	W06
+	.byte		N03   
+	.byte	W78
+	.byte	PEND
+@ 013   ----------------------------------------
+mus_link_contest_p1_4_013:
+	.byte		N06   , As3 , v112
+	.byte	W06
+	.byte		N03   , As3 , v096
+	.byte	W06
+	.byte		        Fn3 , v064
+	.byte	W06
+	.byte		N03   
+	.byte	W78
+	.byte	PEND
+@ 014   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_4_010
+@ 015   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_4_010
+@ 016   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_4_012
+@ 017   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_4_013
+@ 018   ----------------------------------------
+	.byte		N03   , Dn4 , v112
+	.byte	W06
+	.byte		        As3 
+	.byte	W06
+	.byte		        Fn3 
+	.byte	W06
+	.byte		        Dn3 
+	.byte	W78
+@ 019   ----------------------------------------
+	.byte		        As3 
+	.byte	W06
+	.byte		        Gn3 
+	.byte	W06
+	.byte		        Ds3 
+	.byte	W06
+	.byte		        As2 
+	.byte	W78
+@ 020   ----------------------------------------
+	.byte		        Dn4 
+	.byte	W03
+	.byte		        As3 
+	.byte	W03
+	.byte		        Fn3 
+	.byte	W03
+	.byte		        Dn3 
+	.byte	W03
+	.byte		        As2 
+	.byte	W03
+	.byte		        Fn2 
+	.byte	W03
+	.byte		        Dn2 
+	.byte	W03
+	.byte		        As1 
+	.byte	W03
+	.byte		        Dn2 
+	.byte	W03
+	.byte		        Ds2 
+	.byte	W03
+	.byte		        Fn2 
+	.byte	W03
+	.byte		        As2 
+	.byte	W03
+	.byte		        Dn3 
+	.byte	W03
+	.byte		        Ds3 
+	.byte	W03
+	.byte		        Fn3 
+	.byte	W03
+	.byte		        As3 
+	.byte	W48
+	.byte	W03
+@ 021   ----------------------------------------
+	.byte		N03   
+	.byte	W03
+	.byte		        Gn3 
+	.byte	W03
+	.byte		        Ds3 
+	.byte	W03
+	.byte		        As2 
+	.byte	W03
+	.byte		        Gn2 
+	.byte	W03
+	.byte		        Ds2 
+	.byte	W03
+	.byte		        As1 
+	.byte	W03
+	.byte		        Gn1 
+	.byte	W03
+	.byte		        As1 
+	.byte	W03
+	.byte		        Ds2 
+	.byte	W03
+	.byte		        Fn2 
+	.byte	W03
+	.byte		        Gn2 
+	.byte	W03
+	.byte		        As2 
+	.byte	W03
+	.byte		        Ds3 
+	.byte	W03
+	.byte		        Fn3 
+	.byte	W03
+	.byte		        Gn3 
+	.byte	W48
+	.byte	W03
+	.byte	GOTO
+	 .word	mus_link_contest_p1_4_B1
+mus_link_contest_p1_4_B2:
+@ 022   ----------------------------------------
+	.byte	FINE
+
+@**************** Track 5 (Midi-Chn.5) ****************@
+
+mus_link_contest_p1_5:
+	.byte	KEYSH , mus_link_contest_p1_key+0
+mus_link_contest_p1_5_B1:
+@ 000   ----------------------------------------
+	.byte		VOICE , 81
+	.byte		LFOS  , 44
+	.byte		XCMD  , xIECV , 18
+	.byte		        xIECV , 16
+	.byte		BENDR , 12
+	.byte		VOL   , 73*mus_link_contest_p1_mvl/mxv
+	.byte		PAN   , c_v+0
+	.byte	W96
+@ 001   ----------------------------------------
+	.byte	W96
+@ 002   ----------------------------------------
+	.byte	W96
+@ 003   ----------------------------------------
+	.byte	W96
+@ 004   ----------------------------------------
+	.byte	W96
+@ 005   ----------------------------------------
+	.byte	W96
+@ 006   ----------------------------------------
+	.byte	W96
+@ 007   ----------------------------------------
+	.byte	W96
+@ 008   ----------------------------------------
+	.byte	W96
+@ 009   ----------------------------------------
+	.byte	W96
+@ 010   ----------------------------------------
+mus_link_contest_p1_5_010:
+	.byte		N06   , Fn4 , v112
+	.byte	W06
+	.byte		N03   , Fn4 , v096
+	.byte	W06
+	.byte		        As3 , v064
+	.byte	W06
+	.byte		N03   
+	.byte	W78
+	.byte	PEND
+@ 011   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_5_010
+@ 012   ----------------------------------------
+mus_link_contest_p1_5_012:
+	.byte		N06   , Fn4 , v112
+	.byte	W06
+	.byte		N03   , Fn4 , v096
+	.byte	W06
+	.byte		        Cn4 , v064
+	.byte	W06
+	.byte		N03   
+	.byte	W78
+	.byte	PEND
+@ 013   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_5_010
+@ 014   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_5_010
+@ 015   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_5_010
+@ 016   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_5_012
+@ 017   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_5_010
+@ 018   ----------------------------------------
+	.byte		N03   , As4 , v112
+	.byte	W06
+	.byte		        Fn4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W06
+	.byte		        As3 
+	.byte	W78
+@ 019   ----------------------------------------
+	.byte		        Gn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        As3 
+	.byte	W06
+	.byte		        Gn3 
+	.byte	W78
+@ 020   ----------------------------------------
+	.byte		        As4 
+	.byte	W03
+	.byte		        Fn4 
+	.byte	W03
+	.byte		        Dn4 
+	.byte	W03
+	.byte		        As3 
+	.byte	W03
+	.byte		        Fn3 
+	.byte	W03
+	.byte		        Dn3 
+	.byte	W03
+	.byte		        As2 
+	.byte	W03
+	.byte		        Fn2 
+	.byte	W03
+	.byte		        As2 
+	.byte	W03
+	.byte		        Dn3 
+	.byte	W03
+	.byte		        Fn3 
+	.byte	W03
+	.byte		        As3 
+	.byte	W03
+	.byte		        Dn4 
+	.byte	W03
+	.byte		        Ds4 
+	.byte	W03
+	.byte		        Fn4 
+	.byte	W03
+	.byte		        As4 
+	.byte	W48
+	.byte	W03
+@ 021   ----------------------------------------
+	.byte		        Gn4 
+	.byte	W03
+	.byte		        Ds4 
+	.byte	W03
+	.byte		        As3 
+	.byte	W03
+	.byte		        Gn3 
+	.byte	W03
+	.byte		        Ds3 
+	.byte	W03
+	.byte		        As2 
+	.byte	W03
+	.byte		        Gn2 
+	.byte	W03
+	.byte		        Ds2 
+	.byte	W03
+	.byte		        Gn2 
+	.byte	W03
+	.byte		        As2 
+	.byte	W03
+	.byte		        Ds3 
+	.byte	W03
+	.byte		        Fn3 
+	.byte	W03
+	.byte		        Gn3 
+	.byte	W03
+	.byte		        As3 
+	.byte	W03
+	.byte		        Ds4 
+	.byte	W03
+	.byte		        Fn4 
+	.byte	W48
+	.byte	W03
+	.byte	GOTO
+	 .word	mus_link_contest_p1_5_B1
+mus_link_contest_p1_5_B2:
+@ 022   ----------------------------------------
+	.byte	FINE
+
+@**************** Track 6 (Midi-Chn.6) ****************@
+
+mus_link_contest_p1_6:
+	.byte	KEYSH , mus_link_contest_p1_key+0
+mus_link_contest_p1_6_B1:
+@ 000   ----------------------------------------
+	.byte		VOICE , 0
+	.byte		PAN   , c_v+0
+	.byte		VOL   , 66*mus_link_contest_p1_mvl/mxv
+	.byte		N06   , En1 , v112
+	.byte		N48   , An2 , v092
+	.byte	W06
+	.byte		N03   , En1 , v036
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+@ 001   ----------------------------------------
+	.byte		N06   , En1 , v112
+	.byte	W06
+	.byte		        En1 , v064
+	.byte	W06
+	.byte		        En1 , v088
+	.byte	W06
+	.byte		        En1 , v052
+	.byte	W06
+	.byte		        En1 , v096
+	.byte	W06
+	.byte		        En1 , v052
+	.byte	W06
+	.byte		        En1 , v112
+	.byte	W06
+	.byte		N06   
+	.byte	W06
+	.byte		N06   
+	.byte		N24   , An2 
+	.byte	W48
+@ 002   ----------------------------------------
+mus_link_contest_p1_6_002:
+	.byte		N06   , En1 , v112
+	.byte	W12
+	.byte		N06   
+	.byte	W24
+	.byte		N06   
+	.byte	W06
+	.byte		N06   
+	.byte	W06
+	.byte		        Cn1 
+	.byte		N48   , An2 
+	.byte	W48
+	.byte	PEND
+@ 003   ----------------------------------------
+	.byte		N06   , En1 
+	.byte	W12
+	.byte		        En1 , v092
+	.byte	W24
+	.byte		N03   , En1 , v112
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N06   
+	.byte	W12
+	.byte		N06   
+	.byte	W12
+	.byte		        Cn1 
+	.byte		N24   , An2 , v076
+	.byte	W24
+@ 004   ----------------------------------------
+	.byte		N06   , Cn1 , v112
+	.byte		N48   , An2 
+	.byte	W12
+	.byte		N06   , En1 
+	.byte	W24
+	.byte		N03   
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N06   
+	.byte	W12
+	.byte		N06   
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		N03   , En1 , v036
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+@ 005   ----------------------------------------
+	.byte		N06   , En1 , v112
+	.byte	W06
+	.byte		N03   , En1 , v036
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		        En1 , v032
+	.byte	W03
+	.byte		        En1 , v036
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		        En1 , v104
+	.byte	W03
+	.byte		        En1 , v036
+	.byte	W03
+	.byte		        En1 , v096
+	.byte	W03
+	.byte		        En1 , v036
+	.byte	W03
+	.byte		        En1 , v104
+	.byte	W03
+	.byte		        En1 , v032
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		        En1 , v036
+	.byte	W03
+	.byte		        En1 , v096
+	.byte	W03
+	.byte		        En1 , v036
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		        En1 , v096
+	.byte	W03
+	.byte		        En1 , v052
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+@ 006   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_6_002
+@ 007   ----------------------------------------
+	.byte		N06   , En1 , v112
+	.byte	W36
+	.byte		N03   
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N06   
+	.byte	W12
+	.byte		N06   
+	.byte	W12
+	.byte		        Cn1 
+	.byte		N24   , An2 , v076
+	.byte	W24
+@ 008   ----------------------------------------
+	.byte		N06   , Cn1 , v112
+	.byte		N48   , An2 
+	.byte	W06
+	.byte		N06   , Cn1 
+	.byte	W06
+	.byte		        En1 
+	.byte	W24
+	.byte		N03   
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N06   
+	.byte	W12
+	.byte		N06   
+	.byte	W12
+	.byte		N03   , En1 , v104
+	.byte	W03
+	.byte		        En1 , v064
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+@ 009   ----------------------------------------
+	.byte		        En1 , v104
+	.byte	W03
+	.byte		        En1 , v064
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		N03   
+	.byte	W03
+	.byte		        En1 , v096
+	.byte	W03
+	.byte		        En1 , v064
+	.byte	W03
+	.byte		        En1 , v096
+	.byte	W03
+	.byte		        En1 , v064
+	.byte	W03
+	.byte		N06   , En1 , v112
+	.byte	W12
+	.byte		        Cn1 
+	.byte	W12
+	.byte		        En1 
+	.byte	W06
+	.byte		N06   
+	.byte	W06
+	.byte		        Cn1 
+	.byte	W12
+@ 010   ----------------------------------------
+mus_link_contest_p1_6_010:
+	.byte		N06   , Cn1 , v112
+	.byte	W12
+	.byte		N03   
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N06   , En1 
+	.byte	W18
+	.byte		N03   , Cn1 , v100
+	.byte	W06
+	.byte		N06   , Cn1 , v112
+	.byte	W06
+	.byte		        En1 
+	.byte	W06
+	.byte		N03   , Cn1 
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N06   , En1 
+	.byte	W12
+	.byte		        Cn1 
+	.byte	W12
+	.byte	PEND
+@ 011   ----------------------------------------
+	.byte		N06   
+	.byte	W12
+	.byte		N03   
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N06   , En1 
+	.byte	W18
+	.byte		N03   , Cn1 , v100
+	.byte	W06
+	.byte		N06   , Cn1 , v112
+	.byte	W06
+	.byte		        En1 
+	.byte	W06
+	.byte		N03   , Cn1 
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N06   , En1 
+	.byte	W06
+	.byte		        Cn1 
+	.byte	W12
+	.byte		        En1 , v088
+	.byte	W06
+@ 012   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_6_010
+@ 013   ----------------------------------------
+mus_link_contest_p1_6_013:
+	.byte		N06   , Cn1 , v112
+	.byte	W12
+	.byte		N03   
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N06   , En1 
+	.byte	W18
+	.byte		N03   , Cn1 , v100
+	.byte	W06
+	.byte		        Cn1 , v112
+	.byte	W06
+	.byte		        Cn1 , v092
+	.byte	W12
+	.byte		N06   , En1 , v112
+	.byte	W12
+	.byte		N06   
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte	PEND
+@ 014   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_6_010
+@ 015   ----------------------------------------
+	.byte		N06   , Cn1 , v112
+	.byte	W12
+	.byte		N03   
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N06   , En1 
+	.byte	W18
+	.byte		N03   , Cn1 , v100
+	.byte	W06
+	.byte		N06   , Cn1 , v112
+	.byte	W06
+	.byte		        En1 
+	.byte	W06
+	.byte		N03   , Cn1 
+	.byte	W06
+	.byte		N03   
+	.byte	W06
+	.byte		N06   , En1 
+	.byte	W06
+	.byte		        Cn1 
+	.byte	W06
+	.byte		        En1 , v104
+	.byte	W06
+	.byte		        En1 , v092
+	.byte	W06
+@ 016   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_6_010
+@ 017   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_6_013
+@ 018   ----------------------------------------
+mus_link_contest_p1_6_018:
+	.byte		N06   , Cn1 , v112
+	.byte	W18
+	.byte		        Cn1 , v088
+	.byte	W06
+	.byte		        Dn1 , v112
+	.byte	W12
+	.byte		        Cn1 
+	.byte	W12
+	.byte		N06   
+	.byte	W12
+	.byte		        Cn1 , v092
+	.byte	W06
+	.byte		        Cn1 , v076
+	.byte	W06
+	.byte		        Dn1 , v104
+	.byte	W12
+	.byte		        En1 , v112
+	.byte	W06
+	.byte		        Cn1 , v096
+	.byte	W06
+	.byte	PEND
+@ 019   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_6_018
+@ 020   ----------------------------------------
+	.byte	PATT
+	 .word	mus_link_contest_p1_6_018
+@ 021   ----------------------------------------
+	.byte		N06   , Dn1 , v112
+	.byte	W06
+	.byte		        Dn1 , v080
+	.byte	W12
+	.byte		        Dn1 , v088
+	.byte	W06
+	.byte		        Cn1 , v112
+	.byte	W06
+	.byte		        Dn1 
+	.byte	W12
+	.byte		        Dn1 , v084
+	.byte	W06
+	.byte		        Dn1 , v112
+	.byte	W12
+	.byte		        Cn1 , v092
+	.byte	W06
+	.byte		        Cn1 , v076
+	.byte	W06
+	.byte		        Dn1 , v104
+	.byte	W12
+	.byte		        En1 , v112
+	.byte	W06
+	.byte		        Cn1 , v096
+	.byte	W06
+	.byte	GOTO
+	 .word	mus_link_contest_p1_6_B1
+mus_link_contest_p1_6_B2:
+@ 022   ----------------------------------------
+	.byte	FINE
+
+@**************** Track 7 (Midi-Chn.7) ****************@
+
+mus_link_contest_p1_7:
+	.byte	KEYSH , mus_link_contest_p1_key+0
+mus_link_contest_p1_7_B1:
+@ 000   ----------------------------------------
+	.byte		VOICE , 83
+	.byte		LFOS  , 44
+	.byte		XCMD  , xIECV , 18
+	.byte		        xIECV , 16
+	.byte		BENDR , 12
+	.byte		PAN   , c_v+0
+	.byte		VOL   , 127*mus_link_contest_p1_mvl/mxv
+	.byte		BEND  , c_v+0
+	.byte	W96
+@ 001   ----------------------------------------
+	.byte	W96
+@ 002   ----------------------------------------
+	.byte	W96
+@ 003   ----------------------------------------
+	.byte	W96
+@ 004   ----------------------------------------
+	.byte	W96
+@ 005   ----------------------------------------
+	.byte	W96
+@ 006   ----------------------------------------
+	.byte	W96
+@ 007   ----------------------------------------
+	.byte	W96
+@ 008   ----------------------------------------
+	.byte	W96
+@ 009   ----------------------------------------
+	.byte	W96
+@ 010   ----------------------------------------
+	.byte		VOL   , 62*mus_link_contest_p1_mvl/mxv
+	.byte		BEND  , c_v+1
+	.byte		N04   , Dn4 , v112
+	.byte	W08
+	.byte		        Ds4 
+	.byte	W08
+	.byte		        En4 
+	.byte	W08
+	.byte		N42   , Fn4 
+	.byte	W48
+	.byte		N04   
+	.byte	W08
+	.byte		        Gn4 
+	.byte	W08
+	.byte		        Fn4 
+	.byte	W08
+@ 011   ----------------------------------------
+	.byte		N36   , Cn4 
+	.byte	W36
+	.byte		N06   , An3 
+	.byte	W06
+	.byte		        Cn4 
+	.byte	W06
+	.byte		        An4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        Gn4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		N12   , Fs4 
+	.byte	W12
+@ 012   ----------------------------------------
+	.byte		N36   , Fn4 
+	.byte	W36
+	.byte		N06   , Dn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		N12   , Fn4 
+	.byte	W12
+	.byte		N24   , Ds4 
+	.byte	W24
+	.byte		N12   , Dn4 
+	.byte	W12
+@ 013   ----------------------------------------
+	.byte		        Cn4 
+	.byte	W12
+	.byte		        Bn3 
+	.byte	W12
+	.byte		        Cn4 
+	.byte	W12
+	.byte		        Cs4 
+	.byte	W12
+	.byte		N06   , Dn4 
+	.byte	W06
+	.byte		        Cn4 
+	.byte	W12
+	.byte		        Bn3 
+	.byte	W12
+	.byte		        Dn4 
+	.byte	W06
+	.byte		N12   , Fn4 
+	.byte	W12
+@ 014   ----------------------------------------
+	.byte		N06   
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		TIE   , Gn4 
+	.byte	W72
+@ 015   ----------------------------------------
+	.byte	W48
+	.byte		EOT   
+	.byte		N06   , Fn4 
+	.byte	W06
+	.byte		N03   , Ds4 
+	.byte	W12
+	.byte		        Dn4 
+	.byte	W06
+	.byte		N06   , Ds4 
+	.byte	W06
+	.byte		        Fn4 
+	.byte	W12
+	.byte		        Gn4 
+	.byte	W06
+@ 016   ----------------------------------------
+	.byte		        As4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        An4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        Gn4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        Fn4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        En4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        En4 
+	.byte	W06
+@ 017   ----------------------------------------
+	.byte		        Fn4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        Gn4 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+	.byte		        An4 
+	.byte	W06
+	.byte		        Gs4 
+	.byte	W06
+	.byte		        An4 
+	.byte	W06
+	.byte		        As4 
+	.byte	W12
+	.byte		N06   
+	.byte	W12
+	.byte		        Cn5 
+	.byte	W12
+	.byte		N06   
+	.byte	W06
+@ 018   ----------------------------------------
+	.byte		VOL   , 73*mus_link_contest_p1_mvl/mxv
+	.byte	W12
+	.byte		N03   , Dn4 
+	.byte	W06
+	.byte		        Dn4 , v088
+	.byte	W06
+	.byte		N06   , Ds4 , v112
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W18
+	.byte		N06   
+	.byte	W12
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W30
+@ 019   ----------------------------------------
+	.byte	W12
+	.byte		N03   
+	.byte	W06
+	.byte		        Dn4 , v092
+	.byte	W06
+	.byte		N06   , Ds4 , v112
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W18
+	.byte		        Fn4 
+	.byte	W06
+	.byte		        Ds4 
+	.byte	W12
+	.byte		        As3 
+	.byte	W18
+	.byte		        Cn4 
+	.byte	W12
+@ 020   ----------------------------------------
+	.byte	W12
+	.byte		        Dn4 
+	.byte	W12
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W18
+	.byte		N03   
+	.byte	W06
+	.byte		        Dn4 , v096
+	.byte	W06
+	.byte		N06   , Ds4 , v112
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W30
+@ 021   ----------------------------------------
+	.byte		        Ds4 
+	.byte	W06
+	.byte		        As3 
+	.byte	W06
+	.byte		        Cn4 
+	.byte	W06
+	.byte		        Dn4 
+	.byte	W06
+	.byte		N12   , Ds4 
+	.byte	W12
+	.byte		        Fn4 
+	.byte	W12
+	.byte		N24   , Fs4 
+	.byte	W24
+	.byte		N18   , Gs4 
+	.byte	W24
+	.byte	GOTO
+	 .word	mus_link_contest_p1_7_B1
+mus_link_contest_p1_7_B2:
+@ 022   ----------------------------------------
+	.byte	FINE
+
+@******************************************************@
+	.align	2
+
+mus_link_contest_p1:
+	.byte	7	@ NumTrks
+	.byte	0	@ NumBlks
+	.byte	mus_link_contest_p1_pri	@ Priority
+	.byte	mus_link_contest_p1_rev	@ Reverb.
+
+	.word	mus_link_contest_p1_grp
+
+	.word	mus_link_contest_p1_1
+	.word	mus_link_contest_p1_2
+	.word	mus_link_contest_p1_3
+	.word	mus_link_contest_p1_4
+	.word	mus_link_contest_p1_5
+	.word	mus_link_contest_p1_6
+	.word	mus_link_contest_p1_7
+
+	.end
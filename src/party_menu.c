@@ -154,6 +154,9 @@ static EWRAM_DATA u16 sPartyMenuItemId = 0;
 static EWRAM_DATA u16 sUnused = 0;
 EWRAM_DATA u8 gBattlePartyCurrentOrder[PARTY_SIZE / 2] = {0}; // bits 0-3 are the current pos of Slot 1, 4-7 are Slot 2, and so on
 
+// Holds sPartyMenuInternal, sPartyBgTilemapBuffer and sPartyMenuBoxes.
+#define PARTY_MENU_ARENA_SIZE (sizeof(struct PartyMenuInternal) + 0x800 + sizeof(struct PartyMenuBox[PARTY_SIZE]) + 0x10)
+
 // IWRAM common
 void (*gItemUseCB)(u8, TaskFunc);
 
@@ -415,7 +418,8 @@ static void InitPartyMenu(u8 menuType, u8 layout, u8 partyAction, bool8 keepCurs
     u16 i;
 
     ResetPartyMenu();
-    sPartyMenuInternal = Alloc(sizeof(struct PartyMenuInternal));
+    SCENE_ARENA_BEGIN(SCENE_ARENA_PARTY_MENU, PARTY_MENU_ARENA_SIZE);
+    sPartyMenuInternal = SCENE_ALLOC(SCENE_ARENA_PARTY_MENU, sizeof(struct PartyMenuInternal));
     if (sPartyMenuInternal == NULL)
     {
         SetMainCallback2(callback);
@@ -633,7 +637,7 @@ static void ResetPartyMenu(void)
 
 static bool8 AllocPartyMenuBg(void)
 {
-    sPartyBgTilemapBuffer = Alloc(0x800);
+    sPartyBgTilemapBuffer = SCENE_ALLOC(SCENE_ARENA_PARTY_MENU, 0x800);
     if (sPartyBgTilemapBuffer == NULL)
         return FALSE;
 
@@ -710,21 +714,22 @@ static void PartyPaletteBufferCopy(u8 offset)
 static void FreePartyPointers(void)
 {
     if (sPartyMenuInternal)
-        Free(sPartyMenuInternal);
+        SCENE_FREE(SCENE_ARENA_PARTY_MENU, sPartyMenuInternal);
     if (sPartyBgTilemapBuffer)
-        Free(sPartyBgTilemapBuffer);
+        SCENE_FREE(SCENE_ARENA_PARTY_MENU, sPartyBgTilemapBuffer);
     if (sPartyBgGfxTilemap)
         Free(sPartyBgGfxTilemap);
     if (sPartyMenuBoxes)
-        Free(sPartyMenuBoxes);
+        SCENE_FREE(SCENE_ARENA_PARTY_MENU, sPartyMenuBoxes);
     FreeAllWindowBuffers();
+    SCENE_ARENA_END(SCENE_ARENA_PARTY_MENU);
 }
 
 static void InitPartyMenuBoxes(u8 layout)
 {
     u8 i;
 
-    sPartyMenuBoxes = Alloc(sizeof(struct PartyMenuBox[PARTY_SIZE]));
+    sPartyMenuBoxes = SCENE_ALLOC(SCENE_ARENA_PARTY_MENU, sizeof(struct PartyMenuBox[PARTY_SIZE]));
 
     for (i = 0; i < PARTY_SIZE; i++)
     {
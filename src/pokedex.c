@@ -106,6 +106,9 @@ enum
 
 // EWRAM
 static EWRAM_DATA struct PokedexView *sPokedexView = NULL;
+
+// Holds sPokedexView and the tilemap buffers of the current page.
+#define POKEDEX_ARENA_SIZE (sizeof(struct PokedexView) + 4 * BG_SCREEN_SIZE + 0x20)
 static EWRAM_DATA u16 sLastSelectedPokemon = 0;
 static EWRAM_DATA u8 sPokeBallRotation = 0;
 static EWRAM_DATA struct PokedexListItem *sPokedexListItem = NULL;
@@ -1609,7 +1612,8 @@ void CB2_OpenPokedex(void)
         gMain.state++;
         break;
     case 2:
-        sPokedexView = AllocZeroed(sizeof(struct PokedexView));
+        SCENE_ARENA_BEGIN(SCENE_ARENA_POKEDEX, POKEDEX_ARENA_SIZE);
+        sPokedexView = SCENE_ALLOC_ZEROED(SCENE_ARENA_POKEDEX, sizeof(struct PokedexView));
         ResetPokedexView(sPokedexView);
         CreateTask(Task_OpenPokedexMainPage, 0);
         sPokedexView->dexMode = gSaveBlock2Ptr->pokedex.mode;
@@ -1848,7 +1852,8 @@ static void Task_ClosePokedex(u8 taskId)
         DestroyTask(taskId);
         SetMainCallback2(CB2_ReturnToFieldWithOpenMenu);
         m4aMPlayVolumeControl(&gMPlayInfo_BGM, 0xFFFF, 0x100);
-        Free(sPokedexView);
+        SCENE_FREE(SCENE_ARENA_POKEDEX, sPokedexView);
+        SCENE_ARENA_END(SCENE_ARENA_POKEDEX);
     }
 }
 
@@ -2056,10 +2061,10 @@ static bool8 LoadPokedexListPage(u8 page)
         SetGpuReg(REG_OFFSET_BG2VOFS, sPokedexView->initialVOffset);
         ResetBgsAndClearDma3BusyFlags(0);
         InitBgsFromTemplates(0, sPokedex_BgTemplate, ARRAY_COUNT(sPokedex_BgTemplate));
-        SetBgTilemapBuffer(3, AllocZeroed(BG_SCREEN_SIZE));
-        SetBgTilemapBuffer(2, AllocZeroed(BG_SCREEN_SIZE));
-        SetBgTilemapBuffer(1, AllocZeroed(BG_SCREEN_SIZE));
-        SetBgTilemapBuffer(0, AllocZeroed(BG_SCREEN_SIZE));
+        SetBgTilemapBuffer(3, SCENE_ALLOC_ZEROED(SCENE_ARENA_POKEDEX, BG_SCREEN_SIZE));
+        SetBgTilemapBuffer(2, SCENE_ALLOC_ZEROED(SCENE_ARENA_POKEDEX, BG_SCREEN_SIZE));
+        SetBgTilemapBuffer(1, SCENE_ALLOC_ZEROED(SCENE_ARENA_POKEDEX, BG_SCREEN_SIZE));
+        SetBgTilemapBuffer(0, SCENE_ALLOC_ZEROED(SCENE_ARENA_POKEDEX, BG_SCREEN_SIZE));
         DecompressAndLoadBgGfxUsingHeap(3, gPokedexMenu_Gfx, 0x2000, 0, 0);
         CopyToBgTilemapBuffer(1, gPokedexList_Tilemap, 0, 0);
         CopyToBgTilemapBuffer(3, gPokedexListUnderlay_Tilemap, 0, 0);
@@ -2154,16 +2159,16 @@ static void FreeWindowAndBgBuffers(void)
     FreeAllWindowBuffers();
     tilemapBuffer = GetBgTilemapBuffer(0);
     if (tilemapBuffer)
-        Free(tilemapBuffer);
+        SCENE_FREE(SCENE_ARENA_POKEDEX, tilemapBuffer);
     tilemapBuffer = GetBgTilemapBuffer(1);
     if (tilemapBuffer)
-        Free(tilemapBuffer);
+        SCENE_FREE(SCENE_ARENA_POKEDEX, tilemapBuffer);
     tilemapBuffer = GetBgTilemapBuffer(2);
     if (tilemapBuffer)
-        Free(tilemapBuffer);
+        SCENE_FREE(SCENE_ARENA_POKEDEX, tilemapBuffer);
     tilemapBuffer = GetBgTilemapBuffer(3);
     if (tilemapBuffer)
-        Free(tilemapBuffer);
+        SCENE_FREE(SCENE_ARENA_POKEDEX, tilemapBuffer);
 }
 
 static void CreatePokedexList(u8 dexMode, u8 order)
@@ -3181,10 +3186,10 @@ static u8 LoadInfoScreen(struct PokedexListItem* item, u8 monSpriteId)
     gTasks[taskId].data[5] = 255;
     ResetBgsAndClearDma3BusyFlags(0);
     InitBgsFromTemplates(0, sInfoScreen_BgTemplate, ARRAY_COUNT(sInfoScreen_BgTemplate));
-    SetBgTilemapBuffer(3, AllocZeroed(BG_SCREEN_SIZE));
-    SetBgTilemapBuffer(2, AllocZeroed(BG_SCREEN_SIZE));
-    SetBgTilemapBuffer(1, AllocZeroed(BG_SCREEN_SIZE));
-    SetBgTilemapBuffer(0, AllocZeroed(BG_SCREEN_SIZE));
+    SetBgTilemapBuffer(3, SCENE_ALLOC_ZEROED(SCENE_ARENA_POKEDEX, BG_SCREEN_SIZE));
+    SetBgTilemapBuffer(2, SCENE_ALLOC_ZEROED(SCENE_ARENA_POKEDEX, BG_SCREEN_SIZE));
+    SetBgTilemapBuffer(1, SCENE_ALLOC_ZEROED(SCENE_ARENA_POKEDEX, BG_SCREEN_SIZE));
+    SetBgTilemapBuffer(0, SCENE_ALLOC_ZEROED(SCENE_ARENA_POKEDEX, BG_SCREEN_SIZE));
     InitWindows(sInfoScreen_WindowTemplates);
     DeactivateAllTextPrinters();
 
@@ -3329,16 +3334,16 @@ static void FreeInfoScreenWindowAndBgBuffers(void)
     FreeAllWindowBuffers();
     tilemapBuffer = GetBgTilemapBuffer(0);
     if (tilemapBuffer)
-        Free(tilemapBuffer);
+        SCENE_FREE(SCENE_ARENA_POKEDEX, tilemapBuffer);
     tilemapBuffer = GetBgTilemapBuffer(1);
     if (tilemapBuffer)
-        Free(tilemapBuffer);
+        SCENE_FREE(SCENE_ARENA_POKEDEX, tilemapBuffer);
     tilemapBuffer = GetBgTilemapBuffer(2);
     if (tilemapBuffer)
-        Free(tilemapBuffer);
+        SCENE_FREE(SCENE_ARENA_POKEDEX, tilemapBuffer);
     tilemapBuffer = GetBgTilemapBuffer(3);
     if (tilemapBuffer)
-        Free(tilemapBuffer);
+        SCENE_FREE(SCENE_ARENA_POKEDEX, tilemapBuffer);
 }
 
 static void Task_HandleInfoScreenInput(u8 taskId)
@@ -4807,10 +4812,10 @@ static void Task_LoadSearchMenu(u8 taskId)
             ResetOtherVideoRegisters(0);
             ResetBgsAndClearDma3BusyFlags(0);
             InitBgsFromTemplates(0, sSearchMenu_BgTemplate, ARRAY_COUNT(sSearchMenu_BgTemplate));
-            SetBgTilemapBuffer(3, AllocZeroed(BG_SCREEN_SIZE));
-            SetBgTilemapBuffer(2, AllocZeroed(BG_SCREEN_SIZE));
-            SetBgTilemapBuffer(1, AllocZeroed(BG_SCREEN_SIZE));
-            SetBgTilemapBuffer(0, AllocZeroed(BG_SCREEN_SIZE));
+            SetBgTilemapBuffer(3, SCENE_ALLOC_ZEROED(SCENE_ARENA_POKEDEX, BG_SCREEN_SIZE));
+            SetBgTilemapBuffer(2, SCENE_ALLOC_ZEROED(SCENE_ARENA_POKEDEX, BG_SCREEN_SIZE));
+            SetBgTilemapBuffer(1, SCENE_ALLOC_ZEROED(SCENE_ARENA_POKEDEX, BG_SCREEN_SIZE));
+            SetBgTilemapBuffer(0, SCENE_ALLOC_ZEROED(SCENE_ARENA_POKEDEX, BG_SCREEN_SIZE));
             InitWindows(sSearchMenu_WindowTemplate);
             DeactivateAllTextPrinters();
             PutWindowTilemap(0);
@@ -4871,16 +4876,16 @@ static void FreeSearchWindowAndBgBuffers(void)
     FreeAllWindowBuffers();
     tilemapBuffer = GetBgTilemapBuffer(0);
     if (tilemapBuffer)
-        Free(tilemapBuffer);
+        SCENE_FREE(SCENE_ARENA_POKEDEX, tilemapBuffer);
     tilemapBuffer = GetBgTilemapBuffer(1);
     if (tilemapBuffer)
-        Free(tilemapBuffer);
+        SCENE_FREE(SCENE_ARENA_POKEDEX, tilemapBuffer);
     tilemapBuffer = GetBgTilemapBuffer(2);
     if (tilemapBuffer)
-        Free(tilemapBuffer);
+        SCENE_FREE(SCENE_ARENA_POKEDEX, tilemapBuffer);
     tilemapBuffer = GetBgTilemapBuffer(3);
     if (tilemapBuffer)
-        Free(tilemapBuffer);
+        SCENE_FREE(SCENE_ARENA_POKEDEX, tilemapBuffer);
 }
 
 static void Task_SwitchToSearchMenuTopBar(u8 taskId)
@@ -550,6 +550,10 @@ static u32 sItemIconGfxBuffer[98];
 EWRAM_DATA static u8 sPreviousBoxOption = 0;
 EWRAM_DATA static struct ChooseBoxMenu *sChooseBoxMenu = NULL;
 EWRAM_DATA static struct PokemonStorageSystemData *sStorage = NULL;
+
+// Holds sStorage, sMultiMove (mostly the boxMons it's moving) and
+// sTilemapUtil.
+#define STORAGE_ARENA_SIZE (sizeof(*sStorage) + sizeof(struct BoxPokemon) * IN_BOX_COUNT + 0x100)
 EWRAM_DATA static bool8 sInPartyMenu = 0;
 EWRAM_DATA static u8 sCurrentBoxOption = 0;
 EWRAM_DATA static u8 sDepositBoxId = 0;
@@ -2183,7 +2187,8 @@ static void CB2_PokeStorage(void) {
 static void EnterPokeStorage(u8 boxOption) {
     ResetTasks();
     sCurrentBoxOption = boxOption;
-    sStorage = Alloc(sizeof(*sStorage));
+    SCENE_ARENA_BEGIN(SCENE_ARENA_STORAGE, STORAGE_ARENA_SIZE);
+    sStorage = SCENE_ALLOC(SCENE_ARENA_STORAGE, sizeof(*sStorage));
     if (sStorage == NULL) {
         SetMainCallback2(CB2_ExitPokeStorage);
     } else {
@@ -2199,7 +2204,8 @@ static void EnterPokeStorage(u8 boxOption) {
 
 static void CB2_ReturnToPokeStorage(void) {
     ResetTasks();
-    sStorage = Alloc(sizeof(*sStorage));
+    SCENE_ARENA_BEGIN(SCENE_ARENA_STORAGE, STORAGE_ARENA_SIZE);
+    sStorage = SCENE_ALLOC(SCENE_ARENA_STORAGE, sizeof(*sStorage));
     if (sStorage == NULL) {
         SetMainCallback2(CB2_ExitPokeStorage);
     } else {
@@ -3730,8 +3736,9 @@ static void GiveChosenBagItem(void) {
 static void FreePokeStorageData(void) {
     TilemapUtil_Free();
     MultiMove_Free();
-    FREE_AND_SET_NULL(sStorage);
+    SCENE_FREE_AND_SET_NULL(SCENE_ARENA_STORAGE, sStorage);
     FreeAllWindowBuffers();
+    SCENE_ARENA_END(SCENE_ARENA_STORAGE);
 }
 
 
@@ -7450,7 +7457,7 @@ EWRAM_DATA static struct {
 } *sMultiMove = NULL;
 
 static bool8 MultiMove_Init(void) {
-    sMultiMove = Alloc(sizeof(*sMultiMove));
+    sMultiMove = SCENE_ALLOC(SCENE_ARENA_STORAGE, sizeof(*sMultiMove));
     if (sMultiMove != NULL) {
         sStorage->multiMoveWindowId = AddWindow8Bit(&sWindowTemplate_MultiMove);
         if (sStorage->multiMoveWindowId != WINDOW_NONE) {
@@ -7464,7 +7471,7 @@ static bool8 MultiMove_Init(void) {
 
 static void MultiMove_Free(void) {
     if (sMultiMove != NULL)
-        Free(sMultiMove);
+        SCENE_FREE(SCENE_ARENA_STORAGE, sMultiMove);
 }
 
 static void MultiMove_SetFunction(u8 id) {
@@ -8927,7 +8934,7 @@ EWRAM_DATA static u16 sNumTilemapUtilIds = 0;
 static void TilemapUtil_Init(u8 count) {
     u16 i;
 
-    sTilemapUtil = Alloc(sizeof(*sTilemapUtil) * count);
+    sTilemapUtil = SCENE_ALLOC(SCENE_ARENA_STORAGE, sizeof(*sTilemapUtil) * count);
     sNumTilemapUtilIds = (sTilemapUtil == NULL) ? 0 : count;
     for (i = 0; i < sNumTilemapUtilIds; i++) {
         sTilemapUtil[i].savedTilemap = NULL;
@@ -8936,7 +8943,7 @@ static void TilemapUtil_Init(u8 count) {
 }
 
 static void TilemapUtil_Free(void) {
-    Free(sTilemapUtil);
+    SCENE_FREE(SCENE_ARENA_STORAGE, sTilemapUtil);
 }
 
 // Unused
@@ -183,6 +183,9 @@ static EWRAM_DATA struct PokemonSummaryScreenData {
     s16 switchCounter; // Used for various switch statement cases that decompress/load graphics or pokemon data
     u8 unk_filler4[6];
 } *sMonSummaryScreen = NULL;
+
+// Holds sMonSummaryScreen and the scratch buffers used while drawing.
+#define SUMMARY_ARENA_SIZE (sizeof(*sMonSummaryScreen) + 0x100)
 EWRAM_DATA u8 gLastViewedMonIndex = 0;
 static EWRAM_DATA u8 sMoveSlotToReplace = 0;
 ALIGNED(4) static EWRAM_DATA u8 sAnimDelayTaskId = 0;
@@ -1192,7 +1195,8 @@ static const u16 sSummaryMarkingsPalette[] = INCBIN_U16("graphics/interface/summ
 
 // code
 void ShowPokemonSummaryScreen(u8 mode, void *mons, u8 monIndex, u8 maxMonIndex, void (*callback)(void)) {
-    sMonSummaryScreen = AllocZeroed(sizeof(*sMonSummaryScreen));
+    SCENE_ARENA_BEGIN(SCENE_ARENA_SUMMARY_SCREEN, SUMMARY_ARENA_SIZE);
+    sMonSummaryScreen = SCENE_ALLOC_ZEROED(SCENE_ARENA_SUMMARY_SCREEN, sizeof(*sMonSummaryScreen));
     sMonSummaryScreen->mode = mode;
     sMonSummaryScreen->monList.mons = mons;
     sMonSummaryScreen->curMonIndex = monIndex;
@@ -1573,7 +1577,8 @@ static void SetDefaultTilemaps(void) {
 
 static void FreeSummaryScreen(void) {
     FreeAllWindowBuffers();
-    Free(sMonSummaryScreen);
+    SCENE_FREE(SCENE_ARENA_SUMMARY_SCREEN, sMonSummaryScreen);
+    SCENE_ARENA_END(SCENE_ARENA_SUMMARY_SCREEN);
 }
 
 static void BeginCloseSummaryScreen(u8 taskId) {
@@ -2294,7 +2299,7 @@ u8 GetMoveSlotToReplace(void) {
 
 static void DrawPagination(void) // Updates the pagination dots at the top of the summary screen
 {
-    u16 *alloced = Alloc(32);
+    u16 *alloced = SCENE_ALLOC(SCENE_ARENA_SUMMARY_SCREEN, 32);
     u8 i;
 
     for (i = 0; i < 4; i++) {
@@ -2341,12 +2346,12 @@ static void DrawPagination(void) // Updates the pagination dots at the top of th
     }
     CopyToBgTilemapBufferRect_ChangePalette(3, alloced, 11, 0, 8, 2, 16);
     ScheduleBgCopyTilemapToVram(3);
-    Free(alloced);
+    SCENE_FREE(SCENE_ARENA_SUMMARY_SCREEN, alloced);
 }
 
 static void ChangeTilemap(const struct TilemapCtrl *unkStruct, u16 *dest, u8 c, bool8 d) {
     u16 i;
-    u16 *alloced = Alloc(unkStruct->field_6 * 2 * unkStruct->field_7);
+    u16 *alloced = SCENE_ALLOC(SCENE_ARENA_SUMMARY_SCREEN, unkStruct->field_6 * 2 * unkStruct->field_7);
     CpuFill16(unkStruct->field_4, alloced, unkStruct->field_6 * 2 * unkStruct->field_7);
     if (unkStruct->field_6 != c) {
         if (!d) {
@@ -2364,7 +2369,7 @@ static void ChangeTilemap(const struct TilemapCtrl *unkStruct, u16 *dest, u8 c,
         CpuCopy16(&alloced[unkStruct->field_6 * i], &dest[(unkStruct->field_9 + i) * 32 + unkStruct->field_8],
                   unkStruct->field_6 * 2);
 
-    Free(alloced);
+    SCENE_FREE(SCENE_ARENA_SUMMARY_SCREEN, alloced);
 }
 
 static void HandlePowerAccTilemap(u16 a, s16 b) {
@@ -2960,8 +2965,8 @@ static void BufferMonTrainerMemo(void) {
     if (InBattleFactory() == TRUE || InSlateportBattleTent() == TRUE || IsInGamePartnerMon() == TRUE) {
         DynamicPlaceholderTextUtil_ExpandPlaceholders(gStringVar4, gText_XNature);
     } else {
-        u8 *metLevelString = Alloc(32);
-        u8 *metLocationString = Alloc(32);
+        u8 *metLevelString = SCENE_ALLOC(SCENE_ARENA_SUMMARY_SCREEN, 32);
+        u8 *metLocationString = SCENE_ALLOC(SCENE_ARENA_SUMMARY_SCREEN, 32);
         GetMetLevelString(metLevelString);
 
         if (sum->metLocation < MAPSEC_NONE) {
@@ -2983,8 +2988,8 @@ static void BufferMonTrainerMemo(void) {
         }
 
         DynamicPlaceholderTextUtil_ExpandPlaceholders(gStringVar4, text);
-        Free(metLevelString);
-        Free(metLocationString);
+        SCENE_FREE(SCENE_ARENA_SUMMARY_SCREEN, metLevelString);
+        SCENE_FREE(SCENE_ARENA_SUMMARY_SCREEN, metLocationString);
     }
 }
 
@@ -3187,7 +3192,7 @@ static void PrintRibbonCount(void) {
 
 static void BufferIvOrEvStats(u8 mode) {
     u16 hp, hp2, atk, def, spA, spD, spe, died;
-    u8 *currHPString = Alloc(20);
+    u8 *currHPString = SCENE_ALLOC(SCENE_ARENA_SUMMARY_SCREEN, 20);
     const s8 *natureMod = gNatureStatTable[sMonSummaryScreen->summary.nature];
 
     switch (mode) {
@@ -3275,14 +3280,14 @@ static void BufferIvOrEvStats(u8 mode) {
             break;
     }
 
-    Free(currHPString);
+    SCENE_FREE(SCENE_ARENA_SUMMARY_SCREEN, currHPString);
 }
 
 static void BufferLeftColumnStats(void) {
-    u8 *currentHPString = Alloc(8);
-    u8 *maxHPString = Alloc(8);
-    u8 *attackString = Alloc(8);
-    u8 *defenseString = Alloc(8);
+    u8 *currentHPString = SCENE_ALLOC(SCENE_ARENA_SUMMARY_SCREEN, 8);
+    u8 *maxHPString = SCENE_ALLOC(SCENE_ARENA_SUMMARY_SCREEN, 8);
+    u8 *attackString = SCENE_ALLOC(SCENE_ARENA_SUMMARY_SCREEN, 8);
+    u8 *defenseString = SCENE_ALLOC(SCENE_ARENA_SUMMARY_SCREEN, 8);
 
     ConvertIntToDecimalStringN(currentHPString, sMonSummaryScreen->summary.currentHP, STR_CONV_MODE_RIGHT_ALIGN, 3);
     ConvertIntToDecimalStringN(maxHPString, sMonSummaryScreen->summary.maxHP, STR_CONV_MODE_RIGHT_ALIGN, 3);
@@ -3296,10 +3301,10 @@ static void BufferLeftColumnStats(void) {
     DynamicPlaceholderTextUtil_SetPlaceholderPtr(3, defenseString);
     DynamicPlaceholderTextUtil_ExpandPlaceholders(gStringVar4, sStatsLeftColumnLayout);
 
-    Free(currentHPString);
-    Free(maxHPString);
-    Free(attackString);
-    Free(defenseString);
+    SCENE_FREE(SCENE_ARENA_SUMMARY_SCREEN, currentHPString);
+    SCENE_FREE(SCENE_ARENA_SUMMARY_SCREEN, maxHPString);
+    SCENE_FREE(SCENE_ARENA_SUMMARY_SCREEN, attackString);
+    SCENE_FREE(SCENE_ARENA_SUMMARY_SCREEN, defenseString);
 }
 
 static void PrintLeftColumnStats(void) {
@@ -1,8 +1,25 @@
 #include "global.h"
 #include "task.h"
+#include "cycle_timer.h"
 
 struct Task gTasks[NUM_TASKS];
 
+#ifdef TASK_PRIORITY_BUCKETS
+// Bit n is set while task n is active.
+static u16 sActiveTasks;
+static u8 sFirstTaskId;
+
+// The last task in the list with each priority in use, so a new task can
+// be linked in after the last one with the same or a lower priority.
+static u32 sUsedPriorities[256 / 32];
+EWRAM_DATA static u8 sLastTaskWithPriority[256] = {0};
+#endif
+
+#ifdef TASK_CYCLE_COUNTS
+EWRAM_DATA struct TaskCycleCounts gTaskCycleCounts[NUM_TASKS] = {0};
+EWRAM_DATA u32 gRunTasksCycles = 0;
+#endif
+
 static void InsertTask(u8 newTaskId);
 static u8 FindFirstActiveTask(void);
 
@@ -22,8 +39,131 @@ void ResetTasks(void)
 
     gTasks[0].prev = HEAD_SENTINEL;
     gTasks[NUM_TASKS - 1].next = TAIL_SENTINEL;
+
+#ifdef TASK_PRIORITY_BUCKETS
+    sActiveTasks = 0;
+    sFirstTaskId = TAIL_SENTINEL;
+    for (i = 0; i < ARRAY_COUNT(sUsedPriorities); i++)
+        sUsedPriorities[i] = 0;
+#endif
+}
+
+#ifdef TASK_PRIORITY_BUCKETS
+static u32 HighestSetBit(u32 bits)
+{
+    u32 bit = 0;
+
+    if (bits >> 16)
+    {
+        bits >>= 16;
+        bit += 16;
+    }
+    if (bits >> 8)
+    {
+        bits >>= 8;
+        bit += 8;
+    }
+    if (bits >> 4)
+    {
+        bits >>= 4;
+        bit += 4;
+    }
+    if (bits >> 2)
+    {
+        bits >>= 2;
+        bit += 2;
+    }
+    if (bits >> 1)
+        bit += 1;
+
+    return bit;
 }
 
+u8 CreateTask(TaskFunc func, u8 priority)
+{
+    u8 i;
+
+    if (sActiveTasks == (1 << NUM_TASKS) - 1)
+        return 0;
+
+    // The lowest clear bit, as the first inactive task.
+    i = HighestSetBit(~sActiveTasks & (sActiveTasks + 1));
+    gTasks[i].func = func;
+    gTasks[i].priority = priority;
+    InsertTask(i);
+    memset(gTasks[i].data, 0, sizeof(gTasks[i].data));
+    gTasks[i].isActive = TRUE;
+    sActiveTasks |= 1 << i;
+#ifdef TASK_CYCLE_COUNTS
+    gTaskCycleCounts[i].peakCycles = 0;
+#endif
+    return i;
+}
+
+// Returns the last task with a priority no higher than the given one, or
+// HEAD_SENTINEL if there's none.
+static u8 FindLastTaskUpToPriority(u8 priority)
+{
+    s32 word = priority / 32;
+    u32 bits = sUsedPriorities[word] & (0xFFFFFFFF >> (31 - priority % 32));
+
+    while (bits == 0)
+    {
+        if (--word < 0)
+            return HEAD_SENTINEL;
+        bits = sUsedPriorities[word];
+    }
+
+    return sLastTaskWithPriority[word * 32 + HighestSetBit(bits)];
+}
+
+static void InsertTask(u8 newTaskId)
+{
+    u8 priority = gTasks[newTaskId].priority;
+    u8 taskId = FindLastTaskUpToPriority(priority);
+
+    if (taskId == HEAD_SENTINEL)
+    {
+        // Every other task has a higher priority value, or there are none.
+        gTasks[newTaskId].prev = HEAD_SENTINEL;
+        gTasks[newTaskId].next = sFirstTaskId;
+        if (sFirstTaskId != TAIL_SENTINEL)
+            gTasks[sFirstTaskId].prev = newTaskId;
+        sFirstTaskId = newTaskId;
+    }
+    else
+    {
+        gTasks[newTaskId].prev = taskId;
+        gTasks[newTaskId].next = gTasks[taskId].next;
+        if (gTasks[taskId].next != TAIL_SENTINEL)
+            gTasks[gTasks[taskId].next].prev = newTaskId;
+        gTasks[taskId].next = newTaskId;
+    }
+
+    sLastTaskWithPriority[priority] = newTaskId;
+    sUsedPriorities[priority / 32] |= 1 << (priority % 32);
+}
+
+// Unlinks a task that's being destroyed from sFirstTaskId and its priority.
+static void RemoveTaskFromBuckets(u8 taskId)
+{
+    u8 priority = gTasks[taskId].priority;
+    u8 prevTaskId = gTasks[taskId].prev;
+
+    sActiveTasks &= ~(1 << taskId);
+
+    if (prevTaskId == HEAD_SENTINEL)
+        sFirstTaskId = gTasks[taskId].next;
+
+    if (sLastTaskWithPriority[priority] == taskId)
+    {
+        if (prevTaskId != HEAD_SENTINEL && gTasks[prevTaskId].priority == priority)
+            sLastTaskWithPriority[priority] = prevTaskId;
+        else
+            sUsedPriorities[priority / 32] &= ~(1 << (priority % 32));
+    }
+}
+#else
 u8 CreateTask(TaskFunc func, u8 priority)
 {
     u8 i;
@@ -37,6 +177,9 @@ u8 CreateTask(TaskFunc func, u8 priority)
             InsertTask(i);
             memset(gTasks[i].data, 0, sizeof(gTasks[i].data));
             gTasks[i].isActive = TRUE;
+#ifdef TASK_CYCLE_COUNTS
+            gTaskCycleCounts[i].peakCycles = 0;
+#endif
             return i;
         }
     }
@@ -80,12 +223,16 @@ static void InsertTask(u8 newTaskId)
         taskId = gTasks[taskId].next;
     }
 }
+#endif // TASK_PRIORITY_BUCKETS
 
 void DestroyTask(u8 taskId)
 {
     if (gTasks[taskId].isActive)
     {
         gTasks[taskId].isActive = FALSE;
+#ifdef TASK_PRIORITY_BUCKETS
+        RemoveTaskFromBuckets(taskId);
+#endif
 
         if (gTasks[taskId].prev == HEAD_SENTINEL)
         {
@@ -107,15 +254,49 @@ void DestroyTask(u8 taskId)
     }
 }
 
+#ifdef TASK_CYCLE_COUNTS
+// Times each task with timer 2. It counts in steps of 64 cycles so a task
+// that runs for several frames, like a big graphics load, doesn't wrap it.
+// Interrupts taken while a task runs count towards it.
+static void RunTaskAndCountCycles(u8 taskId)
+{
+    TaskFunc func = gTasks[taskId].func;
+    u32 cycles;
+
+    CYCLE_TIMER_START(TIMER_64CLK);
+    func(taskId);
+    cycles = CYCLE_TIMER_READ() * 64;
+    CYCLE_TIMER_STOP();
+
+    gTaskCycleCounts[taskId].func = func;
+    gTaskCycleCounts[taskId].cycles = cycles;
+    if (cycles > gTaskCycleCounts[taskId].peakCycles)
+        gTaskCycleCounts[taskId].peakCycles = cycles;
+    gRunTasksCycles += cycles;
+}
+#endif
+
 void RunTasks(void)
 {
     u8 taskId = FindFirstActiveTask();
 
+#ifdef TASK_CYCLE_COUNTS
+    u8 i;
+
+    for (i = 0; i < NUM_TASKS; i++)
+        gTaskCycleCounts[i].cycles = 0;
+    gRunTasksCycles = 0;
+#endif
+
     if (taskId != NUM_TASKS)
     {
         do
         {
+#ifdef TASK_CYCLE_COUNTS
+            RunTaskAndCountCycles(taskId);
+#else
             gTasks[taskId].func(taskId);
+#endif
             taskId = gTasks[taskId].next;
         } while (taskId != TAIL_SENTINEL);
     }
@@ -123,6 +304,12 @@ void RunTasks(void)
 
 static u8 FindFirstActiveTask(void)
 {
+#ifdef TASK_PRIORITY_BUCKETS
+    if (sFirstTaskId == TAIL_SENTINEL)
+        return NUM_TASKS;
+
+    return sFirstTaskId;
+#else
     u8 taskId;
 
     for (taskId = 0; taskId < NUM_TASKS; taskId++)
@@ -130,6 +317,7 @@ static u8 FindFirstActiveTask(void)
             break;
 
     return taskId;
+#endif
 }
 
 void TaskDummy(u8 taskId)
@@ -155,10 +343,18 @@ void SwitchTaskToFollowupFunc(u8 taskId)
 bool8 FuncIsActiveTask(TaskFunc func)
 {
     u8 i;
+#ifdef TASK_PRIORITY_BUCKETS
+    u32 tasks;
+
+    for (i = 0, tasks = sActiveTasks; tasks != 0; i++, tasks >>= 1)
+        if ((tasks & 1) && gTasks[i].func == func)
+            return TRUE;
+#else
 
     for (i = 0; i < NUM_TASKS; i++)
         if (gTasks[i].isActive == TRUE && gTasks[i].func == func)
             return TRUE;
+#endif
 
     return FALSE;
 }
@@ -166,22 +362,39 @@ bool8 FuncIsActiveTask(TaskFunc func)
 u8 FindTaskIdByFunc(TaskFunc func)
 {
     s32 i;
+#ifdef TASK_PRIORITY_BUCKETS
+    u32 tasks;
+
+    for (i = 0, tasks = sActiveTasks; tasks != 0; i++, tasks >>= 1)
+        if ((tasks & 1) && gTasks[i].func == func)
+            return (u8)i;
+#else
 
     for (i = 0; i < NUM_TASKS; i++)
         if (gTasks[i].isActive == TRUE && gTasks[i].func == func)
             return (u8)i;
+#endif
 
     return TASK_NONE; // No task was found.
 }
 
 u8 GetTaskCount(void)
 {
+#ifndef TASK_PRIORITY_BUCKETS
     u8 i;
+#endif
     u8 count = 0;
+#ifdef TASK_PRIORITY_BUCKETS
+    u32 tasks;
+
+    for (tasks = sActiveTasks; tasks != 0; tasks &= tasks - 1)
+        count++;
+#else
 
     for (i = 0; i < NUM_TASKS; i++)
         if (gTasks[i].isActive == TRUE)
             count++;
+#endif
 
     return count;
 }
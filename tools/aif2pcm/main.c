@@ -18,12 +18,18 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <limits.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
 
 /* extended.c */
 void ieee754_write_extended (double, uint8_t*);
@@ -461,14 +467,136 @@ int get_delta_index(uint8_t sample, uint8_t prev_sample)
 	return best_index;
 }
 
-struct Bytes *delta_compress(struct Bytes *pcm)
+// get_delta_index for every (prev_sample, sample) pair, so the greedy encoder
+// is a single lookup per sample. Filled in by init_delta_index_table.
+static uint8_t sDeltaIndexTable[256][256];
+static pthread_once_t sDeltaIndexTableOnce = PTHREAD_ONCE_INIT;
+
+static void init_delta_index_table(void)
+{
+	for (int prev_sample = 0; prev_sample < 256; prev_sample++)
+	{
+		for (int sample = 0; sample < 256; sample++)
+		{
+			sDeltaIndexTable[prev_sample][sample] = get_delta_index(sample, prev_sample);
+		}
+	}
+}
+
+// Picks the deltas for one block greedily: each sample gets the closest delta
+// in the direction the waveform is heading, given the previous decoded value.
+void choose_block_deltas_greedy(const uint8_t *samples, int count, uint8_t *indices)
+{
+	uint8_t base = samples[0];
+
+	pthread_once(&sDeltaIndexTableOnce, init_delta_index_table);
+
+	for (int i = 1; i < count; i++)
+	{
+		indices[i] = sDeltaIndexTable[base][samples[i]];
+		base += gDeltaEncodingTable[indices[i]];
+	}
+}
+
+#define DELTA_BLOCK_SIZE 64
+#define NUM_DELTA_STATES 256
+
+// Picks the deltas for one block that minimize the block's total squared
+// error. The decoder's only state is the current 8-bit value, so this is a
+// Viterbi search over the 256 values with the 16 deltas as transitions. Every
+// path the greedy encoder can take is considered, so it never does worse.
+void choose_block_deltas_optimal(const uint8_t *samples, int count, uint8_t *indices)
+{
+	uint32_t costs[2][NUM_DELTA_STATES];
+	uint8_t choices[DELTA_BLOCK_SIZE][NUM_DELTA_STATES];
+	uint32_t *cost = costs[0];
+	uint32_t *next_cost = costs[1];
+
+	// The greedy path's error bounds the optimal one, and errors only add
+	// up, so any partial path that is already worse can be dropped. Most
+	// blocks are close to greedy, which leaves only a handful of states.
+	choose_block_deltas_greedy(samples, count, indices);
+
+	uint32_t bound = 0;
+	uint8_t base = samples[0];
+
+	for (int i = 1; i < count; i++)
+	{
+		base += gDeltaEncodingTable[indices[i]];
+		int error = U8_TO_S8(base) - U8_TO_S8(samples[i]);
+		bound += error * error;
+	}
+
+	for (int state = 0; state < NUM_DELTA_STATES; state++)
+	{
+		cost[state] = UINT32_MAX;
+	}
+	cost[samples[0]] = 0;
+
+	for (int i = 1; i < count; i++)
+	{
+		int sample_signed = U8_TO_S8(samples[i]);
+
+		for (int state = 0; state < NUM_DELTA_STATES; state++)
+		{
+			next_cost[state] = UINT32_MAX;
+		}
+
+		for (int state = 0; state < NUM_DELTA_STATES; state++)
+		{
+			if (cost[state] == UINT32_MAX)
+			{
+				continue;
+			}
+
+			for (int d = 0; d < 16; d++)
+			{
+				uint8_t new_sample = state + gDeltaEncodingTable[d];
+				int error = U8_TO_S8(new_sample) - sample_signed;
+				uint32_t new_cost = cost[state] + error * error;
+
+				if (new_cost <= bound && new_cost < next_cost[new_sample])
+				{
+					next_cost[new_sample] = new_cost;
+					choices[i][new_sample] = d;
+				}
+			}
+		}
+
+		uint32_t *temp = cost;
+		cost = next_cost;
+		next_cost = temp;
+	}
+
+	int best_state = 0;
+
+	for (int state = 1; state < NUM_DELTA_STATES; state++)
+	{
+		if (cost[state] < cost[best_state])
+		{
+			best_state = state;
+		}
+	}
+
+	uint8_t state = best_state;
+
+	for (int i = count - 1; i >= 1; i--)
+	{
+		indices[i] = choices[i][state];
+		state -= gDeltaEncodingTable[indices[i]];
+	}
+}
+
+// Each block of 64 samples starts with a raw sample, followed by one byte
+// holding the first delta and then two deltas per byte, high nibble first.
+struct Bytes *delta_compress(struct Bytes *pcm, bool optimal)
 {
 	struct Bytes *delta = malloc(sizeof(struct Bytes));
 	// estimate the length so we can malloc
-	int num_blocks = pcm->length / 64;
+	int num_blocks = pcm->length / DELTA_BLOCK_SIZE;
 	delta->length = num_blocks * 33;
 
-	int extra = pcm->length % 64;
+	int extra = pcm->length % DELTA_BLOCK_SIZE;
 	if (extra)
 	{
 		delta->length += 1;
@@ -488,41 +616,46 @@ struct Bytes *delta_compress(struct Bytes *pcm)
 
 	unsigned int i = 0;
 	unsigned int j = 0;
-	int k;
-	uint8_t base;
-	int delta_index;
+	uint8_t indices[DELTA_BLOCK_SIZE];
 
 	while (i < pcm->length)
 	{
-		base = pcm->data[i++];
-		delta->data[j++] = base;
+		int count = pcm->length - i;
+		if (count > DELTA_BLOCK_SIZE)
+		{
+			count = DELTA_BLOCK_SIZE;
+		}
 
-		if (i >= pcm->length)
+		// A delta left over for the high nibble of a final, half-filled byte
+		// has never been written out, so don't spend any effort on it.
+		int encoded = count;
+		if (encoded > 2 && (encoded & 1))
 		{
-			break;
+			encoded--;
 		}
-		delta_index = get_delta_index(pcm->data[i++], base);
-		base += gDeltaEncodingTable[delta_index];
-		delta->data[j++] = delta_index;
 
-		for (k = 0; k < 31; k++)
+		if (optimal)
 		{
-			if (i >= pcm->length)
-			{
-				break;
-			}
-			delta_index = get_delta_index(pcm->data[i++], base);
-			base += gDeltaEncodingTable[delta_index];
-			delta->data[j] = (delta_index << 4);
+			choose_block_deltas_optimal(&pcm->data[i], encoded, indices);
+		}
+		else
+		{
+			choose_block_deltas_greedy(&pcm->data[i], encoded, indices);
+		}
 
-			if (i >= pcm->length)
-			{
-				break;
-			}
-			delta_index = get_delta_index(pcm->data[i++], base);
-			base += gDeltaEncodingTable[delta_index];
-			delta->data[j++] |= delta_index;
+		delta->data[j++] = pcm->data[i];
+
+		if (encoded > 1)
+		{
+			delta->data[j++] = indices[1];
+		}
+
+		for (int k = 2; k < encoded; k += 2)
+		{
+			delta->data[j++] = (indices[k] << 4) | indices[k + 1];
 		}
+
+		i += count;
 	}
 
 	delta->length = j;
@@ -546,8 +679,34 @@ do { \
 	(var) |= (*((src) + 3) << 24); \
 } while (0)
 
+// What converting one .aif cost and, if it was compressed, how much signal
+// survived. Filled in by aif2pcm for the batch report.
+struct ConvertStats {
+	unsigned long num_samples;
+	double signal_energy;
+	double noise_energy;
+};
+
+// Measures the error introduced by compressing samples into delta.
+void measure_compression(struct Bytes *samples, struct Bytes *delta, struct ConvertStats *stats)
+{
+	struct Bytes *decoded = delta_decompress(delta, samples->length);
+
+	for (unsigned long i = 0; i < decoded->length; i++)
+	{
+		int original = U8_TO_S8(samples->data[i]);
+		int error = U8_TO_S8(decoded->data[i]) - original;
+		stats->signal_energy += original * original;
+		stats->noise_energy += error * error;
+	}
+
+	free(decoded->data);
+	free(decoded);
+}
+
 // Reads an .aif file and produces a .pcm file containing an array of 8-bit samples.
-void aif2pcm(const char *aif_filename, const char *pcm_filename, bool compress)
+// If stats is not NULL, it is filled in for the conversion.
+void aif2pcm(const char *aif_filename, const char *pcm_filename, bool compress, bool optimal, struct ConvertStats *stats)
 {
 	struct Bytes *aif = read_bytearray(aif_filename);
 	AifData aif_data = {0,0,0,0,0,0,0};
@@ -562,7 +721,11 @@ void aif2pcm(const char *aif_filename, const char *pcm_filename, bool compress)
 		struct Bytes *input = malloc(sizeof(struct Bytes));
 		input->data = aif_data.samples;
 		input->length = aif_data.real_num_samples;
-		pcm = delta_compress(input);
+		pcm = delta_compress(input, optimal);
+		if (stats)
+		{
+			measure_compression(input, pcm, stats);
+		}
 		free(input);
 	}
 	else
@@ -587,6 +750,15 @@ void aif2pcm(const char *aif_filename, const char *pcm_filename, bool compress)
 	memcpy(&output.data[header_size], pcm->data, pcm->length);
 	write_bytearray(pcm_filename, &output);
 
+	if (stats)
+	{
+		stats->num_samples = aif_data.real_num_samples;
+	}
+
+	if (compress)
+	{
+		free(pcm->data);
+	}
 	free(aif->data);
 	free(aif);
 	free(pcm);
@@ -847,21 +1019,18 @@ void pcm2aif(const char *pcm_filename, const char *aif_filename, uint32_t base_n
 void usage(void)
 {
 	fprintf(stderr, "Usage: aif2pcm bin_file [aif_file]\n");
-	fprintf(stderr, "       aif2pcm aif_file [bin_file] [--compress]\n");
+	fprintf(stderr, "       aif2pcm aif_file [bin_file] [--compress] [--optimal]\n");
+	fprintf(stderr, "       aif2pcm batch [-j threads] [-v] manifest_file\n");
 }
 
-int main(int argc, char **argv)
+// Runs one conversion given the arguments of a normal aif2pcm invocation.
+void run_command(int argc, char **argv, struct ConvertStats *stats)
 {
-	if (argc < 2)
-	{
-		usage();
-		exit(1);
-	}
-
 	char *input_file = argv[1];
 	char *extension = get_file_extension(input_file);
 	char *output_file;
 	bool compressed = false;
+	bool optimal = false;
 
 	if (argc > 3)
 	{
@@ -871,20 +1040,30 @@ int main(int argc, char **argv)
 			{
 				compressed = true;
 			}
+			else if (strcmp(argv[i], "--optimal") == 0)
+			{
+				compressed = true;
+				optimal = true;
+			}
 		}
 	}
 
+	if (!extension)
+	{
+		FATAL_ERROR("Input file must be .aif or .bin: '%s'\n", input_file);
+	}
+
 	if (strcmp(extension, "aif") == 0 || strcmp(extension, "aiff") == 0)
 	{
 		if (argc >= 3)
 		{
 			output_file = argv[2];
-			aif2pcm(input_file, output_file, compressed);
+			aif2pcm(input_file, output_file, compressed, optimal, stats);
 		}
 		else
 		{
 			output_file = new_file_extension(input_file, "bin");
-			aif2pcm(input_file, output_file, compressed);
+			aif2pcm(input_file, output_file, compressed, optimal, stats);
 			free(output_file);
 		}
 	}
@@ -906,6 +1085,250 @@ int main(int argc, char **argv)
 	{
 		FATAL_ERROR("Input file must be .aif or .bin: '%s'\n", input_file);
 	}
+}
+
+// A batch manifest has one conversion per line, written exactly like the
+// arguments to a normal aif2pcm invocation:
+//
+//   sound/direct_sound_samples/cries/abra.aif sound/direct_sound_samples/cries/abra.bin --compress
+//
+// Blank lines and lines starting with '#' are ignored.
+
+#define MAX_JOB_ARGS 8
+
+struct BatchJob {
+	int argc;
+	char *argv[MAX_JOB_ARGS];
+	struct ConvertStats stats;
+};
+
+struct BatchQueue {
+	struct BatchJob *jobs;
+	int count;
+	int next;
+	pthread_mutex_t mutex;
+};
+
+struct BatchJob *read_manifest(const char *filename, int *count)
+{
+	struct Bytes *manifest = read_bytearray(filename);
+	int capacity = 64;
+	struct BatchJob *jobs = malloc(capacity * sizeof(struct BatchJob));
+	*count = 0;
+
+	// The tokens point into the manifest's buffer, which is kept for the
+	// rest of the run.
+	char *text = realloc(manifest->data, manifest->length + 1);
+	text[manifest->length] = 0;
+	free(manifest);
+
+	for (char *line = strtok(text, "\r\n"); line; line = strtok(NULL, "\r\n"))
+	{
+		while (*line == ' ' || *line == '\t')
+		{
+			line++;
+		}
+		if (*line == 0 || *line == '#')
+		{
+			continue;
+		}
+
+		if (*count == capacity)
+		{
+			capacity *= 2;
+			jobs = realloc(jobs, capacity * sizeof(struct BatchJob));
+		}
+
+		struct BatchJob *job = &jobs[(*count)++];
+		memset(job, 0, sizeof(struct BatchJob));
+		job->argv[job->argc++] = "aif2pcm";
+
+		char *s = line;
+		while (*s)
+		{
+			if (*s == ' ' || *s == '\t')
+			{
+				*s++ = 0;
+				continue;
+			}
+			if (job->argc == MAX_JOB_ARGS)
+			{
+				FATAL_ERROR("Too many arguments in manifest line for '%s'\n", job->argv[1]);
+			}
+			job->argv[job->argc++] = s;
+			while (*s && *s != ' ' && *s != '\t')
+			{
+				s++;
+			}
+		}
+	}
+
+	return jobs;
+}
+
+void *batch_worker(void *arg)
+{
+	struct BatchQueue *queue = arg;
+
+	for (;;)
+	{
+		pthread_mutex_lock(&queue->mutex);
+		int index = queue->next++;
+		pthread_mutex_unlock(&queue->mutex);
+
+		if (index >= queue->count)
+		{
+			break;
+		}
+
+		struct BatchJob *job = &queue->jobs[index];
+		run_command(job->argc, job->argv, &job->stats);
+	}
+
+	return NULL;
+}
+
+double snr_db(double signal_energy, double noise_energy)
+{
+	if (noise_energy == 0)
+	{
+		return INFINITY;
+	}
+	return 10 * log10(signal_energy / noise_energy);
+}
+
+// Usage: aif2pcm batch [-j threads] [-v] manifest_file
+// Runs every conversion in the manifest on a pool of threads and reports the
+// throughput and, for the compressed samples, the signal-to-noise ratio.
+void run_batch(int argc, char **argv)
+{
+	long num_threads = sysconf(_SC_NPROCESSORS_ONLN);
+	bool verbose = false;
+	char *manifest_file = NULL;
+
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-j") == 0)
+		{
+			if (i + 1 >= argc)
+			{
+				FATAL_ERROR("No thread count following \"-j\".\n");
+			}
+			num_threads = strtol(argv[++i], NULL, 10);
+		}
+		else if (strcmp(argv[i], "-v") == 0)
+		{
+			verbose = true;
+		}
+		else if (argv[i][0] == '-' || manifest_file)
+		{
+			FATAL_ERROR("Unrecognized option \"%s\".\n", argv[i]);
+		}
+		else
+		{
+			manifest_file = argv[i];
+		}
+	}
+
+	if (!manifest_file)
+	{
+		usage();
+		exit(1);
+	}
+	if (num_threads < 1)
+	{
+		num_threads = 1;
+	}
+
+	struct BatchQueue queue;
+	queue.jobs = read_manifest(manifest_file, &queue.count);
+	queue.next = 0;
+	pthread_mutex_init(&queue.mutex, NULL);
+
+	if (num_threads > queue.count)
+	{
+		num_threads = queue.count > 0 ? queue.count : 1;
+	}
+
+	struct timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	pthread_t *threads = malloc(num_threads * sizeof(pthread_t));
+	for (long i = 0; i < num_threads; i++)
+	{
+		if (pthread_create(&threads[i], NULL, batch_worker, &queue) != 0)
+		{
+			FATAL_ERROR("Failed to create thread.\n");
+		}
+	}
+	for (long i = 0; i < num_threads; i++)
+	{
+		pthread_join(threads[i], NULL);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+	unsigned long total_samples = 0;
+	double signal_energy = 0;
+	double noise_energy = 0;
+	double worst_snr = INFINITY;
+	const char *worst_file = "none";
+	int num_compressed = 0;
+
+	for (int i = 0; i < queue.count; i++)
+	{
+		struct BatchJob *job = &queue.jobs[i];
+		total_samples += job->stats.num_samples;
+
+		if (job->stats.signal_energy == 0 && job->stats.noise_energy == 0)
+		{
+			continue;
+		}
+
+		double snr = snr_db(job->stats.signal_energy, job->stats.noise_energy);
+		if (verbose)
+		{
+			printf("%s: %lu samples, SNR %.2f dB\n", job->argv[1], job->stats.num_samples, snr);
+		}
+		if (num_compressed == 0 || snr < worst_snr)
+		{
+			worst_snr = snr;
+			worst_file = job->argv[1];
+		}
+		signal_energy += job->stats.signal_energy;
+		noise_energy += job->stats.noise_energy;
+		num_compressed++;
+	}
+
+	printf("%d files, %lu samples in %.3f s (%.2f Msamples/s) on %ld threads\n",
+	       queue.count, total_samples, seconds, seconds > 0 ? total_samples / seconds / 1e6 : 0.0, num_threads);
+	if (num_compressed)
+	{
+		printf("%d compressed: SNR %.2f dB overall, worst %.2f dB (%s)\n",
+		       num_compressed, snr_db(signal_energy, noise_energy), worst_snr, worst_file);
+	}
+
+	pthread_mutex_destroy(&queue.mutex);
+	free(threads);
+}
+
+int main(int argc, char **argv)
+{
+	if (argc < 2)
+	{
+		usage();
+		exit(1);
+	}
+
+	if (strcmp(argv[1], "batch") == 0)
+	{
+		run_batch(argc, argv);
+	}
+	else
+	{
+		run_command(argc, argv, NULL);
+	}
 
 	return 0;
 }
@@ -0,0 +1,661 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+// buildcache is a content-addressed cache for recipes that make exactly one
+// file, their target, from their prerequisites. It runs as make's SHELL for
+// those rules. A recipe line's key is a SHA-256 of:
+//
+// - the command line, after make has expanded it
+// - the path and contents of every prerequisite ($^)
+// - the contents of every other file the command line names, which covers
+//   tools such as tools/gbagfx/gbagfx and inputs such as charmap.txt
+// - the contents of every program it runs from PATH, such as the assembler
+//
+// If the cache has an entry for the key, the target is restored from it and
+// the command doesn't run. Otherwise the command runs, and if it succeeds
+// and changed the target, the target is stored under the key. Output the
+// command printed is not stored, so warnings only show on a miss.
+//
+// -i names a file that the command line mentions but that doesn't affect the
+// target, such as a log the command appends to, so it isn't hashed.
+
+static const char *const USAGE =
+    "Usage: buildcache shell [-i FILE]... DIR TARGET [PREREQ...] -- SHELL ARGS...\n"
+    "       buildcache stats DIR\n";
+
+#define KEY_VERSION "buildcache 1"
+
+struct Sha256
+{
+    uint32_t state[8];
+    uint64_t length;
+    unsigned char block[64];
+    int blockSize;
+};
+
+static const uint32_t sSha256K[64] =
+{
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+};
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void Sha256Init(struct Sha256 *sha)
+{
+    static const uint32_t initialState[8] =
+    {
+        0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+    };
+
+    memcpy(sha->state, initialState, sizeof(initialState));
+    sha->length = 0;
+    sha->blockSize = 0;
+}
+
+static void Sha256Block(struct Sha256 *sha, const unsigned char *block)
+{
+    uint32_t w[64];
+
+    for (int i = 0; i < 16; i++)
+        w[i] = (uint32_t)block[i * 4] << 24 | (uint32_t)block[i * 4 + 1] << 16 | (uint32_t)block[i * 4 + 2] << 8 | block[i * 4 + 3];
+
+    for (int i = 16; i < 64; i++)
+    {
+        uint32_t s0 = ROTR(w[i - 15], 7) ^ ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = ROTR(w[i - 2], 17) ^ ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = sha->state[0], b = sha->state[1], c = sha->state[2], d = sha->state[3];
+    uint32_t e = sha->state[4], f = sha->state[5], g = sha->state[6], h = sha->state[7];
+
+    for (int i = 0; i < 64; i++)
+    {
+        uint32_t t1 = h + (ROTR(e, 6) ^ ROTR(e, 11) ^ ROTR(e, 25)) + ((e & f) ^ (~e & g)) + sSha256K[i] + w[i];
+        uint32_t t2 = (ROTR(a, 2) ^ ROTR(a, 13) ^ ROTR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    sha->state[0] += a;
+    sha->state[1] += b;
+    sha->state[2] += c;
+    sha->state[3] += d;
+    sha->state[4] += e;
+    sha->state[5] += f;
+    sha->state[6] += g;
+    sha->state[7] += h;
+}
+
+static void Sha256Update(struct Sha256 *sha, const void *data, size_t size)
+{
+    const unsigned char *p = data;
+
+    sha->length += size;
+
+    if (sha->blockSize > 0)
+    {
+        size_t count = 64 - sha->blockSize;
+
+        if (count > size)
+            count = size;
+
+        memcpy(sha->block + sha->blockSize, p, count);
+        sha->blockSize += count;
+        p += count;
+        size -= count;
+
+        if (sha->blockSize < 64)
+            return;
+
+        Sha256Block(sha, sha->block);
+        sha->blockSize = 0;
+    }
+
+    for (; size >= 64; p += 64, size -= 64)
+        Sha256Block(sha, p);
+
+    memcpy(sha->block, p, size);
+    sha->blockSize = size;
+}
+
+static void Sha256Final(struct Sha256 *sha, unsigned char digest[32])
+{
+    uint64_t bits = sha->length * 8;
+    unsigned char padding[72] = {0x80};
+    int padSize = (sha->blockSize < 56 ? 56 : 120) - sha->blockSize;
+
+    for (int i = 0; i < 8; i++)
+        padding[padSize + i] = bits >> (56 - i * 8);
+
+    Sha256Update(sha, padding, padSize + 8);
+
+    for (int i = 0; i < 8; i++)
+    {
+        digest[i * 4] = sha->state[i] >> 24;
+        digest[i * 4 + 1] = sha->state[i] >> 16;
+        digest[i * 4 + 2] = sha->state[i] >> 8;
+        digest[i * 4 + 3] = sha->state[i];
+    }
+}
+
+// Adds a file's contents to the key, or a marker if it can't be read, so
+// that a missing file and an empty one give different keys.
+static void HashFile(struct Sha256 *sha, const char *path)
+{
+    unsigned char buffer[1 << 16];
+    FILE *fp = fopen(path, "rb");
+
+    if (fp == NULL)
+    {
+        Sha256Update(sha, "\0missing", 8);
+        return;
+    }
+
+    struct Sha256 fileSha;
+    unsigned char digest[32];
+    size_t count;
+
+    Sha256Init(&fileSha);
+
+    while ((count = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+        Sha256Update(&fileSha, buffer, count);
+
+    fclose(fp);
+    Sha256Final(&fileSha, digest);
+    Sha256Update(sha, digest, sizeof(digest));
+}
+
+static bool IsRegularFile(const char *path)
+{
+    struct stat st;
+
+    return stat(path, &st) == 0 && S_ISREG(st.st_mode);
+}
+
+// Returns the path PATH gives for a program, or NULL.
+static char *FindInPath(const char *name)
+{
+    const char *path = getenv("PATH");
+
+    if (path == NULL)
+        return NULL;
+
+    while (*path != 0)
+    {
+        size_t length = strcspn(path, ":");
+        char *candidate = malloc(length + strlen(name) + 2);
+
+        if (candidate == NULL)
+            FATAL_ERROR("buildcache: failed to allocate memory for path.\n");
+
+        sprintf(candidate, "%.*s/%s", (int)length, path, name);
+
+        if (length != 0 && IsRegularFile(candidate) && access(candidate, X_OK) == 0)
+            return candidate;
+
+        free(candidate);
+        path += length;
+
+        if (*path == ':')
+            path++;
+    }
+
+    return NULL;
+}
+
+// Adds the files the command line names to the key. Words are split at
+// whitespace and shell operators; quoting isn't interpreted, which only
+// means that a quoted path isn't hashed, since the command line itself is
+// part of the key. The target isn't hashed, as it's the old output.
+static void HashCommandFiles(struct Sha256 *sha, const char *command, const char *target, char **ignored, int numIgnored)
+{
+    const char *separators = " \t\n|;&<>()`";
+    bool atCommand = true;
+
+    for (const char *p = command; *p != 0;)
+    {
+        size_t length = strcspn(p, separators);
+
+        if (length == 0)
+        {
+            if (strchr("|;&(`", *p) != NULL)
+                atCommand = true;
+
+            p++;
+            continue;
+        }
+
+        char *word = malloc(length + 1);
+
+        if (word == NULL)
+            FATAL_ERROR("buildcache: failed to allocate memory for word.\n");
+
+        memcpy(word, p, length);
+        word[length] = 0;
+        p += length;
+
+        bool isAssignment = strchr(word, '=') != NULL && word[0] != '-';
+        bool isIgnored = strcmp(word, target) == 0;
+
+        for (int i = 0; i < numIgnored && !isIgnored; i++)
+            isIgnored = strcmp(word, ignored[i]) == 0;
+
+        if (isIgnored)
+        {
+            // Neither a program nor an input.
+        }
+        else if (IsRegularFile(word))
+        {
+            Sha256Update(sha, word, length + 1);
+            HashFile(sha, word);
+        }
+        else if (atCommand && !isAssignment && strchr(word, '/') == NULL)
+        {
+            char *program = FindInPath(word);
+
+            if (program != NULL)
+            {
+                Sha256Update(sha, word, length + 1);
+                HashFile(sha, program);
+                free(program);
+            }
+        }
+
+        if (!isAssignment)
+            atCommand = false;
+
+        free(word);
+    }
+}
+
+static void ToHex(const unsigned char *digest, char hex[65])
+{
+    for (int i = 0; i < 32; i++)
+        sprintf(hex + i * 2, "%02x", digest[i]);
+}
+
+// Entries are stored as DIR/ab/cdef..., like git's objects.
+static char *GetEntryPath(const char *dir, const char *hex)
+{
+    char *path = malloc(strlen(dir) + 68);
+
+    if (path == NULL)
+        FATAL_ERROR("buildcache: failed to allocate memory for path.\n");
+
+    sprintf(path, "%s/%.2s/%s", dir, hex, hex + 2);
+    return path;
+}
+
+// Copies src to a temporary file beside dest and renames it into place, so
+// that a reader never sees a partly written file. Returns false on failure.
+static bool CopyFileAtomically(const char *src, const char *dest)
+{
+    FILE *in = fopen(src, "rb");
+
+    if (in == NULL)
+        return false;
+
+    char *tempPath = malloc(strlen(dest) + 32);
+
+    if (tempPath == NULL)
+        FATAL_ERROR("buildcache: failed to allocate memory for path.\n");
+
+    sprintf(tempPath, "%s.tmp%ld", dest, (long)getpid());
+
+    FILE *out = fopen(tempPath, "wb");
+    bool ok = out != NULL;
+
+    if (ok)
+    {
+        unsigned char buffer[1 << 16];
+        size_t count;
+
+        while (ok && (count = fread(buffer, 1, sizeof(buffer), in)) > 0)
+            ok = fwrite(buffer, 1, count, out) == count;
+
+        ok = !ferror(in) && ok;
+
+        if (fclose(out) != 0)
+            ok = false;
+
+        if (ok)
+            ok = rename(tempPath, dest) == 0;
+
+        if (!ok)
+            remove(tempPath);
+    }
+
+    fclose(in);
+    free(tempPath);
+    return ok;
+}
+
+// The stats file gets one character per lookup: 'h' for a hit, 'm' for a
+// miss whose result was stored and 'u' for one that wasn't cacheable.
+static void RecordLookup(const char *dir, char kind)
+{
+    char *path = malloc(strlen(dir) + 8);
+
+    if (path == NULL)
+        FATAL_ERROR("buildcache: failed to allocate memory for path.\n");
+
+    sprintf(path, "%s/stats", dir);
+
+    int fd = open(path, O_WRONLY | O_APPEND | O_CREAT, 0644);
+
+    if (fd >= 0)
+    {
+        if (write(fd, &kind, 1) != 1)
+            fprintf(stderr, "buildcache: failed to write to \"%s\".\n", path);
+
+        close(fd);
+    }
+
+    free(path);
+}
+
+static bool GetFileStamp(const char *path, struct stat *st)
+{
+    if (stat(path, st) != 0)
+    {
+        memset(st, 0, sizeof(*st));
+        return false;
+    }
+
+    return true;
+}
+
+static bool IsSameStamp(const struct stat *a, const struct stat *b)
+{
+    return a->st_ino == b->st_ino && a->st_dev == b->st_dev && a->st_size == b->st_size
+        && a->st_mtim.tv_sec == b->st_mtim.tv_sec && a->st_mtim.tv_nsec == b->st_mtim.tv_nsec;
+}
+
+static int RunShell(char **argv)
+{
+    pid_t pid = fork();
+
+    if (pid < 0)
+        FATAL_ERROR("buildcache: fork failed: %s\n", strerror(errno));
+
+    if (pid == 0)
+    {
+        execvp(argv[0], argv);
+        fprintf(stderr, "buildcache: failed to run \"%s\": %s\n", argv[0], strerror(errno));
+        _exit(127);
+    }
+
+    // The child gets make's interrupts directly; wait for it to act on them.
+    signal(SIGINT, SIG_IGN);
+    signal(SIGQUIT, SIG_IGN);
+
+    int status;
+
+    while (waitpid(pid, &status, 0) < 0)
+    {
+        if (errno != EINTR)
+            FATAL_ERROR("buildcache: waitpid failed: %s\n", strerror(errno));
+    }
+
+    return status;
+}
+
+// Exits the same way the child did, so make sees no difference.
+static void ExitLike(int status)
+{
+    if (WIFSIGNALED(status))
+    {
+        signal(WTERMSIG(status), SIG_DFL);
+        raise(WTERMSIG(status));
+    }
+
+    exit(WIFEXITED(status) ? WEXITSTATUS(status) : 1);
+}
+
+static int HandleShellCommand(int argc, char **argv)
+{
+    char **ignored = malloc(argc * sizeof(char *));
+    int numIgnored = 0;
+
+    if (ignored == NULL)
+        FATAL_ERROR("buildcache: failed to allocate memory for arguments.\n");
+
+    int first = 2;
+
+    while (first + 1 < argc && strcmp(argv[first], "-i") == 0)
+    {
+        ignored[numIgnored++] = argv[first + 1];
+        first += 2;
+    }
+
+    int separator = -1;
+
+    for (int i = first + 2; i < argc && separator < 0; i++)
+    {
+        if (strcmp(argv[i], "--") == 0)
+            separator = i;
+    }
+
+    if (separator < 0 || separator + 1 >= argc)
+        FATAL_ERROR(USAGE);
+
+    const char *dir = argv[first];
+    const char *target = argv[first + 1];
+    char **shellArgv = argv + separator + 1;
+    struct Sha256 sha;
+    unsigned char digest[32];
+    char hex[65];
+
+    Sha256Init(&sha);
+    Sha256Update(&sha, KEY_VERSION, sizeof(KEY_VERSION));
+
+    for (int i = separator + 1; i < argc; i++)
+        Sha256Update(&sha, argv[i], strlen(argv[i]) + 1);
+
+    for (int i = first + 2; i < separator; i++)
+    {
+        Sha256Update(&sha, argv[i], strlen(argv[i]) + 1);
+        HashFile(&sha, argv[i]);
+    }
+
+    HashCommandFiles(&sha, argv[argc - 1], target, ignored, numIgnored);
+    Sha256Final(&sha, digest);
+    ToHex(digest, hex);
+
+    char *entryPath = GetEntryPath(dir, hex);
+
+    if (IsRegularFile(entryPath) && CopyFileAtomically(entryPath, target))
+    {
+        RecordLookup(dir, 'h');
+        free(entryPath);
+        return 0;
+    }
+
+    struct stat before;
+    struct stat after;
+
+    GetFileStamp(target, &before);
+
+    int status = RunShell(shellArgv);
+
+    // Only a line that wrote the target is worth storing; others, such as
+    // an echo before the real command, just run every time.
+    if (status == 0 && GetFileStamp(target, &after) && S_ISREG(after.st_mode) && !IsSameStamp(&before, &after))
+    {
+        char *entryDir = malloc(strlen(dir) + 4);
+
+        if (entryDir == NULL)
+            FATAL_ERROR("buildcache: failed to allocate memory for path.\n");
+
+        sprintf(entryDir, "%s/%.2s", dir, hex);
+        mkdir(dir, 0755);
+        mkdir(entryDir, 0755);
+
+        if (!CopyFileAtomically(target, entryPath))
+            fprintf(stderr, "buildcache: failed to store \"%s\" in \"%s\".\n", target, dir);
+
+        RecordLookup(dir, 'm');
+        free(entryDir);
+    }
+    else if (status == 0)
+    {
+        RecordLookup(dir, 'u');
+    }
+
+    free(entryPath);
+    ExitLike(status);
+    return 1;
+}
+
+static void SumEntries(const char *dir, long long *count, long long *bytes)
+{
+    DIR *top = opendir(dir);
+
+    if (top == NULL)
+        return;
+
+    struct dirent *sub;
+
+    while ((sub = readdir(top)) != NULL)
+    {
+        // Entries live in subdirectories named after the first two hex
+        // digits of their hash; anything else, "." and ".." included, isn't
+        // part of the cache.
+        if (strlen(sub->d_name) != 2 || !isxdigit((unsigned char)sub->d_name[0]) || !isxdigit((unsigned char)sub->d_name[1]))
+            continue;
+
+        char *subPath = malloc(strlen(dir) + 4);
+
+        if (subPath == NULL)
+            FATAL_ERROR("Failed to allocate memory for path.\n");
+
+        sprintf(subPath, "%s/%s", dir, sub->d_name);
+
+        DIR *entries = opendir(subPath);
+        struct dirent *entry;
+
+        while (entries != NULL && (entry = readdir(entries)) != NULL)
+        {
+            char *entryPath = malloc(strlen(subPath) + strlen(entry->d_name) + 2);
+            struct stat st;
+
+            if (entryPath == NULL)
+                FATAL_ERROR("Failed to allocate memory for path.\n");
+
+            sprintf(entryPath, "%s/%s", subPath, entry->d_name);
+
+            if (stat(entryPath, &st) == 0 && S_ISREG(st.st_mode))
+            {
+                (*count)++;
+                *bytes += st.st_size;
+            }
+
+            free(entryPath);
+        }
+
+        if (entries != NULL)
+            closedir(entries);
+
+        free(subPath);
+    }
+
+    closedir(top);
+}
+
+static int HandleStatsCommand(int argc, char **argv)
+{
+    if (argc != 3)
+        FATAL_ERROR(USAGE);
+
+    long long hits = 0;
+    long long stored = 0;
+    long long uncacheable = 0;
+    char *path = malloc(strlen(argv[2]) + 8);
+
+    if (path == NULL)
+        FATAL_ERROR("Failed to allocate memory for path.\n");
+
+    sprintf(path, "%s/stats", argv[2]);
+
+    FILE *fp = fopen(path, "rb");
+
+    if (fp != NULL)
+    {
+        int c;
+
+        while ((c = fgetc(fp)) != EOF)
+        {
+            if (c == 'h')
+                hits++;
+            else if (c == 'm')
+                stored++;
+            else if (c == 'u')
+                uncacheable++;
+        }
+
+        fclose(fp);
+    }
+
+    long long lookups = hits + stored;
+    long long numEntries = 0;
+    long long totalBytes = 0;
+
+    SumEntries(argv[2], &numEntries, &totalBytes);
+
+    printf("hits: %lld\n", hits);
+    printf("misses: %lld\n", stored);
+    printf("hit rate: %.1f%%\n", lookups ? 100.0 * hits / lookups : 0.0);
+    printf("uncached lines: %lld\n", uncacheable);
+    printf("entries: %lld (%.2f MB)\n", numEntries, totalBytes / 1e6);
+
+    free(path);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+        FATAL_ERROR(USAGE);
+
+    if (strcmp(argv[1], "shell") == 0)
+        return HandleShellCommand(argc, argv);
+    else if (strcmp(argv[1], "stats") == 0)
+        return HandleStatsCommand(argc, argv);
+
+    FATAL_ERROR(USAGE);
+}
@@ -0,0 +1,854 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+// buildprof records how long each step of a build takes. It runs in two
+// places when the ROM is built with PROFILE=1:
+//
+// - As make's SHELL, where it runs each recipe line and records it against
+//   the target being built, along with the target's prerequisites.
+// - In front of each tool (gbagfx, preproc, agbcc, as, ld, ...), so that
+//   the stages of a pipeline like cpp | preproc | agbcc | as are timed
+//   separately.
+//
+// Each run appends one line to a log. "buildprof report" turns the log into
+// a Chrome trace and prints where the time went.
+
+static const char *const USAGE =
+    "Usage: buildprof shell LOG [TARGET [PREREQ...]] -- SHELL ARGS...\n"
+    "       buildprof tool LOG NAME -- [VAR=VALUE...] COMMAND ARGS...\n"
+    "       buildprof report LOG [-o TRACE_JSON] [-n COUNT]\n";
+
+// The target of the recipe being run, passed on to the tools it runs.
+#define TARGET_ENV "BUILDPROF_TARGET"
+
+enum EventKind
+{
+    EVENT_RECIPE,
+    EVENT_TOOL,
+};
+
+struct Event
+{
+    enum EventKind kind;
+    long long start;
+    long long end;
+    long long userTime;
+    long long systemTime;
+    long long readBytes;
+    long long writeBytes;
+    int status;
+    char *name;
+    char *target;
+    char *prereqs;
+};
+
+static long long GetTimeMicroseconds(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (long long)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static long long ToMicroseconds(struct timeval tv)
+{
+    return (long long)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+// Runs argv and fills in the event's times and I/O from the child's
+// resource usage. Returns the child's wait status.
+static int RunCommand(char **argv, struct Event *event)
+{
+    struct rusage before;
+    struct rusage after;
+
+    getrusage(RUSAGE_CHILDREN, &before);
+    event->start = GetTimeMicroseconds();
+
+    pid_t pid = fork();
+
+    if (pid < 0)
+        FATAL_ERROR("buildprof: fork failed: %s\n", strerror(errno));
+
+    if (pid == 0)
+    {
+        execvp(argv[0], argv);
+        fprintf(stderr, "buildprof: failed to run \"%s\": %s\n", argv[0], strerror(errno));
+        _exit(127);
+    }
+
+    // The child gets make's interrupts directly; wait for it to act on them.
+    signal(SIGINT, SIG_IGN);
+    signal(SIGQUIT, SIG_IGN);
+
+    int status;
+
+    while (waitpid(pid, &status, 0) < 0)
+    {
+        if (errno != EINTR)
+            FATAL_ERROR("buildprof: waitpid failed: %s\n", strerror(errno));
+    }
+
+    event->end = GetTimeMicroseconds();
+    getrusage(RUSAGE_CHILDREN, &after);
+
+    event->userTime = ToMicroseconds(after.ru_utime) - ToMicroseconds(before.ru_utime);
+    event->systemTime = ToMicroseconds(after.ru_stime) - ToMicroseconds(before.ru_stime);
+    event->readBytes = (long long)(after.ru_inblock - before.ru_inblock) * 512;
+    event->writeBytes = (long long)(after.ru_oublock - before.ru_oublock) * 512;
+    event->status = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+
+    return status;
+}
+
+// Exits the same way the child did, so make sees no difference.
+static void ExitLike(int status)
+{
+    if (WIFSIGNALED(status))
+    {
+        signal(WTERMSIG(status), SIG_DFL);
+        raise(WTERMSIG(status));
+    }
+
+    exit(WIFEXITED(status) ? WEXITSTATUS(status) : 1);
+}
+
+// Log lines are tab separated:
+//   kind start end user sys read write status name target prereqs
+// Each line goes out in a single append, so lines from parallel jobs
+// don't interleave.
+static void AppendEvent(const char *logPath, const struct Event *event)
+{
+    int length = snprintf(NULL, 0, "%c\t%lld\t%lld\t%lld\t%lld\t%lld\t%lld\t%d\t%s\t%s\t%s\n",
+        event->kind == EVENT_RECIPE ? 'R' : 'T', event->start, event->end, event->userTime, event->systemTime,
+        event->readBytes, event->writeBytes, event->status, event->name, event->target, event->prereqs);
+    char *line = malloc(length + 1);
+
+    if (line == NULL)
+        FATAL_ERROR("buildprof: failed to allocate memory for log line.\n");
+
+    snprintf(line, length + 1, "%c\t%lld\t%lld\t%lld\t%lld\t%lld\t%lld\t%d\t%s\t%s\t%s\n",
+        event->kind == EVENT_RECIPE ? 'R' : 'T', event->start, event->end, event->userTime, event->systemTime,
+        event->readBytes, event->writeBytes, event->status, event->name, event->target, event->prereqs);
+
+    int fd = open(logPath, O_WRONLY | O_APPEND | O_CREAT, 0644);
+
+    if (fd >= 0)
+    {
+        if (write(fd, line, length) != length)
+            fprintf(stderr, "buildprof: failed to write to \"%s\".\n", logPath);
+
+        close(fd);
+    }
+    else
+    {
+        fprintf(stderr, "buildprof: failed to open \"%s\": %s\n", logPath, strerror(errno));
+    }
+
+    free(line);
+}
+
+static int FindSeparator(int argc, char **argv, int start)
+{
+    for (int i = start; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--") == 0)
+            return i;
+    }
+
+    return -1;
+}
+
+// Joins argv[start..end) with spaces.
+static char *JoinArgs(char **argv, int start, int end)
+{
+    size_t size = 1;
+
+    for (int i = start; i < end; i++)
+        size += strlen(argv[i]) + 1;
+
+    char *joined = malloc(size);
+
+    if (joined == NULL)
+        FATAL_ERROR("buildprof: failed to allocate memory for arguments.\n");
+
+    joined[0] = 0;
+
+    for (int i = start; i < end; i++)
+    {
+        if (i > start)
+            strcat(joined, " ");
+
+        strcat(joined, argv[i]);
+    }
+
+    return joined;
+}
+
+// Names a recipe that has no target, such as a $(shell ...) call, after
+// the program it runs, without any directory. If that program is a tool
+// run through "buildprof tool LOG NAME", the tool's name is used instead.
+static char *GetCommandName(const char *command)
+{
+    const char *word = command;
+    size_t length = 0;
+
+    for (int i = 0; i < 4; i++)
+    {
+        word += length;
+        word += strspn(word, " \t\n");
+        length = strcspn(word, " \t\n;|&");
+
+        if (i == 0)
+        {
+            const char *base = word;
+
+            for (size_t j = 0; j < length; j++)
+            {
+                if (word[j] == '/')
+                    base = word + j + 1;
+            }
+
+            length -= base - word;
+            word = base;
+
+            if (length != strlen("buildprof") || strncmp(word, "buildprof", length) != 0)
+                break;
+        }
+    }
+
+    char *name = malloc(length + 3);
+
+    if (name == NULL)
+        FATAL_ERROR("buildprof: failed to allocate memory for name.\n");
+
+    snprintf(name, length + 3, "(%.*s)", (int)length, word);
+    return name;
+}
+
+static int HandleShellCommand(int argc, char **argv)
+{
+    int separator = FindSeparator(argc, argv, 3);
+
+    if (argc < 4 || separator < 0 || separator + 1 >= argc)
+        FATAL_ERROR(USAGE);
+
+    struct Event event = {};
+    char *target = separator > 3 ? argv[3] : "";
+
+    event.kind = EVENT_RECIPE;
+    event.target = target;
+    event.prereqs = JoinArgs(argv, 4, separator);
+    event.name = target[0] != 0 ? target : GetCommandName(argv[argc - 1]);
+
+    if (target[0] != 0)
+        setenv(TARGET_ENV, target, 1);
+
+    int status = RunCommand(argv + separator + 1, &event);
+
+    AppendEvent(argv[2], &event);
+    ExitLike(status);
+    return 1;
+}
+
+static int HandleToolCommand(int argc, char **argv)
+{
+    if (argc < 6 || strcmp(argv[4], "--") != 0)
+        FATAL_ERROR(USAGE);
+
+    int commandStart = 5;
+
+    // Leading VAR=VALUE arguments are set in the environment, as with env.
+    while (commandStart < argc && strchr(argv[commandStart], '=') != NULL && argv[commandStart][0] != '=')
+    {
+        char *equals = strchr(argv[commandStart], '=');
+
+        *equals = 0;
+        setenv(argv[commandStart], equals + 1, 1);
+        *equals = '=';
+        commandStart++;
+    }
+
+    if (commandStart >= argc)
+        FATAL_ERROR(USAGE);
+
+    struct Event event = {};
+    const char *target = getenv(TARGET_ENV);
+
+    event.kind = EVENT_TOOL;
+    event.name = argv[3];
+    event.target = target != NULL ? (char *)target : "";
+    event.prereqs = "";
+
+    int status = RunCommand(argv + commandStart, &event);
+
+    AppendEvent(argv[2], &event);
+    ExitLike(status);
+    return 1;
+}
+
+static char *ReadLog(const char *path)
+{
+    FILE *fp = fopen(path, "rb");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", path);
+
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    rewind(fp);
+
+    char *text = malloc(size + 1);
+
+    if (text == NULL)
+        FATAL_ERROR("Failed to allocate memory for \"%s\".\n", path);
+
+    if (size != 0 && fread(text, size, 1, fp) != 1)
+        FATAL_ERROR("Failed to read \"%s\".\n", path);
+
+    text[size] = 0;
+    fclose(fp);
+    return text;
+}
+
+// Splits the log into events in place. Malformed lines, such as one cut
+// short by an interrupted build, are skipped.
+static int ParseLog(char *text, struct Event **eventsOut)
+{
+    int capacity = 1024;
+    int count = 0;
+    struct Event *events = malloc(capacity * sizeof(struct Event));
+
+    if (events == NULL)
+        FATAL_ERROR("Failed to allocate memory for events.\n");
+
+    for (char *line = text; *line != 0;)
+    {
+        char *next = strchr(line, '\n');
+
+        if (next == NULL)
+            break;
+
+        *next = 0;
+
+        char *fields[11];
+        int numFields = 0;
+
+        for (char *field = line; numFields < 11; numFields++)
+        {
+            fields[numFields] = field;
+            field = strchr(field, '\t');
+
+            if (field == NULL)
+            {
+                numFields++;
+                break;
+            }
+
+            *field++ = 0;
+        }
+
+        if (numFields == 11 && (fields[0][0] == 'R' || fields[0][0] == 'T'))
+        {
+            if (count == capacity)
+            {
+                capacity *= 2;
+                events = realloc(events, capacity * sizeof(struct Event));
+
+                if (events == NULL)
+                    FATAL_ERROR("Failed to allocate memory for events.\n");
+            }
+
+            struct Event *event = &events[count++];
+
+            event->kind = fields[0][0] == 'R' ? EVENT_RECIPE : EVENT_TOOL;
+            event->start = atoll(fields[1]);
+            event->end = atoll(fields[2]);
+            event->userTime = atoll(fields[3]);
+            event->systemTime = atoll(fields[4]);
+            event->readBytes = atoll(fields[5]);
+            event->writeBytes = atoll(fields[6]);
+            event->status = atoi(fields[7]);
+            event->name = fields[8];
+            event->target = fields[9];
+            event->prereqs = fields[10];
+        }
+
+        line = next + 1;
+    }
+
+    *eventsOut = events;
+    return count;
+}
+
+struct Target
+{
+    char *name;
+    char *prereqs;
+    long long time;
+    long long pathTime;
+    int pathNext;
+    int visitState;
+};
+
+struct TargetTable
+{
+    struct Target *targets;
+    int count;
+    int *slots;
+    int numSlots;
+};
+
+static unsigned int HashString(const char *s)
+{
+    unsigned int hash = 2166136261u;
+
+    while (*s != 0)
+        hash = (hash ^ (unsigned char)*s++) * 16777619u;
+
+    return hash;
+}
+
+// Returns the index of the named target, or -1 if it isn't in the table.
+static int FindTarget(struct TargetTable *table, const char *name)
+{
+    unsigned int slot = HashString(name) & (table->numSlots - 1);
+
+    while (table->slots[slot] >= 0)
+    {
+        if (strcmp(table->targets[table->slots[slot]].name, name) == 0)
+            return table->slots[slot];
+
+        slot = (slot + 1) & (table->numSlots - 1);
+    }
+
+    return -1;
+}
+
+// Sums the recipe time of each target. The table is sized for the case of
+// every event having its own target, so it never fills up.
+static void BuildTargetTable(struct Event *events, int numEvents, struct TargetTable *table)
+{
+    table->numSlots = 16;
+
+    while (table->numSlots < numEvents * 2)
+        table->numSlots *= 2;
+
+    table->slots = malloc(table->numSlots * sizeof(int));
+    table->targets = calloc(numEvents + 1, sizeof(struct Target));
+    table->count = 0;
+
+    if (table->slots == NULL || table->targets == NULL)
+        FATAL_ERROR("Failed to allocate memory for targets.\n");
+
+    for (int i = 0; i < table->numSlots; i++)
+        table->slots[i] = -1;
+
+    for (int i = 0; i < numEvents; i++)
+    {
+        struct Event *event = &events[i];
+
+        if (event->kind != EVENT_RECIPE || event->target[0] == 0)
+            continue;
+
+        int index = FindTarget(table, event->target);
+
+        if (index < 0)
+        {
+            unsigned int slot = HashString(event->target) & (table->numSlots - 1);
+
+            while (table->slots[slot] >= 0)
+                slot = (slot + 1) & (table->numSlots - 1);
+
+            index = table->count++;
+            table->slots[slot] = index;
+            table->targets[index].name = event->target;
+            table->targets[index].prereqs = event->prereqs;
+            table->targets[index].pathNext = -1;
+        }
+
+        table->targets[index].time += event->end - event->start;
+    }
+}
+
+// Finds the most expensive chain of targets ending at index, following the
+// prerequisites that were themselves built. Prerequisites are split in
+// place the first time a target is visited.
+static long long GetCriticalPathTime(struct TargetTable *table, int index)
+{
+    struct Target *target = &table->targets[index];
+
+    if (target->visitState == 2)
+        return target->pathTime;
+
+    // A dependency cycle can't happen in a finished make run, but don't
+    // loop forever on a hand-edited log.
+    if (target->visitState == 1)
+        return 0;
+
+    target->visitState = 1;
+
+    long long best = 0;
+    char *prereq = target->prereqs;
+
+    while (*prereq != 0)
+    {
+        char *end = strchr(prereq, ' ');
+
+        if (end != NULL)
+            *end = 0;
+
+        int prereqIndex = FindTarget(table, prereq);
+
+        if (prereqIndex >= 0)
+        {
+            long long time = GetCriticalPathTime(table, prereqIndex);
+
+            if (time > best)
+            {
+                best = time;
+                target->pathNext = prereqIndex;
+            }
+        }
+
+        if (end == NULL)
+            break;
+
+        prereq = end + 1;
+    }
+
+    target->prereqs = "";
+    target->pathTime = best + target->time;
+    target->visitState = 2;
+    return target->pathTime;
+}
+
+static void WriteJsonString(FILE *fp, const char *s)
+{
+    fputc('"', fp);
+
+    for (; *s != 0; s++)
+    {
+        if (*s == '"' || *s == '\\')
+            fprintf(fp, "\\%c", *s);
+        else if ((unsigned char)*s < 0x20)
+            fprintf(fp, "\\u%04x", *s);
+        else
+            fputc(*s, fp);
+    }
+
+    fputc('"', fp);
+}
+
+static int CompareEventStarts(const void *a, const void *b)
+{
+    const struct Event *eventA = a;
+    const struct Event *eventB = b;
+
+    if (eventA->start != eventB->start)
+        return eventA->start < eventB->start ? -1 : 1;
+
+    // Longer events first, so they enclose the ones they contain.
+    if (eventA->end != eventB->end)
+        return eventA->end > eventB->end ? -1 : 1;
+
+    return 0;
+}
+
+// Writes the events in Chrome's trace format, which chrome://tracing and
+// Perfetto can load. Recipes and tools are shown as two processes, and
+// within each, events are packed onto as few rows as don't overlap.
+static void WriteTrace(const char *path, struct Event *events, int numEvents, long long origin)
+{
+    FILE *fp = fopen(path, "w");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", path);
+
+    long long *laneEnds[2];
+    int numLanes[2] = {0, 0};
+
+    for (int kind = 0; kind < 2; kind++)
+    {
+        laneEnds[kind] = malloc((numEvents + 1) * sizeof(long long));
+
+        if (laneEnds[kind] == NULL)
+            FATAL_ERROR("Failed to allocate memory for trace rows.\n");
+    }
+
+    fputs("{\"traceEvents\":[\n", fp);
+    fputs("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"recipes\"}},\n", fp);
+    fputs("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":2,\"args\":{\"name\":\"tools\"}}", fp);
+
+    for (int i = 0; i < numEvents; i++)
+    {
+        struct Event *event = &events[i];
+        int kind = event->kind;
+        int lane = 0;
+
+        while (lane < numLanes[kind] && laneEnds[kind][lane] > event->start)
+            lane++;
+
+        if (lane == numLanes[kind])
+            numLanes[kind]++;
+
+        laneEnds[kind][lane] = event->end;
+
+        fputs(",\n{\"name\":", fp);
+        WriteJsonString(fp, event->name);
+        fprintf(fp, ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":%d,\"tid\":%d,\"args\":{\"target\":",
+            kind == EVENT_RECIPE ? "recipe" : "tool", event->start - origin, event->end - event->start, kind + 1, lane + 1);
+        WriteJsonString(fp, event->target);
+        fprintf(fp, ",\"cpu_ms\":%.3f,\"read_bytes\":%lld,\"write_bytes\":%lld,\"status\":%d}}",
+            (event->userTime + event->systemTime) / 1000.0, event->readBytes, event->writeBytes, event->status);
+    }
+
+    fputs("\n]}\n", fp);
+    fclose(fp);
+
+    free(laneEnds[0]);
+    free(laneEnds[1]);
+}
+
+struct ToolTotal
+{
+    const char *name;
+    int count;
+    long long wallTime;
+    long long cpuTime;
+    long long readBytes;
+    long long writeBytes;
+};
+
+static int CompareToolTotals(const void *a, const void *b)
+{
+    const struct ToolTotal *totalA = a;
+    const struct ToolTotal *totalB = b;
+
+    if (totalA->wallTime != totalB->wallTime)
+        return totalA->wallTime > totalB->wallTime ? -1 : 1;
+
+    return strcmp(totalA->name, totalB->name);
+}
+
+static void PrintToolTotals(struct Event *events, int numEvents)
+{
+    struct ToolTotal *totals = calloc(numEvents + 1, sizeof(struct ToolTotal));
+    int numTotals = 0;
+
+    if (totals == NULL)
+        FATAL_ERROR("Failed to allocate memory for tool totals.\n");
+
+    // There are only a few tools, so a linear search is fine.
+    for (int i = 0; i < numEvents; i++)
+    {
+        struct Event *event = &events[i];
+        int j = 0;
+
+        if (event->kind != EVENT_TOOL)
+            continue;
+
+        while (j < numTotals && strcmp(totals[j].name, event->name) != 0)
+            j++;
+
+        if (j == numTotals)
+            totals[numTotals++].name = event->name;
+
+        totals[j].count++;
+        totals[j].wallTime += event->end - event->start;
+        totals[j].cpuTime += event->userTime + event->systemTime;
+        totals[j].readBytes += event->readBytes;
+        totals[j].writeBytes += event->writeBytes;
+    }
+
+    qsort(totals, numTotals, sizeof(struct ToolTotal), CompareToolTotals);
+
+    printf("\nby tool:\n");
+    printf("  %-16s %8s %10s %10s %10s %10s\n", "tool", "runs", "wall (s)", "cpu (s)", "read (MB)", "write (MB)");
+
+    for (int i = 0; i < numTotals; i++)
+    {
+        printf("  %-16s %8d %10.3f %10.3f %10.2f %10.2f\n", totals[i].name, totals[i].count,
+            totals[i].wallTime / 1e6, totals[i].cpuTime / 1e6, totals[i].readBytes / 1e6, totals[i].writeBytes / 1e6);
+    }
+
+    free(totals);
+}
+
+static struct TargetTable *sSortTable;
+
+static int CompareTargetTimes(const void *a, const void *b)
+{
+    const struct Target *targetA = &sSortTable->targets[*(const int *)a];
+    const struct Target *targetB = &sSortTable->targets[*(const int *)b];
+
+    if (targetA->time != targetB->time)
+        return targetA->time > targetB->time ? -1 : 1;
+
+    return strcmp(targetA->name, targetB->name);
+}
+
+static void PrintSlowestTargets(struct TargetTable *table, int count)
+{
+    int *order = malloc((table->count + 1) * sizeof(int));
+
+    if (order == NULL)
+        FATAL_ERROR("Failed to allocate memory for targets.\n");
+
+    for (int i = 0; i < table->count; i++)
+        order[i] = i;
+
+    sSortTable = table;
+    qsort(order, table->count, sizeof(int), CompareTargetTimes);
+    sSortTable = NULL;
+
+    if (count > table->count)
+        count = table->count;
+
+    printf("\nslowest targets:\n");
+
+    for (int i = 0; i < count; i++)
+        printf("  %10.3f s  %s\n", table->targets[order[i]].time / 1e6, table->targets[order[i]].name);
+
+    free(order);
+}
+
+static void PrintCriticalPath(struct TargetTable *table)
+{
+    int last = -1;
+
+    for (int i = 0; i < table->count; i++)
+    {
+        if (GetCriticalPathTime(table, i) > (last < 0 ? -1 : table->targets[last].pathTime))
+            last = i;
+    }
+
+    if (last < 0)
+        return;
+
+    printf("\ncritical path (%.3f s):\n", table->targets[last].pathTime / 1e6);
+
+    // The chain is found from the end, so print it from the start.
+    int length = 0;
+
+    for (int i = last; i >= 0; i = table->targets[i].pathNext)
+        length++;
+
+    int *chain = malloc(length * sizeof(int));
+
+    if (chain == NULL)
+        FATAL_ERROR("Failed to allocate memory for the critical path.\n");
+
+    for (int i = last, j = length; i >= 0; i = table->targets[i].pathNext)
+        chain[--j] = i;
+
+    for (int i = 0; i < length; i++)
+        printf("  %10.3f s  %s\n", table->targets[chain[i]].time / 1e6, table->targets[chain[i]].name);
+
+    free(chain);
+}
+
+static int HandleReportCommand(int argc, char **argv)
+{
+    char *tracePath = NULL;
+    int count = 20;
+
+    if (argc < 3)
+        FATAL_ERROR(USAGE);
+
+    for (int i = 3; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            tracePath = argv[++i];
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            count = atoi(argv[++i]);
+        else
+            FATAL_ERROR(USAGE);
+    }
+
+    char *text = ReadLog(argv[2]);
+    struct Event *events;
+    int numEvents = ParseLog(text, &events);
+
+    if (numEvents == 0)
+        FATAL_ERROR("\"%s\" has no events.\n", argv[2]);
+
+    qsort(events, numEvents, sizeof(struct Event), CompareEventStarts);
+
+    long long origin = events[0].start;
+    long long finish = events[0].end;
+    long long recipeCpuTime = 0;
+    int numRecipes = 0;
+    int numFailed = 0;
+
+    for (int i = 0; i < numEvents; i++)
+    {
+        if (events[i].end > finish)
+            finish = events[i].end;
+
+        if (events[i].kind == EVENT_RECIPE)
+        {
+            recipeCpuTime += events[i].userTime + events[i].systemTime;
+            numRecipes++;
+
+            if (events[i].status != 0)
+                numFailed++;
+        }
+    }
+
+    if (tracePath != NULL)
+        WriteTrace(tracePath, events, numEvents, origin);
+
+    printf("wall time: %.3f s\n", (finish - origin) / 1e6);
+    printf("recipes: %d (%d failed), %.3f s of cpu\n", numRecipes, numFailed, recipeCpuTime / 1e6);
+
+    struct TargetTable table;
+
+    BuildTargetTable(events, numEvents, &table);
+    PrintToolTotals(events, numEvents);
+    PrintSlowestTargets(&table, count);
+    PrintCriticalPath(&table);
+
+    if (tracePath != NULL)
+        printf("\ntrace written to %s\n", tracePath);
+
+    free(table.slots);
+    free(table.targets);
+    free(events);
+    free(text);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+        FATAL_ERROR(USAGE);
+
+    if (strcmp(argv[1], "shell") == 0)
+        return HandleShellCommand(argc, argv);
+    else if (strcmp(argv[1], "tool") == 0)
+        return HandleToolCommand(argc, argv);
+    else if (strcmp(argv[1], "report") == 0)
+        return HandleReportCommand(argc, argv);
+
+    FATAL_ERROR(USAGE);
+}
@@ -0,0 +1,122 @@
+// mapped_file.h
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+// Shared by the tools that read large binary inputs (preproc, ramscrgen,
+// mid2agb).
+
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Read-only contents of a file. The file is memory-mapped where the
+// platform supports it and read into a buffer otherwise.
+class MappedFile
+{
+public:
+    ~MappedFile()
+    {
+#ifndef _WIN32
+        if (m_isMapped)
+        {
+            munmap(const_cast<unsigned char*>(m_data), m_size);
+            return;
+        }
+#endif
+
+        delete[] m_data;
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Returns nullptr if the file can't be opened or read.
+    static std::shared_ptr<const MappedFile> Open(const std::string& path)
+    {
+        std::shared_ptr<MappedFile> file(new MappedFile());
+
+#ifndef _WIN32
+        int fd = open(path.c_str(), O_RDONLY);
+
+        if (fd < 0)
+            return nullptr;
+
+        struct stat st;
+
+        if (fstat(fd, &st) != 0)
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        file->m_size = st.st_size;
+
+        if (file->m_size != 0)
+        {
+            void* data = mmap(nullptr, file->m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (data != MAP_FAILED)
+            {
+                file->m_data = static_cast<const unsigned char*>(data);
+                file->m_isMapped = true;
+            }
+        }
+
+        close(fd);
+
+        if (file->m_isMapped || file->m_size == 0)
+            return file;
+#endif
+
+        // Not mappable, so fall back to reading the whole file.
+        FILE* fp = std::fopen(path.c_str(), "rb");
+
+        if (fp == nullptr)
+            return nullptr;
+
+        std::fseek(fp, 0, SEEK_END);
+        long size = std::ftell(fp);
+        std::rewind(fp);
+
+        if (size < 0)
+        {
+            std::fclose(fp);
+            return nullptr;
+        }
+
+        unsigned char* buffer = new unsigned char[size];
+        file->m_data = buffer;
+        file->m_size = size;
+
+        if (size != 0 && std::fread(buffer, size, 1, fp) != 1)
+        {
+            std::fclose(fp);
+            return nullptr;
+        }
+
+        std::fclose(fp);
+
+        return file;
+    }
+
+    const unsigned char* Data() const { return m_data; }
+    std::size_t Size() const { return m_size; }
+
+private:
+    MappedFile() : m_data(nullptr), m_size(0), m_isMapped(false) {}
+
+    const unsigned char* m_data;
+    std::size_t m_size;
+    bool m_isMapped;
+};
+
+#endif // MAPPED_FILE_H
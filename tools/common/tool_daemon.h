@@ -0,0 +1,492 @@
+// tool_daemon.h
+
+#ifndef TOOL_DAEMON_H
+#define TOOL_DAEMON_H
+
+// Shared by the tools that a build runs over and over (scaninc, preproc,
+// mapjson). Started with --daemon SOCKET_PATH, a tool keeps its parsed
+// inputs in memory and serves requests on a Unix socket. Every other run
+// of the tool first looks for its daemon in $TOOLS_DAEMON_DIR, and if one
+// is listening, forwards its arguments, working directory and standard
+// streams to it instead of doing the work itself, so the command line and
+// output are the same either way.
+//
+// The daemon forks a child for each request after refreshing its caches,
+// so the child starts with everything already parsed, and a fatal error
+// or exit() in the tool only ends that child. The tool's prepare hook runs
+// in the daemon itself: it should only load caches, and must not start
+// threads. If it exits instead, the client sees the daemon go away before
+// anything was written and runs the request locally, which reports the
+// error as usual. Requests run with the daemon's environment, not the
+// client's.
+
+#include <cstdio>
+#include <string>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+#endif
+
+// Identifies one version of a file, for deciding whether a cached parse of
+// it is still good. The inode is included so that the same relative path
+// under a different working directory is never mistaken for the same file.
+struct FileStamp
+{
+    long long device = -1;
+    long long inode = -1;
+    long long mtime = -1;
+    long long size = -1;
+
+    bool operator==(const FileStamp &other) const
+    {
+        return device == other.device && inode == other.inode && mtime == other.mtime && size == other.size;
+    }
+
+    bool operator!=(const FileStamp &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+// Returns a stamp with every field -1 if the file doesn't exist.
+inline FileStamp GetFileStamp(const std::string &path)
+{
+    FileStamp stamp;
+#ifndef _WIN32
+    struct stat st;
+
+    if (stat(path.c_str(), &st) != 0)
+        return stamp;
+
+    stamp.device = st.st_dev;
+    stamp.inode = st.st_ino;
+#if defined(__APPLE__)
+    stamp.mtime = (long long)st.st_mtimespec.tv_sec * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+    stamp.mtime = (long long)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+    stamp.size = st.st_size;
+#else
+    (void)path;
+#endif
+    return stamp;
+}
+
+typedef void (*ToolPrepareFunc)(int argc, char **argv);
+typedef int (*ToolRunFunc)(int argc, char **argv);
+
+#ifndef _WIN32
+
+// How long a daemon waits for a request before shutting itself down.
+#define TOOL_DAEMON_IDLE_SECONDS (30 * 60)
+
+// A request is a header, sent along with the client's stdin, stdout and
+// stderr, followed by the working directory and each argument, all
+// NUL-terminated. The reply is the exit status.
+struct ToolDaemonHeader
+{
+    unsigned int argc;
+    unsigned int length;
+};
+
+// A client must not be killed by SIGPIPE when its daemon hangs up on it,
+// since it can still run the request itself.
+#ifdef MSG_NOSIGNAL
+#define TOOL_DAEMON_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define TOOL_DAEMON_SEND_FLAGS 0
+#endif
+
+inline bool ToolDaemonWriteAll(int fd, const void *data, std::size_t size)
+{
+    const char *p = static_cast<const char *>(data);
+
+    while (size > 0)
+    {
+        ssize_t count = send(fd, p, size, TOOL_DAEMON_SEND_FLAGS);
+
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            return false;
+
+        p += count;
+        size -= count;
+    }
+
+    return true;
+}
+
+inline bool ToolDaemonReadAll(int fd, void *data, std::size_t size)
+{
+    char *p = static_cast<char *>(data);
+
+    while (size > 0)
+    {
+        ssize_t count = read(fd, p, size);
+
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            return false;
+
+        p += count;
+        size -= count;
+    }
+
+    return true;
+}
+
+inline bool ToolDaemonSetAddress(const std::string &socketPath, struct sockaddr_un &addr)
+{
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+
+    if (socketPath.size() >= sizeof(addr.sun_path))
+        return false;
+
+    std::memcpy(addr.sun_path, socketPath.c_str(), socketPath.size() + 1);
+    return true;
+}
+
+// Returns a connected socket, or -1 if nothing is listening at socketPath.
+inline int ToolDaemonConnect(const std::string &socketPath)
+{
+    struct sockaddr_un addr;
+
+    if (!ToolDaemonSetAddress(socketPath, addr))
+        return -1;
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (fd < 0)
+        return -1;
+
+#ifdef SO_NOSIGPIPE
+    int noSigPipe = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+    if (connect(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+// Runs the request in toolName's daemon if one is listening. Returns false,
+// having done nothing, if there is no daemon or it went away before
+// answering, in which case the caller should run the request itself.
+inline bool ForwardToDaemon(const char *toolName, int argc, char **argv, int *exitCode)
+{
+    const char *dir = std::getenv("TOOLS_DAEMON_DIR");
+
+    if (dir == NULL || dir[0] == 0)
+        return false;
+
+    int fd = ToolDaemonConnect(std::string(dir) + "/" + toolName + ".sock");
+
+    if (fd < 0)
+        return false;
+
+    std::vector<char> cwd(4096);
+
+    while (getcwd(cwd.data(), cwd.size()) == NULL)
+    {
+        if (errno != ERANGE)
+        {
+            close(fd);
+            return false;
+        }
+
+        cwd.resize(cwd.size() * 2);
+    }
+
+    std::string payload(cwd.data());
+    payload += '\0';
+
+    for (int i = 0; i < argc; i++)
+    {
+        payload += argv[i];
+        payload += '\0';
+    }
+
+    // Flush anything already buffered so it isn't written after the
+    // daemon's output.
+    std::fflush(stdout);
+    std::fflush(stderr);
+
+    ToolDaemonHeader header = { static_cast<unsigned int>(argc), static_cast<unsigned int>(payload.size()) };
+    int fds[3] = { 0, 1, 2 };
+    char control[CMSG_SPACE(sizeof(fds))];
+    struct iovec iov = { &header, sizeof(header) };
+    struct msghdr msg;
+
+    std::memset(&msg, 0, sizeof(msg));
+    std::memset(control, 0, sizeof(control));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    std::memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    int status;
+    bool ok = sendmsg(fd, &msg, TOOL_DAEMON_SEND_FLAGS) == (ssize_t)sizeof(header)
+        && ToolDaemonWriteAll(fd, payload.data(), payload.size())
+        && ToolDaemonReadAll(fd, &status, sizeof(status));
+
+    close(fd);
+
+    if (ok)
+        *exitCode = status;
+
+    return ok;
+}
+
+// Reads one request from a client. On success, the client's standard
+// streams are in fds and args holds the working directory followed by argv.
+inline bool ToolDaemonReceive(int fd, int fds[3], std::vector<std::string> &args)
+{
+    ToolDaemonHeader header;
+    char control[CMSG_SPACE(3 * sizeof(int))];
+    struct iovec iov = { &header, sizeof(header) };
+    struct msghdr msg;
+
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    if (recvmsg(fd, &msg, 0) != (ssize_t)sizeof(header))
+        return false;
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+
+    if (cmsg == NULL || cmsg->cmsg_type != SCM_RIGHTS || cmsg->cmsg_len != CMSG_LEN(3 * sizeof(int)))
+        return false;
+
+    std::memcpy(fds, CMSG_DATA(cmsg), 3 * sizeof(int));
+
+    std::string payload(header.length, '\0');
+
+    if (!ToolDaemonReadAll(fd, &payload[0], payload.size()) || payload.empty() || payload.back() != '\0')
+    {
+        for (int i = 0; i < 3; i++)
+            close(fds[i]);
+        return false;
+    }
+
+    for (std::size_t pos = 0; pos < payload.size(); pos = payload.find('\0', pos) + 1)
+        args.push_back(payload.c_str() + pos);
+
+    if (args.size() != header.argc + 1)
+    {
+        for (int i = 0; i < 3; i++)
+            close(fds[i]);
+        return false;
+    }
+
+    return true;
+}
+
+// Runs one request in a grandchild, so that the child in between can wait
+// for it and send back its exit status however it ends.
+inline void ToolDaemonRunRequest(int clientFd, int fds[3], std::vector<std::string> &args, ToolRunFunc run)
+{
+    std::signal(SIGCHLD, SIG_DFL);
+
+    pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        std::signal(SIGPIPE, SIG_DFL);
+        close(clientFd);
+
+        for (int i = 0; i < 3; i++)
+        {
+            dup2(fds[i], i);
+            close(fds[i]);
+        }
+
+        std::vector<char *> argv;
+
+        for (std::size_t i = 1; i < args.size(); i++)
+            argv.push_back(&args[i][0]);
+
+        argv.push_back(NULL);
+        std::exit(run(static_cast<int>(argv.size() - 1), argv.data()));
+    }
+
+    for (int i = 0; i < 3; i++)
+        close(fds[i]);
+
+    int status = 1;
+    int waitStatus;
+
+    if (pid > 0 && waitpid(pid, &waitStatus, 0) == pid)
+    {
+        if (WIFEXITED(waitStatus))
+            status = WEXITSTATUS(waitStatus);
+        else if (WIFSIGNALED(waitStatus))
+            status = 128 + WTERMSIG(waitStatus);
+    }
+
+    ToolDaemonWriteAll(clientFd, &status, sizeof(status));
+    close(clientFd);
+    _exit(0);
+}
+
+// Serves requests on socketPath until it has been idle for
+// TOOL_DAEMON_IDLE_SECONDS, or until exePath (the daemon's argv[0]) is
+// rebuilt, so a daemon never runs stale code. prepare runs in the daemon,
+// in the request's working directory, before each request is forked off.
+inline int RunToolDaemon(const char *toolName, const char *exePath, const char *socketPath, ToolPrepareFunc prepare, ToolRunFunc run)
+{
+    struct sockaddr_un addr;
+
+    if (!ToolDaemonSetAddress(socketPath, addr))
+    {
+        std::fprintf(stderr, "%s: socket path \"%s\" is too long.\n", toolName, socketPath);
+        return 1;
+    }
+
+    int existing = ToolDaemonConnect(socketPath);
+
+    if (existing >= 0)
+    {
+        close(existing);
+        std::fprintf(stderr, "%s: a daemon is already listening on \"%s\".\n", toolName, socketPath);
+        return 1;
+    }
+
+    unlink(socketPath);
+
+    int listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    // Anyone who can connect can run the tool as this user, so the socket is
+    // created owner-only rather than with whatever the umask allows.
+    mode_t oldMask = umask(077);
+    bool bound = listenFd >= 0 && bind(listenFd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == 0;
+
+    umask(oldMask);
+
+    if (!bound || listen(listenFd, 64) != 0)
+    {
+        std::fprintf(stderr, "%s: failed to listen on \"%s\": %s\n", toolName, socketPath, std::strerror(errno));
+        return 1;
+    }
+
+    // Children are reaped automatically, and a client hanging up must not
+    // take the daemon with it.
+    std::signal(SIGCHLD, SIG_IGN);
+    std::signal(SIGPIPE, SIG_IGN);
+
+    std::vector<char> startDir(4096);
+
+    if (getcwd(startDir.data(), startDir.size()) == NULL)
+        startDir[0] = 0;
+
+    FileStamp exeStamp = GetFileStamp(exePath);
+
+    for (;;)
+    {
+        struct pollfd pfd = { listenFd, POLLIN, 0 };
+        int ready = poll(&pfd, 1, TOOL_DAEMON_IDLE_SECONDS * 1000);
+
+        if (ready < 0 && errno == EINTR)
+            continue;
+        if (ready <= 0)
+            break;
+
+        int clientFd = accept(listenFd, NULL, NULL);
+
+        if (clientFd < 0)
+            continue;
+
+        // Hanging up without an answer makes the client run the request
+        // with the new build itself.
+        if (GetFileStamp(exePath) != exeStamp)
+        {
+            close(clientFd);
+            break;
+        }
+
+        int fds[3];
+        std::vector<std::string> args;
+
+        if (!ToolDaemonReceive(clientFd, fds, args) || chdir(args[0].c_str()) != 0)
+        {
+            close(clientFd);
+            continue;
+        }
+
+        std::vector<char *> argv;
+
+        for (std::size_t i = 1; i < args.size(); i++)
+            argv.push_back(&args[i][0]);
+
+        argv.push_back(NULL);
+
+        if (prepare != NULL)
+            prepare(static_cast<int>(argv.size() - 1), argv.data());
+
+        std::fflush(stdout);
+        std::fflush(stderr);
+
+        pid_t pid = fork();
+
+        if (pid == 0)
+        {
+            close(listenFd);
+            ToolDaemonRunRequest(clientFd, fds, args, run);
+        }
+
+        for (int i = 0; i < 3; i++)
+            close(fds[i]);
+
+        close(clientFd);
+
+        if (startDir[0] != 0 && chdir(startDir.data()) != 0)
+            break;
+    }
+
+    close(listenFd);
+    unlink(socketPath);
+    return 0;
+}
+
+#else
+
+inline bool ForwardToDaemon(const char *, int, char **, int *)
+{
+    return false;
+}
+
+inline int RunToolDaemon(const char *toolName, const char *, const char *, ToolPrepareFunc, ToolRunFunc)
+{
+    std::fprintf(stderr, "%s: --daemon is not supported on Windows.\n", toolName);
+    return 1;
+}
+
+#endif // _WIN32
+
+#endif // TOOL_DAEMON_H
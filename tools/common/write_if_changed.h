@@ -0,0 +1,63 @@
+// write_if_changed.h
+
+#ifndef WRITE_IF_CHANGED_H
+#define WRITE_IF_CHANGED_H
+
+// Shared by the tools that generate source files (mapjson, jsonproc,
+// ramscrgen). Rewriting a generated file with identical contents bumps its
+// mtime and makes make rebuild everything that depends on it, so these
+// helpers leave files that are already up to date untouched.
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+// Returns true if the file at path exists and contains exactly contents.
+// The existing file is compared in chunks and the comparison stops at the
+// first difference, so a changed file is usually rejected after one read.
+inline bool FileHasContents(const std::string &path, const std::string &contents)
+{
+    FILE *fp = std::fopen(path.c_str(), "rb");
+
+    if (fp == NULL)
+        return false;
+
+    char buffer[1 << 16];
+    std::size_t pos = 0;
+    std::size_t count;
+    bool same = true;
+
+    while (same && (count = std::fread(buffer, 1, sizeof(buffer), fp)) > 0)
+    {
+        if (count > contents.size() - pos || std::memcmp(buffer, contents.data() + pos, count) != 0)
+            same = false;
+
+        pos += count;
+    }
+
+    std::fclose(fp);
+
+    return same && pos == contents.size();
+}
+
+// Writes contents to path unless the file already holds exactly that.
+// Returns false if the file had to be written but couldn't be.
+inline bool WriteFileIfChanged(const std::string &path, const std::string &contents)
+{
+    if (FileHasContents(path, contents))
+        return true;
+
+    FILE *fp = std::fopen(path.c_str(), "wb");
+
+    if (fp == NULL)
+        return false;
+
+    bool ok = contents.empty() || std::fwrite(contents.data(), contents.size(), 1, fp) == 1;
+
+    if (std::fclose(fp) != 0)
+        ok = false;
+
+    return ok;
+}
+
+#endif // WRITE_IF_CHANGED_H
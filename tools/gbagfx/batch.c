@@ -0,0 +1,455 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "global.h"
+#include "util.h"
+#include "batch.h"
+
+// A manifest has one conversion per line, written exactly like the arguments
+// to a normal gbagfx invocation:
+//
+//   graphics/foo.png graphics/foo.4bpp -mwidth 2 -mheight 2
+//   graphics/foo.4bpp graphics/foo.4bpp.lz
+//
+// Blank lines and lines starting with '#' are ignored. A job whose input is
+// the output of another job runs after that job, so chains like
+// .png -> .4bpp -> .4bpp.lz can be listed in any order.
+
+enum JobState
+{
+    JOB_PENDING,
+    JOB_RUN,
+    JOB_UP_TO_DATE,
+    JOB_SKIPPED,
+};
+
+struct BatchJob
+{
+    int argc;
+    char **argv;
+    int producer;
+    int depth;
+    enum JobState state;
+};
+
+struct BatchQueue
+{
+    struct BatchJob *jobs;
+    int *order;
+    int count;
+    int next;
+    BatchCommandFunc runCommand;
+    pthread_mutex_t mutex;
+};
+
+int GetDefaultThreadCount(void)
+{
+#ifdef _SC_NPROCESSORS_ONLN
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (count > 0)
+        return (int)count;
+#endif
+    return 1;
+}
+
+static char *NextToken(char **cursor)
+{
+    char *s = *cursor;
+
+    while (*s == ' ' || *s == '\t')
+        s++;
+
+    if (*s == 0)
+    {
+        *cursor = s;
+        return NULL;
+    }
+
+    char *token = s;
+
+    while (*s != 0 && *s != ' ' && *s != '\t')
+        s++;
+
+    if (*s != 0)
+        *s++ = 0;
+
+    *cursor = s;
+    return token;
+}
+
+static int ParseManifest(char *text, struct BatchJob **jobsOut)
+{
+    int capacity = 256;
+    int count = 0;
+    struct BatchJob *jobs = malloc(capacity * sizeof(struct BatchJob));
+
+    if (jobs == NULL)
+        FATAL_ERROR("Failed to allocate memory for batch jobs.\n");
+
+    char *line = text;
+
+    while (line != NULL && *line != 0)
+    {
+        char *lineEnd = strpbrk(line, "\r\n");
+        char *nextLine = NULL;
+
+        if (lineEnd != NULL)
+        {
+            nextLine = lineEnd + strspn(lineEnd, "\r\n");
+            *lineEnd = 0;
+        }
+
+        char *cursor = line;
+        char *tokens[64];
+        int numTokens = 0;
+        char *token;
+
+        tokens[numTokens++] = "gbagfx";
+
+        while ((token = NextToken(&cursor)) != NULL)
+        {
+            if (numTokens == 1 && token[0] == '#')
+                break;
+
+            if (numTokens >= 64)
+                FATAL_ERROR("Too many arguments on batch line for \"%s\".\n", tokens[1]);
+
+            tokens[numTokens++] = token;
+        }
+
+        if (numTokens == 2)
+            FATAL_ERROR("Batch line for \"%s\" has no output path.\n", tokens[1]);
+
+        if (numTokens > 2)
+        {
+            if (count == capacity)
+            {
+                capacity *= 2;
+                jobs = realloc(jobs, capacity * sizeof(struct BatchJob));
+
+                if (jobs == NULL)
+                    FATAL_ERROR("Failed to allocate memory for batch jobs.\n");
+            }
+
+            struct BatchJob *job = &jobs[count++];
+
+            job->argc = numTokens;
+            job->argv = malloc((numTokens + 1) * sizeof(char *));
+
+            if (job->argv == NULL)
+                FATAL_ERROR("Failed to allocate memory for batch jobs.\n");
+
+            memcpy(job->argv, tokens, numTokens * sizeof(char *));
+            job->argv[numTokens] = NULL;
+            job->producer = -1;
+            job->depth = -1;
+            job->state = JOB_PENDING;
+        }
+
+        line = nextLine;
+    }
+
+    *jobsOut = jobs;
+    return count;
+}
+
+static unsigned int HashPath(const char *path)
+{
+    unsigned int hash = 2166136261u;
+
+    while (*path != 0)
+        hash = (hash ^ (unsigned char)*path++) * 16777619u;
+
+    return hash;
+}
+
+// Links each job to the job that writes its input, if any.
+static void FindProducers(struct BatchJob *jobs, int count)
+{
+    int tableSize = 1;
+
+    while (tableSize < count * 2)
+        tableSize <<= 1;
+
+    int *table = malloc(tableSize * sizeof(int));
+
+    if (table == NULL)
+        FATAL_ERROR("Failed to allocate memory for batch jobs.\n");
+
+    for (int i = 0; i < tableSize; i++)
+        table[i] = -1;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned int slot = HashPath(jobs[i].argv[2]) & (tableSize - 1);
+
+        while (table[slot] != -1)
+        {
+            if (strcmp(jobs[table[slot]].argv[2], jobs[i].argv[2]) == 0)
+                FATAL_ERROR("\"%s\" is the output of more than one batch job.\n", jobs[i].argv[2]);
+
+            slot = (slot + 1) & (tableSize - 1);
+        }
+
+        table[slot] = i;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned int slot = HashPath(jobs[i].argv[1]) & (tableSize - 1);
+
+        while (table[slot] != -1)
+        {
+            if (strcmp(jobs[table[slot]].argv[2], jobs[i].argv[1]) == 0)
+            {
+                jobs[i].producer = table[slot];
+                break;
+            }
+
+            slot = (slot + 1) & (tableSize - 1);
+        }
+    }
+
+    free(table);
+}
+
+static int GetJobDepth(struct BatchJob *jobs, int index)
+{
+    struct BatchJob *job = &jobs[index];
+
+    if (job->depth == -2)
+        FATAL_ERROR("Batch jobs for \"%s\" form a cycle.\n", job->argv[2]);
+
+    if (job->depth == -1)
+    {
+        job->depth = -2;
+        job->depth = job->producer >= 0 ? GetJobDepth(jobs, job->producer) + 1 : 0;
+    }
+
+    return job->depth;
+}
+
+static bool GetModificationTime(char *path, struct timespec *time)
+{
+    struct stat st;
+
+    if (stat(path, &st) != 0)
+        return false;
+
+#ifdef __APPLE__
+    *time = st.st_mtimespec;
+#else
+    *time = st.st_mtim;
+#endif
+    return true;
+}
+
+static bool IsNewer(struct timespec *a, struct timespec *b)
+{
+    return a->tv_sec > b->tv_sec || (a->tv_sec == b->tv_sec && a->tv_nsec > b->tv_nsec);
+}
+
+// Decides whether a job needs to run. Jobs are visited in order of depth, so
+// the producer of a job's input has already been decided.
+static void DecideJobState(struct BatchJob *jobs, struct BatchJob *job, bool force)
+{
+    struct timespec inputTime;
+    struct timespec outputTime;
+
+    if (job->producer >= 0)
+    {
+        enum JobState producerState = jobs[job->producer].state;
+
+        if (producerState == JOB_SKIPPED)
+        {
+            job->state = JOB_SKIPPED;
+            return;
+        }
+
+        if (producerState == JOB_RUN)
+        {
+            job->state = JOB_RUN;
+            return;
+        }
+    }
+
+    if (!GetModificationTime(job->argv[1], &inputTime))
+    {
+        // Leave it to whatever else knows how to make the input.
+        fprintf(stderr, "gbagfx batch: skipping \"%s\", input \"%s\" does not exist.\n", job->argv[2], job->argv[1]);
+        job->state = JOB_SKIPPED;
+        return;
+    }
+
+    if (!force && GetModificationTime(job->argv[2], &outputTime) && !IsNewer(&inputTime, &outputTime))
+        job->state = JOB_UP_TO_DATE;
+    else
+        job->state = JOB_RUN;
+}
+
+static struct BatchJob *sSortJobs;
+
+static int CompareJobInputs(const void *a, const void *b)
+{
+    int indexA = *(const int *)a;
+    int indexB = *(const int *)b;
+    int result = strcmp(sSortJobs[indexA].argv[1], sSortJobs[indexB].argv[1]);
+
+    return result != 0 ? result : indexA - indexB;
+}
+
+// Puts jobs that read the same file next to each other, e.g. a .png converted
+// to both .4bpp and .gbapal, so one worker can run them back to back and reuse
+// the decoded input.
+static void GroupJobsByInput(struct BatchQueue *queue)
+{
+    sSortJobs = queue->jobs;
+    qsort(queue->order, queue->count, sizeof(int), CompareJobInputs);
+    sSortJobs = NULL;
+}
+
+static bool HaveSameInput(struct BatchQueue *queue, int a, int b)
+{
+    return strcmp(queue->jobs[queue->order[a]].argv[1], queue->jobs[queue->order[b]].argv[1]) == 0;
+}
+
+static void *BatchWorker(void *arg)
+{
+    struct BatchQueue *queue = arg;
+
+    for (;;)
+    {
+        // Claim every job with the same input at once.
+        pthread_mutex_lock(&queue->mutex);
+        int start = queue->next;
+        int end = start;
+
+        if (end < queue->count)
+        {
+            end++;
+
+            while (end < queue->count && HaveSameInput(queue, start, end))
+                end++;
+        }
+
+        queue->next = end;
+        pthread_mutex_unlock(&queue->mutex);
+
+        if (start == end)
+            break;
+
+        for (int i = start; i < end; i++)
+        {
+            struct BatchJob *job = &queue->jobs[queue->order[i]];
+            queue->runCommand(job->argc, job->argv);
+        }
+    }
+
+    return NULL;
+}
+
+static void RunJobs(struct BatchQueue *queue, int numThreads)
+{
+    if (numThreads > queue->count)
+        numThreads = queue->count;
+
+    if (numThreads <= 1)
+    {
+        BatchWorker(queue);
+        return;
+    }
+
+    pthread_t *threads = malloc(numThreads * sizeof(pthread_t));
+
+    if (threads == NULL)
+        FATAL_ERROR("Failed to allocate memory for batch threads.\n");
+
+    for (int i = 0; i < numThreads; i++)
+    {
+        if (pthread_create(&threads[i], NULL, BatchWorker, queue) != 0)
+            FATAL_ERROR("Failed to create batch worker thread.\n");
+    }
+
+    for (int i = 0; i < numThreads; i++)
+        pthread_join(threads[i], NULL);
+
+    free(threads);
+}
+
+void RunBatch(char *manifestPath, int numThreads, bool force, BatchCommandFunc runCommand)
+{
+    int fileSize;
+    unsigned char *manifest = ReadWholeFileZeroPadded(manifestPath, &fileSize, 1);
+    struct BatchJob *jobs;
+    int count = ParseManifest((char *)manifest, &jobs);
+
+    FindProducers(jobs, count);
+
+    int maxDepth = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        int depth = GetJobDepth(jobs, i);
+
+        if (depth > maxDepth)
+            maxDepth = depth;
+    }
+
+    struct BatchQueue queue;
+    int numRun = 0;
+    int numUpToDate = 0;
+    int numSkipped = 0;
+
+    queue.jobs = jobs;
+    queue.order = malloc((count + 1) * sizeof(int));
+    queue.runCommand = runCommand;
+
+    if (queue.order == NULL)
+        FATAL_ERROR("Failed to allocate memory for batch jobs.\n");
+
+    pthread_mutex_init(&queue.mutex, NULL);
+
+    // Each depth only depends on the ones before it, so run them as waves.
+    for (int depth = 0; depth <= maxDepth; depth++)
+    {
+        queue.count = 0;
+        queue.next = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            if (jobs[i].depth != depth)
+                continue;
+
+            DecideJobState(jobs, &jobs[i], force);
+
+            if (jobs[i].state == JOB_RUN)
+                queue.order[queue.count++] = i;
+            else if (jobs[i].state == JOB_UP_TO_DATE)
+                numUpToDate++;
+            else
+                numSkipped++;
+        }
+
+        GroupJobsByInput(&queue);
+        RunJobs(&queue, numThreads);
+        numRun += queue.count;
+    }
+
+    pthread_mutex_destroy(&queue.mutex);
+
+    printf("gbagfx batch: %d converted, %d up to date, %d skipped\n", numRun, numUpToDate, numSkipped);
+
+    for (int i = 0; i < count; i++)
+        free(jobs[i].argv);
+
+    free(queue.order);
+    free(jobs);
+    free(manifest);
+}
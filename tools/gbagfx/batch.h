@@ -0,0 +1,13 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stdbool.h>
+
+// Runs one conversion, given an argv laid out like gbagfx's own command line
+// (argv[1] is the input path, argv[2] the output path, options follow).
+typedef void (*BatchCommandFunc)(int argc, char **argv);
+
+void RunBatch(char *manifestPath, int numThreads, bool force, BatchCommandFunc runCommand);
+int GetDefaultThreadCount(void);
+
+#endif // BATCH_H
@@ -0,0 +1,388 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "global.h"
+#include "util.h"
+#include "lz.h"
+#include "rl.h"
+#include "huff.h"
+#include "compress_auto.h"
+
+enum CodecType
+{
+    CODEC_LZ,
+    CODEC_LZ_OPTIMAL,
+    CODEC_RL,
+    CODEC_HUFF,
+};
+
+struct Codec
+{
+    const char *name;
+    enum CodecType type;
+    int param;
+    bool vramSafe;
+};
+
+// LZ's param is the minimum match distance; a distance of 1 reads back the
+// byte just written, which VRAM's 16-bit writes can't do. Huffman's param is
+// the bit depth.
+static const struct Codec sCodecs[] =
+{
+    { "lz",                CODEC_LZ,         2, true  },
+    { "lz-search1",        CODEC_LZ,         1, false },
+    { "lz-search4",        CODEC_LZ,         4, true  },
+    { "lz-optimal",        CODEC_LZ_OPTIMAL, 2, true  },
+    { "lz-optimal-search1", CODEC_LZ_OPTIMAL, 1, false },
+    { "rl",                CODEC_RL,         0, true  },
+    { "huff4",             CODEC_HUFF,       4, true  },
+    { "huff8",             CODEC_HUFF,       8, true  },
+};
+
+#define NUM_CODECS (int)(sizeof(sCodecs) / sizeof(sCodecs[0]))
+
+// Rough costs, in CPU cycles, of the steps the BIOS decompressors take when
+// reading from ROM into WRAM. They are only meant for comparing codecs with
+// each other, not for predicting exact load times.
+#define LZ_CYCLES_PER_FLAG_BYTE      10
+#define LZ_CYCLES_PER_LITERAL        14
+#define LZ_CYCLES_PER_MATCH          26
+#define LZ_CYCLES_PER_MATCH_BYTE     9
+#define RL_CYCLES_PER_HEADER         14
+#define RL_CYCLES_PER_LITERAL_BYTE   10
+#define RL_CYCLES_PER_RUN_BYTE       6
+#define HUFF_CYCLES_PER_BIT          12
+#define HUFF_CYCLES_PER_VALUE        18
+
+struct CompressResult
+{
+    unsigned char *data;
+    int size;
+    long long cycles;
+};
+
+struct CompressInput
+{
+    char *path;
+    unsigned char *data;
+    int size;
+    struct CompressResult results[NUM_CODECS];
+};
+
+struct CompressQueue
+{
+    struct CompressInput *inputs;
+    int numJobs;
+    int next;
+    bool keepData;
+    bool vramSafe;
+    pthread_mutex_t mutex;
+};
+
+static long long EstimateLZCycles(const unsigned char *src, int srcSize, int uncompressedSize)
+{
+    long long cycles = 0;
+    int srcPos = 4;
+    int destPos = 0;
+
+    while (destPos < uncompressedSize && srcPos < srcSize)
+    {
+        unsigned char flags = src[srcPos++];
+
+        cycles += LZ_CYCLES_PER_FLAG_BYTE;
+
+        for (int i = 0; i < 8 && destPos < uncompressedSize && srcPos < srcSize; i++)
+        {
+            if (flags & (0x80 >> i))
+            {
+                int length = (src[srcPos] >> 4) + 3;
+
+                srcPos += 2;
+                destPos += length;
+                cycles += LZ_CYCLES_PER_MATCH + length * LZ_CYCLES_PER_MATCH_BYTE;
+            }
+            else
+            {
+                srcPos++;
+                destPos++;
+                cycles += LZ_CYCLES_PER_LITERAL;
+            }
+        }
+    }
+
+    return cycles;
+}
+
+static long long EstimateRLCycles(const unsigned char *src, int srcSize, int uncompressedSize)
+{
+    long long cycles = 0;
+    int srcPos = 4;
+    int destPos = 0;
+
+    while (destPos < uncompressedSize && srcPos < srcSize)
+    {
+        unsigned char header = src[srcPos++];
+
+        cycles += RL_CYCLES_PER_HEADER;
+
+        if (header & 0x80)
+        {
+            int length = (header & 0x7F) + 3;
+
+            srcPos++;
+            destPos += length;
+            cycles += length * RL_CYCLES_PER_RUN_BYTE;
+        }
+        else
+        {
+            int length = (header & 0x7F) + 1;
+
+            srcPos += length;
+            destPos += length;
+            cycles += length * RL_CYCLES_PER_LITERAL_BYTE;
+        }
+    }
+
+    return cycles;
+}
+
+static long long EstimateHuffCycles(const unsigned char *src, int srcSize, int uncompressedSize, int bitDepth)
+{
+    int treeSize = (src[4] + 1) * 2;
+    long long bits = (long long)(srcSize - 4 - treeSize) * 8;
+    long long values = (long long)uncompressedSize * 8 / bitDepth;
+
+    return bits * HUFF_CYCLES_PER_BIT + values * HUFF_CYCLES_PER_VALUE;
+}
+
+// Leaves the result empty if the codec can't handle the input, which only
+// happens for Huffman trees too deep or too wide to encode.
+static void RunCodec(const struct Codec *codec, struct CompressInput *input, struct CompressResult *result)
+{
+    unsigned char *data = NULL;
+    unsigned char *roundTrip = NULL;
+    const char *error = NULL;
+    int size = 0;
+    int roundTripSize = 0;
+
+    switch (codec->type)
+    {
+    case CODEC_LZ:
+        data = LZCompress(input->data, input->size, &size, codec->param);
+        roundTrip = LZDecompress(data, size, &roundTripSize);
+        result->cycles = EstimateLZCycles(data, size, input->size);
+        break;
+    case CODEC_LZ_OPTIMAL:
+        data = LZCompressOptimal(input->data, input->size, &size, codec->param);
+        roundTrip = LZDecompress(data, size, &roundTripSize);
+        result->cycles = EstimateLZCycles(data, size, input->size);
+        break;
+    case CODEC_RL:
+        data = RLCompress(input->data, input->size, &size);
+        roundTrip = RLDecompress(data, size, &roundTripSize);
+        result->cycles = EstimateRLCycles(data, size, input->size);
+        break;
+    case CODEC_HUFF:
+        data = HuffTryCompress(input->data, input->size, &size, codec->param, &error);
+        if (data == NULL)
+        {
+            if (error == NULL)
+                FATAL_ERROR("%s failed for \"%s\".\n", codec->name, input->path);
+            return;
+        }
+        roundTrip = HuffDecompress(data, size, &roundTripSize);
+        result->cycles = EstimateHuffCycles(data, size, input->size, codec->param);
+        break;
+    }
+
+    if (roundTripSize != input->size || memcmp(roundTrip, input->data, input->size) != 0)
+        FATAL_ERROR("%s round trip mismatch for \"%s\".\n", codec->name, input->path);
+
+    free(roundTrip);
+
+    result->data = data;
+    result->size = size;
+}
+
+static void *CompressWorker(void *arg)
+{
+    struct CompressQueue *queue = arg;
+
+    for (;;)
+    {
+        pthread_mutex_lock(&queue->mutex);
+        int next = queue->next < queue->numJobs ? queue->next++ : -1;
+        pthread_mutex_unlock(&queue->mutex);
+
+        if (next < 0)
+            break;
+
+        const struct Codec *codec = &sCodecs[next % NUM_CODECS];
+        struct CompressInput *input = &queue->inputs[next / NUM_CODECS];
+        struct CompressResult *result = &input->results[next % NUM_CODECS];
+
+        if ((queue->vramSafe && !codec->vramSafe) || input->size == 0)
+            continue;
+
+        RunCodec(codec, input, result);
+
+        if (!queue->keepData)
+        {
+            free(result->data);
+            result->data = NULL;
+        }
+    }
+
+    return NULL;
+}
+
+static void WriteReport(char *reportPath, struct CompressInput *inputs, int numInputs, const int *best)
+{
+    FILE *fp = fopen(reportPath, "w");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", reportPath);
+
+    fputs("file,raw_bytes,codec,compressed_bytes,ratio,est_decode_cycles,cycles_per_byte,vram_safe,chosen\n", fp);
+
+    for (int i = 0; i < numInputs; i++)
+    {
+        struct CompressInput *input = &inputs[i];
+
+        for (int j = 0; j < NUM_CODECS; j++)
+        {
+            struct CompressResult *result = &input->results[j];
+
+            if (result->size == 0)
+                continue;
+
+            fprintf(fp, "%s,%d,%s,%d,%.4f,%lld,%.2f,%d,%d\n",
+                input->path, input->size, sCodecs[j].name, result->size,
+                (double)result->size / input->size, result->cycles,
+                (double)result->cycles / input->size, sCodecs[j].vramSafe, j == best[i]);
+        }
+    }
+
+    fclose(fp);
+}
+
+void RunCompressAuto(char **paths, int numPaths, char *outputPath, char *reportPath, bool vramSafe, int numThreads)
+{
+    struct CompressQueue queue = {};
+
+    queue.inputs = calloc(numPaths, sizeof(struct CompressInput));
+    queue.numJobs = numPaths * NUM_CODECS;
+    queue.keepData = outputPath != NULL;
+    queue.vramSafe = vramSafe;
+
+    if (queue.inputs == NULL)
+        FATAL_ERROR("Failed to allocate memory for inputs.\n");
+
+    for (int i = 0; i < numPaths; i++)
+    {
+        queue.inputs[i].path = paths[i];
+        queue.inputs[i].data = ReadWholeFile(paths[i], &queue.inputs[i].size);
+    }
+
+    pthread_mutex_init(&queue.mutex, NULL);
+
+    if (numThreads > queue.numJobs)
+        numThreads = queue.numJobs;
+
+    if (numThreads <= 1)
+    {
+        CompressWorker(&queue);
+    }
+    else
+    {
+        pthread_t *threads = malloc(numThreads * sizeof(pthread_t));
+
+        if (threads == NULL)
+            FATAL_ERROR("Failed to allocate memory for threads.\n");
+
+        for (int i = 0; i < numThreads; i++)
+        {
+            if (pthread_create(&threads[i], NULL, CompressWorker, &queue) != 0)
+                FATAL_ERROR("Failed to create worker thread.\n");
+        }
+
+        for (int i = 0; i < numThreads; i++)
+            pthread_join(threads[i], NULL);
+
+        free(threads);
+    }
+
+    pthread_mutex_destroy(&queue.mutex);
+
+    // Ties on size go to the codec with the lower estimated decode cost.
+    int *best = malloc(numPaths * sizeof(int));
+    long long totalRaw = 0;
+    long long totalBest = 0;
+
+    if (best == NULL)
+        FATAL_ERROR("Failed to allocate memory for results.\n");
+
+    for (int i = 0; i < numPaths; i++)
+    {
+        struct CompressInput *input = &queue.inputs[i];
+
+        best[i] = -1;
+
+        for (int j = 0; j < NUM_CODECS; j++)
+        {
+            struct CompressResult *result = &input->results[j];
+
+            if (result->size == 0)
+                continue;
+
+            if (best[i] < 0
+             || result->size < input->results[best[i]].size
+             || (result->size == input->results[best[i]].size && result->cycles < input->results[best[i]].cycles))
+                best[i] = j;
+        }
+
+        if (best[i] < 0)
+            FATAL_ERROR("Can't compress \"%s\": it's empty.\n", input->path);
+
+        totalRaw += input->size;
+        totalBest += input->results[best[i]].size;
+    }
+
+    if (outputPath != NULL)
+    {
+        struct CompressResult *result = &queue.inputs[0].results[best[0]];
+        WriteWholeFile(outputPath, result->data, result->size);
+    }
+
+    if (reportPath != NULL)
+        WriteReport(reportPath, queue.inputs, numPaths, best);
+
+    if (outputPath == NULL || reportPath != NULL)
+    {
+        int counts[NUM_CODECS] = {0};
+
+        for (int i = 0; i < numPaths; i++)
+            counts[best[i]]++;
+
+        for (int j = 0; j < NUM_CODECS; j++)
+        {
+            if (counts[j] != 0)
+                printf("%-18s best for %d file(s)\n", sCodecs[j].name, counts[j]);
+        }
+
+        printf("total: %lld -> %lld bytes (%.2f%%)\n", totalRaw, totalBest, totalRaw ? 100.0 * totalBest / totalRaw : 0.0);
+    }
+
+    for (int i = 0; i < numPaths; i++)
+    {
+        for (int j = 0; j < NUM_CODECS; j++)
+            free(queue.inputs[i].results[j].data);
+
+        free(queue.inputs[i].data);
+    }
+
+    free(best);
+    free(queue.inputs);
+}
@@ -0,0 +1,13 @@
+#ifndef COMPRESS_AUTO_H
+#define COMPRESS_AUTO_H
+
+#include <stdbool.h>
+
+// Compresses each file with every codec, in parallel, and picks the smallest
+// result. If outputPath isn't NULL (numPaths must then be 1), the smallest
+// result is written there. If reportPath isn't NULL, a CSV row is written
+// for every file and codec. If vramSafe is set, codecs whose output can't be
+// decompressed straight into VRAM are left out.
+void RunCompressAuto(char **paths, int numPaths, char *outputPath, char *reportPath, bool vramSafe, int numThreads);
+
+#endif // COMPRESS_AUTO_H
@@ -1,11 +1,18 @@
 // Copyright (c) 2015 YamaArashi
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <time.h>
 #include <setjmp.h>
 #include <png.h>
+#include <zlib.h>
 #include "global.h"
 #include "convert_png.h"
 #include "gfx.h"
+#include "png_decode.h"
+#include "util.h"
 
 static FILE *PngReadOpen(char *path, png_structp *pngStruct, png_infop *pngInfo)
 {
@@ -79,51 +86,177 @@ static unsigned char *ConvertBitDepth(unsigned char *src, int srcBitDepth, int d
     return output;
 }
 
-void ReadPng(char *path, struct Image *image)
+// libpng decodes everything unless GBAGFX_PNG_DECODER=builtin picks the
+// built-in decoder, which falls back to libpng for PNGs it can't handle.
+static bool UseBuiltinDecoder(void)
+{
+    const char *decoder = getenv("GBAGFX_PNG_DECODER");
+
+    return decoder != NULL && strcmp(decoder, "builtin") == 0;
+}
+
+static void DecodePngWithLibpng(char *path, bool paletteOnly, struct DecodedPng *png)
 {
     png_structp png_ptr;
     png_infop info_ptr;
 
     FILE *fp = PngReadOpen(path, &png_ptr, &info_ptr);
 
-    int bit_depth = png_get_bit_depth(png_ptr, info_ptr);
+    memset(png, 0, sizeof(*png));
+    png->width = png_get_image_width(png_ptr, info_ptr);
+    png->height = png_get_image_height(png_ptr, info_ptr);
+    png->bitDepth = png_get_bit_depth(png_ptr, info_ptr);
+    png->colorType = png_get_color_type(png_ptr, info_ptr);
+    png->rowBytes = png_get_rowbytes(png_ptr, info_ptr);
 
-    int color_type = png_get_color_type(png_ptr, info_ptr);
+    png_colorp colors;
+    int numColors;
 
-    if (color_type != PNG_COLOR_TYPE_GRAY && color_type != PNG_COLOR_TYPE_PALETTE)
-        FATAL_ERROR("\"%s\" has an unsupported color type.\n", path);
+    if (png->colorType == PNG_COLOR_TYPE_PALETTE && png_get_PLTE(png_ptr, info_ptr, &colors, &numColors) == PNG_INFO_PLTE)
+    {
+        if (numColors > 256)
+            FATAL_ERROR("Images with more than 256 colors are not supported.\n");
 
-    // Check if the image has a palette so that we can tell if the colors need to be inverted later.
-    // Don't read the palette because it's not needed for now.
-    image->hasPalette = (color_type == PNG_COLOR_TYPE_PALETTE);
+        png->hasPalette = true;
+        png->palette.numColors = numColors;
 
-    image->width = png_get_image_width(png_ptr, info_ptr);
-    image->height = png_get_image_height(png_ptr, info_ptr);
+        for (int i = 0; i < numColors; i++) {
+            png->palette.colors[i].red = colors[i].red;
+            png->palette.colors[i].green = colors[i].green;
+            png->palette.colors[i].blue = colors[i].blue;
+        }
+    }
 
-    int rowbytes = png_get_rowbytes(png_ptr, info_ptr);
+    // Only palette and grayscale images are converted, so don't bother
+    // reading anything else.
+    if (!paletteOnly && (png->colorType == PNG_COLOR_TYPE_GRAY || png->colorType == PNG_COLOR_TYPE_PALETTE))
+    {
+        png->pixels = malloc((size_t)png->height * png->rowBytes);
 
-    image->pixels = malloc(image->height * rowbytes);
+        if (png->pixels == NULL)
+            FATAL_ERROR("Failed to allocate pixel buffer.\n");
 
-    if (image->pixels == NULL)
-        FATAL_ERROR("Failed to allocate pixel buffer.\n");
+        png_bytepp row_pointers = malloc(png->height * sizeof(png_bytep));
 
-    png_bytepp row_pointers = malloc(image->height * sizeof(png_bytep));
+        if (row_pointers == NULL)
+            FATAL_ERROR("Failed to allocate row pointers.\n");
 
-    if (row_pointers == NULL)
-        FATAL_ERROR("Failed to allocate row pointers.\n");
+        for (int i = 0; i < png->height; i++)
+            row_pointers[i] = (png_bytep)(png->pixels + (i * png->rowBytes));
 
-    for (int i = 0; i < image->height; i++)
-        row_pointers[i] = (png_bytep)(image->pixels + (i * rowbytes));
+        if (setjmp(png_jmpbuf(png_ptr)))
+            FATAL_ERROR("Error reading from \"%s\".\n", path);
 
-    if (setjmp(png_jmpbuf(png_ptr)))
-        FATAL_ERROR("Error reading from \"%s\".\n", path);
+        png_read_image(png_ptr, row_pointers);
 
-    png_read_image(png_ptr, row_pointers);
+        free(row_pointers);
+    }
 
     png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
 
-    free(row_pointers);
     fclose(fp);
+}
+
+static void DecodePng(char *path, bool paletteOnly, bool builtin, struct DecodedPng *png)
+{
+    if (builtin)
+    {
+        int fileSize;
+        unsigned char *data = ReadWholeFile(path, &fileSize);
+        bool decoded = DecodeIndexedPng(path, data, fileSize, paletteOnly, png);
+
+        free(data);
+
+        if (decoded)
+            return;
+    }
+
+    DecodePngWithLibpng(path, paletteOnly, png);
+}
+
+// Batch conversions often read the same PNG twice in a row, once for its
+// tiles and once for its palette, so each thread keeps the last image it
+// decoded. Writing any PNG invalidates every thread's copy.
+static bool sPngCacheEnabled;
+static atomic_uint sPngWriteCount;
+
+static _Thread_local struct
+{
+    char *path;
+    unsigned writeCount;
+    struct DecodedPng png;
+} sLastPng;
+
+void SetPngCacheEnabled(bool enabled)
+{
+    sPngCacheEnabled = enabled;
+}
+
+static unsigned char *DuplicatePixels(const struct DecodedPng *png)
+{
+    size_t size = (size_t)png->height * png->rowBytes;
+    unsigned char *pixels = malloc(size);
+
+    if (pixels == NULL)
+        FATAL_ERROR("Failed to allocate pixel buffer.\n");
+
+    memcpy(pixels, png->pixels, size);
+    return pixels;
+}
+
+// Decodes a PNG, or takes it from the cache. The caller owns png->pixels.
+static void LoadPng(char *path, bool paletteOnly, struct DecodedPng *png)
+{
+    if (!sPngCacheEnabled)
+    {
+        DecodePng(path, paletteOnly, UseBuiltinDecoder(), png);
+        return;
+    }
+
+    unsigned writeCount = atomic_load(&sPngWriteCount);
+
+    if (sLastPng.path == NULL || strcmp(sLastPng.path, path) != 0 || sLastPng.writeCount != writeCount
+     || (sLastPng.png.pixels == NULL && !paletteOnly))
+    {
+        free(sLastPng.path);
+        free(sLastPng.png.pixels);
+
+        // Decode the pixels even for a palette, since they are likely to be
+        // wanted next.
+        DecodePng(path, false, UseBuiltinDecoder(), &sLastPng.png);
+        sLastPng.path = malloc(strlen(path) + 1);
+
+        if (sLastPng.path == NULL)
+            FATAL_ERROR("Failed to allocate path.\n");
+
+        strcpy(sLastPng.path, path);
+        sLastPng.writeCount = writeCount;
+    }
+
+    *png = sLastPng.png;
+    png->pixels = (paletteOnly || png->pixels == NULL) ? NULL : DuplicatePixels(&sLastPng.png);
+}
+
+void ReadPng(char *path, struct Image *image)
+{
+    struct DecodedPng png;
+
+    LoadPng(path, false, &png);
+
+    int bit_depth = png.bitDepth;
+
+    if (png.colorType != PNG_COLOR_TYPE_GRAY && png.colorType != PNG_COLOR_TYPE_PALETTE)
+        FATAL_ERROR("\"%s\" has an unsupported color type.\n", path);
+
+    // Check if the image has a palette so that we can tell if the colors need to be inverted later.
+    image->hasPalette = (png.colorType == PNG_COLOR_TYPE_PALETTE);
+
+    if (png.hasPalette)
+        image->palette = png.palette;
+
+    image->width = png.width;
+    image->height = png.height;
+    image->pixels = png.pixels;
 
     if (bit_depth != image->bitDepth && image->tilemap.data.affine == NULL)
     {
@@ -139,32 +272,141 @@ void ReadPng(char *path, struct Image *image)
 
 void ReadPngPalette(char *path, struct Palette *palette)
 {
-    png_structp png_ptr;
-    png_infop info_ptr;
-    png_colorp colors;
-    int numColors;
+    struct DecodedPng png;
 
-    FILE *fp = PngReadOpen(path, &png_ptr, &info_ptr);
+    LoadPng(path, true, &png);
+    free(png.pixels);
 
-    if (png_get_color_type(png_ptr, info_ptr) != PNG_COLOR_TYPE_PALETTE)
+    if (png.colorType != PNG_COLOR_TYPE_PALETTE)
         FATAL_ERROR("The image \"%s\" does not contain a palette.\n", path);
 
-    if (png_get_PLTE(png_ptr, info_ptr, &colors, &numColors) != PNG_INFO_PLTE)
+    if (!png.hasPalette)
         FATAL_ERROR("Failed to retrieve palette from \"%s\".\n", path);
 
-    if (numColors > 256)
-        FATAL_ERROR("Images with more than 256 colors are not supported.\n");
+    *palette = png.palette;
+}
+
+static void CheckPngsAgree(char *path, const char *what, const struct DecodedPng *builtin, const struct DecodedPng *reference)
+{
+    size_t size = (size_t)reference->height * reference->rowBytes;
+
+    if (builtin->width != reference->width || builtin->height != reference->height
+     || builtin->bitDepth != reference->bitDepth || builtin->colorType != reference->colorType
+     || builtin->rowBytes != reference->rowBytes || builtin->hasPalette != reference->hasPalette
+     || (builtin->pixels == NULL) != (reference->pixels == NULL)
+     || (reference->pixels != NULL && memcmp(builtin->pixels, reference->pixels, size) != 0))
+        FATAL_ERROR("The PNG decoders disagree about %s\"%s\".\n", what, path);
 
-    palette->numColors = numColors;
-    for (int i = 0; i < numColors; i++) {
-        palette->colors[i].red = colors[i].red;
-        palette->colors[i].green = colors[i].green;
-        palette->colors[i].blue = colors[i].blue;
+    if (reference->hasPalette)
+    {
+        if (builtin->palette.numColors != reference->palette.numColors
+         || memcmp(builtin->palette.colors, reference->palette.colors, reference->palette.numColors * sizeof(struct Color)) != 0)
+            FATAL_ERROR("The PNG decoders disagree about the palette of %s\"%s\".\n", what, path);
     }
+}
 
-    png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
+static void WriteBigEndian32(unsigned char *dest, uint32_t value)
+{
+    dest[0] = value >> 24;
+    dest[1] = value >> 16;
+    dest[2] = value >> 8;
+    dest[3] = value;
+}
 
-    fclose(fp);
+// Copies a PNG with its image data split into IDAT chunks of at most
+// maxChunkSize bytes, as some encoders write it. Returns NULL if the file
+// isn't laid out as a PNG.
+static unsigned char *SplitIdatChunks(const unsigned char *data, int size, int maxChunkSize, int *newSize)
+{
+    unsigned char *dest = malloc(size + (size / maxChunkSize + 1) * 12);
+    int pos = 8;
+    int destPos = 8;
+
+    if (dest == NULL)
+        FATAL_ERROR("Failed to allocate PNG buffer.\n");
+
+    if (size < 8)
+    {
+        free(dest);
+        return NULL;
+    }
+
+    memcpy(dest, data, 8);
+
+    while (pos + 12 <= size)
+    {
+        uint32_t length = ((uint32_t)data[pos] << 24) | (data[pos + 1] << 16) | (data[pos + 2] << 8) | data[pos + 3];
+        const unsigned char *type = data + pos + 4;
+
+        if (length > (uint32_t)(size - pos - 12))
+        {
+            free(dest);
+            return NULL;
+        }
+
+        if (memcmp(type, "IDAT", 4) == 0)
+        {
+            for (uint32_t offset = 0; offset < length; offset += maxChunkSize)
+            {
+                uint32_t pieceSize = length - offset < (uint32_t)maxChunkSize ? length - offset : (uint32_t)maxChunkSize;
+
+                WriteBigEndian32(dest + destPos, pieceSize);
+                memcpy(dest + destPos + 4, "IDAT", 4);
+                memcpy(dest + destPos + 8, type + 4 + offset, pieceSize);
+                WriteBigEndian32(dest + destPos + 8 + pieceSize, crc32(0, dest + destPos + 4, pieceSize + 4));
+                destPos += pieceSize + 12;
+            }
+        }
+        else
+        {
+            memcpy(dest + destPos, data + pos, length + 12);
+            destPos += length + 12;
+        }
+
+        pos += length + 12;
+    }
+
+    *newSize = destPos;
+    return dest;
+}
+
+// Decodes a PNG with both the built-in decoder and libpng, checks that they
+// agree, and adds up the time each took. The built-in decoder is also run,
+// from empty scratch buffers, on a copy with the image data spread over
+// many small IDAT chunks.
+void BenchmarkPngFile(char *path, double *builtinSeconds, double *libpngSeconds, long long *totalBytes)
+{
+    struct DecodedPng builtin;
+    struct DecodedPng reference;
+
+    clock_t start = clock();
+    DecodePng(path, false, true, &builtin);
+    *builtinSeconds += (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    DecodePng(path, false, false, &reference);
+    *libpngSeconds += (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    CheckPngsAgree(path, "", &builtin, &reference);
+    *totalBytes += (size_t)reference.height * reference.rowBytes;
+    free(builtin.pixels);
+
+    int fileSize;
+    int splitSize;
+    unsigned char *data = ReadWholeFile(path, &fileSize);
+    unsigned char *split = SplitIdatChunks(data, fileSize, 64, &splitSize);
+
+    FreePngDecodeScratch();
+
+    if (split != NULL && DecodeIndexedPng(path, split, splitSize, false, &builtin))
+    {
+        CheckPngsAgree(path, "the split-IDAT copy of ", &builtin, &reference);
+        free(builtin.pixels);
+    }
+
+    free(split);
+    free(data);
+    free(reference.pixels);
 }
 
 void SetPngPalette(png_structp png_ptr, png_infop info_ptr, struct Palette *palette)
@@ -187,6 +429,8 @@ void SetPngPalette(png_structp png_ptr, png_infop info_ptr, struct Palette *pale
 
 void WritePng(char *path, struct Image *image)
 {
+    atomic_fetch_add(&sPngWriteCount, 1);
+
     FILE *fp = fopen(path, "wb");
 
     if (fp == NULL)
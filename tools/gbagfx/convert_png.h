@@ -8,5 +8,7 @@
 void ReadPng(char *path, struct Image *image);
 void WritePng(char *path, struct Image *image);
 void ReadPngPalette(char *path, struct Palette *palette);
+void SetPngCacheEnabled(bool enabled);
+void BenchmarkPngFile(char *path, double *builtinSeconds, double *libpngSeconds, long long *totalBytes);
 
 #endif // CONVERT_PNG_H
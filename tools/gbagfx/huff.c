@@ -1,215 +1,282 @@
 #include <stdbool.h>
 #include <string.h>
-#include <assert.h>
 #include <stdio.h>
 #include <stdint.h>
 #include "global.h"
 #include "huff.h"
 
-static int cmp_tree(const void * a0, const void * b0) {
-    return ((struct HuffData *)a0)->value - ((struct HuffData *)b0)->value;
+// Number of bits the decoder resolves with one table lookup.
+#define HUFF_LOOKUP_BITS 10
+
+// Longest code the encoder will emit. The GBA reads the bitstream a word at
+// a time, so anything longer can't be decoded anyway.
+#define HUFF_MAX_CODE_BITS 32
+
+struct HuffNode {
+    uint32_t value;
+    int seq;
+    int left;
+    int right;
+    unsigned char key;
+};
+
+struct HuffCode {
+    uint64_t bits;
+    int length;
+};
+
+struct HuffLookup {
+    uint16_t treePos;
+    uint8_t length;
+    uint8_t isLeaf;
+};
+
+// Nodes are ordered by frequency, then by creation order: leaves by key, and
+// branches after all leaves in the order they were made, so that the code
+// lengths don't depend on the heap's internal order.
+static bool node_less(const struct HuffNode * nodes, int a, int b) {
+    if (nodes[a].value != nodes[b].value)
+        return nodes[a].value < nodes[b].value;
+    return nodes[a].seq < nodes[b].seq;
 }
 
-typedef int (*cmpfun)(const void *, const void *);
-
-int msort_r(void * data, size_t count, size_t size, cmpfun cmp, void * buffer) {
-    /*
-     * Out-of-place mergesort (stable sort)
-     * Returns 1 on success, 0 on failure
-     */
-    void * leftPtr;
-    void * rightPtr;
-    void * leftEnd;
-    void * rightEnd;
-    int i;
-
-    switch (count) {
-    case 0:
-        // Should never be here
-        return 0;
-
-    case 1:
-        // Nothing to do here
-        break;
-
-    case 2:
-        // Swap the two entries if the right one compares higher.
-        if (cmp(data, data + size) > 0) {
-            memcpy(buffer, data, size);
-            memcpy(data, data + size, size);
-            memcpy(data + size, buffer, size);
-        }
-        break;
-    default:
-        // Merge sort out-of-place.
-        leftPtr = data;
-        leftEnd = rightPtr = data + count / 2 * size;
-        rightEnd = data + count * size;
-
-        // Sort the left half
-        if (!msort_r(leftPtr, count / 2, size, cmp, buffer))
-            return 0;
-
-        // Sort the right half
-        if (!msort_r(rightPtr, count / 2 + (count & 1), size, cmp, buffer))
-            return 0;
-
-        // Merge the sorted halves out of place
-        i = 0;
-        do {
-            if (cmp(leftPtr, rightPtr) <= 0) {
-                memcpy(buffer + i * size, leftPtr, size);
-                leftPtr += size;
-            } else {
-                memcpy(buffer + i * size, rightPtr, size);
-                rightPtr += size;
-            }
+static void heap_push(int * heap, int * heapSize, const struct HuffNode * nodes, int node) {
+    int i = (*heapSize)++;
 
-        } while (++i < count && leftPtr < leftEnd && rightPtr < rightEnd);
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!node_less(nodes, node, heap[parent]))
+            break;
+        heap[i] = heap[parent];
+        i = parent;
+    }
 
-        // Copy the remainder
-        if (i < count) {
-            if (leftPtr < leftEnd) {
-                memcpy(buffer + i * size, leftPtr, leftEnd - leftPtr);
-            }
-            else {
-                memcpy(buffer + i * size, rightPtr, rightEnd - rightPtr);
-            }
-        }
+    heap[i] = node;
+}
+
+static int heap_pop(int * heap, int * heapSize, const struct HuffNode * nodes) {
+    int top = heap[0];
+    int last = heap[--(*heapSize)];
+    int i = 0;
+
+    for (;;) {
+        int child = i * 2 + 1;
+        if (child >= *heapSize)
+            break;
+        if (child + 1 < *heapSize && node_less(nodes, heap[child + 1], heap[child]))
+            child++;
+        if (!node_less(nodes, heap[child], last))
+            break;
+        heap[i] = heap[child];
+        i = child;
+    }
+
+    if (*heapSize > 0)
+        heap[i] = last;
+
+    return top;
+}
 
-        // Copy the merged data back
-        memcpy(data, buffer, count * size);
-        break;
+// Builds the tree and returns the index of its root. nodes must have room
+// for 2 * nitems - 1 entries.
+static int build_tree(struct HuffNode * nodes, const uint32_t * freqs, int nitems) {
+    int heap[512];
+    int heapSize = 0;
+    int nnodes = 0;
+
+    for (int i = 0; i < nitems; i++) {
+        if (freqs[i] == 0)
+            continue;
+        nodes[nnodes] = (struct HuffNode){ freqs[i], i, -1, -1, i };
+        heap_push(heap, &heapSize, nodes, nnodes++);
     }
 
-    return 1;
+    // The tree needs a branch at its root, so a lone value gets a sibling.
+    for (int i = 0; heapSize < 2; i++) {
+        if (freqs[i] != 0)
+            continue;
+        nodes[nnodes] = (struct HuffNode){ 0, i, -1, -1, i };
+        heap_push(heap, &heapSize, nodes, nnodes++);
+    }
+
+    // Iteratively collapse the two least frequent nodes.
+    for (int seq = nitems; heapSize > 1; seq++) {
+        int right = heap_pop(heap, &heapSize, nodes);
+        int left = heap_pop(heap, &heapSize, nodes);
+        nodes[nnodes] = (struct HuffNode){ nodes[left].value + nodes[right].value, seq, left, right, 0 };
+        heap_push(heap, &heapSize, nodes, nnodes++);
+    }
+
+    return heap[0];
 }
 
-int msort(void * data, size_t count, size_t size, cmpfun cmp) {
-    void * buffer = malloc(count * size);
-    if (buffer == NULL) return 0;
-    int result = msort_r(data, count, size, cmp, buffer);
-    free(buffer);
-    return result;
+// Finds the length of each value's code from its depth in the tree.
+static void get_code_lengths(const struct HuffNode * nodes, int node, int depth, int * lengths) {
+    if (nodes[node].left < 0) {
+        lengths[nodes[node].key] = depth;
+        return;
+    }
+
+    get_code_lengths(nodes, nodes[node].left, depth + 1, lengths);
+    get_code_lengths(nodes, nodes[node].right, depth + 1, lengths);
 }
 
-static void write_tree(unsigned char * dest, HuffNode_t * tree, int nitems, struct BitEncoding * encoding) {
-    /*
-     * The example used to guide this function encodes the tree in a
-     * breadth-first manner.  We attempt to emulate that here.
-     */
+// The latest pair of table slots that the children of the node in slot
+// index can go in, given that the offset to them is only 6 bits.
+static inline int last_child_pair(int index) {
+    return (index + 1) / 2 + 0x3F;
+}
 
-    int i, j, k;
+// Checks whether every pending branch but pending[skip] could still have its
+// children placed in time, if pending[skip]'s children went in pair next.
+// Pending branches are kept in the order they were placed, so their
+// deadlines are in order too; the children of pending[skip] are placed last.
+static bool can_place_first(const int * pending, int numPending, int skip, const int * slots, const int * leftChild, int next) {
+    int pair = next + 1;
+
+    for (int i = 0; i < numPending; i++) {
+        if (i == skip)
+            continue;
+        if (last_child_pair(slots[pending[i]]) < pair)
+            return false;
+        pair++;
+    }
 
-    // There are (2 * nitems - 1) nodes in the binary tree.  Allocate that.
-    HuffNode_t * traversal = calloc(2 * nitems - 1, sizeof(HuffNode_t));
-    if (traversal == NULL)
-        FATAL_ERROR("Fatal error while compressing Huff file.\n");
+    int child = leftChild[pending[skip]];
 
-    // The first node is the root of the tree.
-    traversal[0] = *tree;
-    i = 1;
-
-    // Copy the tree into a breadth-first ordering using brute force.
-    for (int depth = 1; i < 2 * nitems - 1; depth++) {
-        // Consider every possible path up to the current depth.
-        for (j = 0; i < 2 * nitems - 1 && j < 1 << depth; j++) {
-            // The index of the path is used to encode the path itself.
-            // Start from the most significant relevant bit and work our way down.
-            // Keep track of the current and previous nodes.
-            HuffNode_t * currNode = traversal;
-            HuffNode_t * parent = NULL;
-            for (k = 0; k < depth; k++) {
-                if (currNode->header.isLeaf)
-                    break;
-                parent = currNode;
-                if ((j >> (depth - k - 1)) & 1)
-                    currNode = currNode->branch.right;
-                else
-                    currNode = currNode->branch.left;
-            }
-            // Check that the length of the current path equals the current depth.
-            if (k == depth) {
-                // Make sure we can encode the current branch.
-                // Bail here if we cannot.
-                // This is only applicable for 8-bit encodings.
-                if (traversal + i - parent > 128)
-                    FATAL_ERROR("Fatal error while compressing Huff file: unable to encode binary tree.\n");
-                // Copy the current node, and update its parent.
-                traversal[i] = *currNode;
-                if (parent != NULL) {
-                    if ((j & 1) == 1)
-                        parent->branch.right = traversal + i;
-                    else
-                        parent->branch.left = traversal + i;
-                }
-                // Encode the path through the tree in the lookup table
-                if (traversal[i].header.isLeaf) {
-                    encoding[traversal[i].leaf.key].nbits = depth;
-                    encoding[traversal[i].leaf.key].bitstring = j;
-                }
-                i++;
+    for (int i = 0; i < 2; i++) {
+        if (leftChild[child + i] >= 0) {
+            if (last_child_pair(next * 2 + 1 + i) < pair)
+                return false;
+            pair++;
+        }
+    }
+
+    return true;
+}
+
+// Assigns canonical codes from the code lengths and writes the matching tree.
+// Canonical codes put each level's leaves before its branches. The tree
+// table is then filled one pair of children at a time: depth first, which
+// keeps children next to their parent, except when a branch waiting for its
+// children would otherwise end up out of reach of them.
+// Returns the size of the tree table, including the size byte, or -1 with
+// *error_p set if the tree can't be encoded.
+static int write_tree(unsigned char * dest, const int * lengths, int nitems, struct HuffCode * codes, const char ** error_p) {
+    int numLeaves[HUFF_MAX_CODE_BITS + 2] = {0};
+    int maxLength = 0;
+
+    for (int i = 0; i < nitems; i++) {
+        if (lengths[i] > HUFF_MAX_CODE_BITS) {
+            *error_p = "tree is too deep";
+            return -1;
+        }
+        numLeaves[lengths[i]]++;
+        if (lengths[i] > maxLength)
+            maxLength = lengths[i];
+    }
+
+    // The root is never a leaf.
+    numLeaves[0] = 0;
+
+    // Number the nodes level by level. A leaf has a key and no children.
+    int keys[511];
+    int leftChild[511];
+    int levelStart = 0;
+    int levelSize = 1;
+    uint64_t firstCode = 0;
+
+    for (int depth = 0; depth <= maxLength; depth++) {
+        int nextLevelStart = levelStart + levelSize;
+        int leaves = numLeaves[depth];
+        int nextLeaf = 0;
+
+        for (int i = 0; i < levelSize; i++) {
+            int node = levelStart + i;
+
+            if (i < leaves) {
+                // Leaves take the values of this length in order.
+                while (lengths[nextLeaf] != depth)
+                    nextLeaf++;
+                keys[node] = nextLeaf;
+                leftChild[node] = -1;
+                codes[nextLeaf] = (struct HuffCode){ firstCode + i, depth };
+                nextLeaf++;
+            } else {
+                leftChild[node] = nextLevelStart + (i - leaves) * 2;
             }
         }
+
+        firstCode = (firstCode + leaves) << 1;
+        levelSize = (levelSize - leaves) * 2;
+        levelStart = nextLevelStart;
     }
 
-    // Encode the size of the tree.
-    // This is used by the decompressor to skip the tree.
-    dest[4] = nitems - 1;
+    int count = levelStart;
+    int slots[511];
+    int pending[256];
+    int numPending = 1;
 
-    // Encode each node in the tree.
-    for (i = 0; i < 2 * nitems - 1; i++) {
-        HuffNode_t * currNode = traversal + i;
-        if (currNode->header.isLeaf) {
-            dest[5 + i] = traversal[i].leaf.key;
-        } else {
-            dest[5 + i] = (((currNode->branch.right - traversal - i) / 2) - 1);
-            if (currNode->branch.left->header.isLeaf)
-                dest[5 + i] |= 0x80;
-            if (currNode->branch.right->header.isLeaf)
-                dest[5 + i] |= 0x40;
+    slots[0] = 0;
+    pending[0] = 0;
+
+    for (int pair = 0; numPending > 0; pair++) {
+        int choice = numPending - 1;
+
+        if (!can_place_first(pending, numPending, choice, slots, leftChild, pair))
+            choice = 0;
+
+        int parent = pending[choice];
+        int left = pair * 2 + 1;
+        int offset = (left + 1 - slots[parent]) / 2 - 1;
+
+        if (offset > 0x3F) {
+            *error_p = "unable to encode binary tree";
+            return -1;
+        }
+
+        memmove(&pending[choice], &pending[choice + 1], (numPending - choice - 1) * sizeof(int));
+        numPending--;
+
+        dest[5 + slots[parent]] = offset;
+
+        for (int i = 0; i < 2; i++) {
+            int child = leftChild[parent] + i;
+
+            slots[child] = left + i;
+
+            if (leftChild[child] < 0) {
+                dest[5 + slots[child]] = keys[child];
+                dest[5 + slots[parent]] |= 0x80 >> i;
+            } else {
+                pending[numPending++] = child;
+            }
         }
     }
 
-    free(traversal);
-}
+    // Pad the table so that the bitstream starts on a word boundary.
+    int tableSize = (count + 1 + 3) & ~3;
 
-static inline void write_32_le(unsigned char * dest, int * destPos, uint32_t * buff, int * buffPos) {
-    dest[*destPos] = *buff;
-    dest[*destPos + 1] = *buff >> 8;
-    dest[*destPos + 2] = *buff >> 16;
-    dest[*destPos + 3] = *buff >> 24;
-    *destPos += 4;
-    *buff = 0;
-    *buffPos = 0;
+    for (int i = count + 1; i < tableSize; i++)
+        dest[4 + i] = 0;
+
+    // Encode the size of the tree.
+    // This is used by the decompressor to skip the tree.
+    dest[4] = tableSize / 2 - 1;
+
+    return tableSize;
 }
 
-static inline void read_32_le(unsigned char * src, int * srcPos, uint32_t * buff) {
-    uint32_t tmp = src[*srcPos];
-    tmp |= src[*srcPos + 1] << 8;
-    tmp |= src[*srcPos + 2] << 16;
-    tmp |= src[*srcPos + 3] << 24;
-    *srcPos += 4;
-    *buff = tmp;
+static inline void write_32_le(unsigned char * dest, int * destPos, uint32_t value) {
+    dest[*destPos] = value;
+    dest[*destPos + 1] = value >> 8;
+    dest[*destPos + 2] = value >> 16;
+    dest[*destPos + 3] = value >> 24;
+    *destPos += 4;
 }
 
-static void write_bits(unsigned char * dest, int * destPos, struct BitEncoding * encoding, int value, uint32_t * buff, int * buffBits) {
-    int nbits = encoding[value].nbits;
-    uint32_t bitstring = encoding[value].bitstring;
-
-    if (*buffBits + nbits >= 32) {
-        int diff = *buffBits + nbits - 32;
-        *buff <<= nbits - diff;
-        *buff |= bitstring >> diff;
-        bitstring &= ~(1 << diff);
-        nbits = diff;
-        write_32_le(dest, destPos, buff, buffBits);
-    }
-    if (nbits != 0) {
-        *buff <<= nbits;
-        *buff |= bitstring;
-        *buffBits += nbits;
-    }
+static inline uint32_t read_32_le(const unsigned char * src) {
+    return src[0] | (src[1] << 8) | (src[2] << 16) | ((uint32_t)src[3] << 24);
 }
 
 /*
@@ -218,132 +285,143 @@ MAIN COMPRESSION/DECOMPRESSION ROUTINES
 =======================================
  */
 
-unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedSize_p, int bitDepth) {
-    if (srcSize <= 0)
-        goto fail;
+unsigned char * HuffTryCompress(unsigned char * src, int srcSize, int * compressedSize_p, int bitDepth, const char ** error_p) {
+    *error_p = NULL;
 
-    int worstCaseDestSize = 4 + (2 << bitDepth) + srcSize * 3;
-
-    unsigned char *dest = malloc(worstCaseDestSize);
-    if (dest == NULL)
-        goto fail;
+    if (srcSize <= 0)
+        return NULL;
 
     int nitems = 1 << bitDepth;
-
-    HuffNode_t * freqs = calloc(nitems, sizeof(HuffNode_t));
-    if (freqs == NULL)
-        goto fail;
-
-    struct BitEncoding * encoding = calloc(nitems, sizeof(struct BitEncoding));
-    if (encoding == NULL)
-        goto fail;
-
-    // Set up the frequencies table.  This will inform the tree.
-    for (int i = 0; i < nitems; i++) {
-        freqs[i].header.isLeaf = 1;
-        freqs[i].header.value = 0;
-        freqs[i].leaf.key = i;
-    }
+    uint32_t freqs[256] = {0};
 
     // Count each nybble or byte.
     for (int i = 0; i < srcSize; i++) {
         if (bitDepth == 8) {
-            freqs[src[i]].header.value++;
+            freqs[src[i]]++;
         } else {
-            freqs[src[i] >> 4].header.value++;
-            freqs[src[i] & 0xF].header.value++;
+            freqs[src[i] >> 4]++;
+            freqs[src[i] & 0xF]++;
         }
     }
 
 #ifdef DEBUG
     for (int i = 0; i < nitems; i++) {
-        fprintf(stderr, "%d: %d\n", i, freqs[i].header.value);
+        fprintf(stderr, "%d: %d\n", i, freqs[i]);
     }
 #endif // DEBUG
 
-    // Sort the frequency table.
-    if (!msort(freqs, nitems, sizeof(HuffNode_t), cmp_tree))
-        goto fail;
+    // No byte takes more than 32 bits to encode.
+    int worstCaseDestSize = 4 + 2 * nitems + 2 + srcSize * 4 + 4;
 
-    // Prune zero-frequency values.
-    for (int i = 0; i < nitems; i++) {
-        if (freqs[i].header.value != 0) {
-            if (i > 0) {
-                for (int j = i; j < nitems; j++) {
-                    freqs[j - i] = freqs[j];
-                }
-                nitems -= i;
-            }
-            break;
-        }
-        // This should never happen:
-        if (i == nitems - 1)
-            goto fail;
-    }
+    unsigned char *dest = malloc(worstCaseDestSize);
+    if (dest == NULL)
+        return NULL;
 
-    HuffNode_t * tree = calloc(nitems * 2 - 1, sizeof(HuffNode_t));
-    if (tree == NULL)
-        goto fail;
+    struct HuffNode nodes[511];
+    struct HuffCode codes[256] = {{0}};
+    int lengths[256] = {0};
 
-    // Iteratively collapse the two least frequent nodes.
-    HuffNode_t * endptr = freqs + nitems - 2;
-
-    for (int i = 0; i < nitems - 1; i++) {
-        HuffNode_t * left = freqs;
-        HuffNode_t * right = freqs + 1;
-        tree[i * 2] = *right;
-        tree[i * 2 + 1] = *left;
-        for (int j = 0; j < nitems - i - 2; j++)
-            freqs[j] = freqs[j + 2];
-        endptr->header.isLeaf = 0;
-        endptr->header.value = tree[i * 2].header.value + tree[i * 2 + 1].header.value;
-        endptr->branch.left = tree + i * 2;
-        endptr->branch.right = tree + i * 2 + 1;
-        endptr--;
-        if (i < nitems - 2 && !msort(freqs, nitems - i - 1, sizeof(HuffNode_t), cmp_tree))
-            goto fail;
-    }
+    get_code_lengths(nodes, build_tree(nodes, freqs, nitems), 0, lengths);
+
+    int treeSize = write_tree(dest, lengths, nitems, codes, error_p);
 
-    // Write the tree breadth-first, and create the path lookup table.
-    write_tree(dest, freqs, nitems, encoding);
+    if (treeSize < 0) {
+        free(dest);
+        return NULL;
+    }
 
-    free(tree);
-    free(freqs);
+    int destPos = 4 + treeSize;
 
-    // Encode the data itself.
-    int destPos = 4 + nitems * 2;
-    uint32_t destBuf = 0;
-    uint32_t srcBuf = 0;
-    int destBitPos = 0;
+    // Precompute the code for every byte, so that 4-bit data takes one step
+    // per byte rather than one per nybble. The low nybble comes first.
+    struct HuffCode byteCodes[256];
 
-    for (int srcPos = 0; srcPos < srcSize;) {
-        read_32_le(src, &srcPos, &srcBuf);
-        for (int i = 0; i < 32 / bitDepth; i++) {
-            write_bits(dest, &destPos, encoding, srcBuf & (0xFF >> (8 - bitDepth)), &destBuf, &destBitPos);
-            srcBuf >>= bitDepth;
+    for (int i = 0; i < 256; i++) {
+        if (bitDepth == 8) {
+            byteCodes[i] = codes[i];
+        } else {
+            struct HuffCode low = codes[i & 0xF];
+            struct HuffCode high = codes[i >> 4];
+            byteCodes[i].bits = (low.bits << high.length) | high.bits;
+            byteCodes[i].length = low.length + high.length;
         }
     }
 
-    if (destBitPos != 0) {
-        write_32_le(dest, &destPos, &destBuf, &destBitPos);
+    // Encode the data itself, most significant bit first within each word.
+    uint64_t bitBuf = 0;
+    int bitCount = 0;
+
+    for (int i = 0; i < srcSize; i++) {
+        const struct HuffCode * code = &byteCodes[src[i]];
+
+        bitBuf = (bitBuf << code->length) | code->bits;
+        bitCount += code->length;
+
+        while (bitCount >= 32) {
+            bitCount -= 32;
+            write_32_le(dest, &destPos, bitBuf >> bitCount);
+        }
     }
 
-    free(encoding);
+    if (bitCount != 0)
+        write_32_le(dest, &destPos, bitBuf << (32 - bitCount));
 
     // Write the header.
     dest[0] = bitDepth | 0x20;
     dest[1] = srcSize;
     dest[2] = srcSize >> 8;
     dest[3] = srcSize >> 16;
-    *compressedSize_p = (destPos + 3) & ~3;
+    *compressedSize_p = destPos;
     return dest;
+}
 
-fail:
-    FATAL_ERROR("Fatal error while compressing Huff file.\n");
+unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedSize_p, int bitDepth) {
+    const char * error;
+    unsigned char * dest = HuffTryCompress(src, srcSize, compressedSize_p, bitDepth, &error);
+
+    if (dest == NULL) {
+        if (error != NULL)
+            FATAL_ERROR("Fatal error while compressing Huff file: %s.\n", error);
+        FATAL_ERROR("Fatal error while compressing Huff file.\n");
+    }
+
+    return dest;
+}
+
+// Follows one bit from the tree node at treePos. Returns the position of the
+// child, and sets *isLeaf if the child holds a value.
+static inline int follow_bit(const unsigned char * src, int treePos, int bit, bool * isLeaf) {
+    unsigned char treeView = src[treePos];
+    *isLeaf = ((treeView << bit) & 0x80) != 0;
+    return (treePos & ~1) + ((treeView & 0x3F) + 1) * 2 + bit;
+}
+
+// For every possible run of HUFF_LOOKUP_BITS bits, records the value they
+// start with and its length, or else the node they lead to.
+static bool build_lookup(const unsigned char * src, int treeEnd, struct HuffLookup * lookup) {
+    for (int i = 0; i < (1 << HUFF_LOOKUP_BITS); i++) {
+        int treePos = 5;
+        bool isLeaf = false;
+        int length = 0;
+
+        while (length < HUFF_LOOKUP_BITS && !isLeaf) {
+            int bit = (i >> (HUFF_LOOKUP_BITS - 1 - length)) & 1;
+            treePos = follow_bit(src, treePos, bit, &isLeaf);
+            length++;
+            if (treePos >= treeEnd)
+                return false;
+        }
+
+        lookup[i].treePos = treePos;
+        lookup[i].length = length;
+        lookup[i].isLeaf = isLeaf;
+    }
+
+    return true;
 }
 
 unsigned char * HuffDecompress(unsigned char * src, int srcSize, int * uncompressedSize_p) {
-    if (srcSize < 4)
+    if (srcSize < 5)
         goto fail;
 
     int bitDepth = *src & 15;
@@ -357,42 +435,78 @@ unsigned char * HuffDecompress(unsigned char * src, int srcSize, int * uncompres
     if (dest == NULL)
         goto fail;
 
-    int treePos = 5;
     int treeSize = (src[4] + 1) * 2;
-    int srcPos = 4 + treeSize;
+    int treeEnd = 4 + treeSize;
+    int srcPos = treeEnd;
+    struct HuffLookup lookup[1 << HUFF_LOOKUP_BITS];
+
+    if (treeEnd > srcSize || !build_lookup(src, treeEnd, lookup))
+        goto fail;
+
+    // The bitstream is read a word at a time into the top of bitBuf.
+    uint64_t bitBuf = 0;
+    int bitCount = 0;
+    int valuesPerByte = 8 / bitDepth;
     int destPos = 0;
-    int curValPos = 0;
-    uint32_t destTmp = 0;
-    uint32_t window;
-
-    for (;;)
-    {
-        if (srcPos >= srcSize)
-            goto fail;
-        read_32_le(src, &srcPos, &window);
-        for (int i = 0; i < 32; i++) {
-            int curBit = (window >> 31) & 1;
-            unsigned char treeView = src[treePos];
-            bool isLeaf = ((treeView << curBit) & 0x80) != 0;
-            treePos &= ~1; // align
-            treePos += ((treeView & 0x3F) + 1) * 2 + curBit;
-            if (isLeaf) {
-                destTmp >>= bitDepth;
-                destTmp |= (src[treePos] << (32 - bitDepth));
-                curValPos++;
-                if (curValPos == 32 / bitDepth) {
-                    write_32_le(dest, &destPos, &destTmp, &curValPos);
-                    if (destPos == destSize) {
-                        *uncompressedSize_p = destSize;
-                        return dest;
-                    }
+    int curVal = 0;
+    unsigned char destByte = 0;
+
+    while (destPos < destSize) {
+        if (bitCount <= 32 && srcPos + 4 <= srcSize) {
+            bitBuf |= (uint64_t)read_32_le(src + srcPos) << (32 - bitCount);
+            bitCount += 32;
+            srcPos += 4;
+        }
+
+        const struct HuffLookup * entry = &lookup[bitBuf >> (64 - HUFF_LOOKUP_BITS)];
+        int treePos;
+
+        if (entry->isLeaf && entry->length <= bitCount) {
+            treePos = entry->treePos;
+            bitBuf <<= entry->length;
+            bitCount -= entry->length;
+        } else {
+            // Long code, or the end of the stream: walk the rest bit by bit.
+            bool isLeaf = false;
+            treePos = 5;
+
+            if (bitCount >= HUFF_LOOKUP_BITS) {
+                treePos = entry->treePos;
+                bitBuf <<= HUFF_LOOKUP_BITS;
+                bitCount -= HUFF_LOOKUP_BITS;
+            }
+
+            while (!isLeaf) {
+                if (bitCount == 0) {
+                    if (srcPos + 4 > srcSize)
+                        goto fail;
+                    bitBuf = (uint64_t)read_32_le(src + srcPos) << 32;
+                    bitCount = 32;
+                    srcPos += 4;
                 }
-                treePos = 5;
+                treePos = follow_bit(src, treePos, bitBuf >> 63, &isLeaf);
+                bitBuf <<= 1;
+                bitCount--;
+                if (treePos >= treeEnd)
+                    goto fail;
+            }
+        }
+
+        if (bitDepth == 8) {
+            dest[destPos++] = src[treePos];
+        } else {
+            destByte |= (src[treePos] & 0xF) << (4 * curVal);
+            if (++curVal == valuesPerByte) {
+                dest[destPos++] = destByte;
+                destByte = 0;
+                curVal = 0;
             }
-            window <<= 1;
         }
     }
 
+    *uncompressedSize_p = destSize;
+    return dest;
+
 fail:
     FATAL_ERROR("Fatal error while decompressing Huff file.\n");
 }
@@ -69,85 +69,273 @@ fail:
 	FATAL_ERROR("Fatal error while decompressing LZ file.\n");
 }
 
-unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+// The match finder keeps a hash chain per 3-byte prefix so that only positions
+// that can actually start a match are visited. Chains are walked from the most
+// recent position backwards, i.e. in order of increasing distance, and only a
+// strictly longer match replaces the current best. That matches the tie
+// breaking of a plain scan over every distance, so the output is unchanged.
+
+#define LZ_WINDOW_SIZE 0x1000
+#define LZ_WINDOW_MASK (LZ_WINDOW_SIZE - 1)
+#define LZ_MIN_MATCH 3
+#define LZ_MAX_MATCH 18
+#define LZ_HASH_BITS 14
+#define LZ_HASH_SIZE (1 << LZ_HASH_BITS)
+
+struct LZMatchFinder {
+	unsigned char *src;
+	int srcSize;
+	int minDistance;
+	int insertPos;
+	int head[LZ_HASH_SIZE];
+	int prev[LZ_WINDOW_SIZE];
+};
+
+static inline unsigned int LZHash(unsigned char *p)
 {
-	if (srcSize <= 0)
-		goto fail;
+	unsigned int key = (p[0] << 16) | (p[1] << 8) | p[2];
+
+	return (key * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+static void LZInitMatchFinder(struct LZMatchFinder *mf, unsigned char *src, int srcSize, int minDistance)
+{
+	mf->src = src;
+	mf->srcSize = srcSize;
+	mf->minDistance = minDistance;
+	mf->insertPos = 0;
+
+	for (int i = 0; i < LZ_HASH_SIZE; i++)
+		mf->head[i] = -1;
+}
+
+// Adds every position before endPos to the hash chains.
+static void LZInsertPositions(struct LZMatchFinder *mf, int endPos)
+{
+	int lastHashablePos = mf->srcSize - LZ_MIN_MATCH;
+
+	if (endPos > lastHashablePos + 1)
+		endPos = lastHashablePos + 1;
+
+	for (int pos = mf->insertPos; pos < endPos; pos++) {
+		unsigned int hash = LZHash(&mf->src[pos]);
+
+		// A slot is only overwritten once its position has left the window,
+		// at which point the chain walk has already stopped.
+		mf->prev[pos & LZ_WINDOW_MASK] = mf->head[hash];
+		mf->head[hash] = pos;
+	}
+
+	if (endPos > mf->insertPos)
+		mf->insertPos = endPos;
+}
+
+// Returns the length of the longest match at srcPos (0 if shorter than
+// LZ_MIN_MATCH) and stores the smallest distance that achieves it.
+static int LZFindLongestMatch(struct LZMatchFinder *mf, int srcPos, int *distance)
+{
+	unsigned char *src = mf->src;
+	int maxSize = mf->srcSize - srcPos;
+
+	if (maxSize > LZ_MAX_MATCH)
+		maxSize = LZ_MAX_MATCH;
+
+	if (maxSize < LZ_MIN_MATCH)
+		return 0;
+
+	LZInsertPositions(mf, srcPos);
+
+	int bestBlockSize = 0;
+	int candidate = mf->head[LZHash(&src[srcPos])];
 
+	while (candidate >= 0) {
+		int blockDistance = srcPos - candidate;
+
+		if (blockDistance > LZ_WINDOW_SIZE)
+			break;
+
+		if (blockDistance >= mf->minDistance && src[candidate + bestBlockSize] == src[srcPos + bestBlockSize]) {
+			int blockSize = 0;
+
+			while (blockSize < maxSize && src[candidate + blockSize] == src[srcPos + blockSize])
+				blockSize++;
+
+			if (blockSize > bestBlockSize) {
+				bestBlockSize = blockSize;
+				*distance = blockDistance;
+
+				if (blockSize == maxSize)
+					break;
+			}
+		}
+
+		candidate = mf->prev[candidate & LZ_WINDOW_MASK];
+	}
+
+	return bestBlockSize >= LZ_MIN_MATCH ? bestBlockSize : 0;
+}
+
+struct LZWriter {
+	unsigned char *dest;
+	int destPos;
+	int flagsPos;
+	int numTokens;
+};
+
+static void LZInitWriter(struct LZWriter *writer, int srcSize)
+{
 	int worstCaseDestSize = 4 + srcSize + ((srcSize + 7) / 8);
 
 	// Round up to the next multiple of four.
 	worstCaseDestSize = (worstCaseDestSize + 3) & ~3;
 
-	unsigned char *dest = malloc(worstCaseDestSize);
+	writer->dest = malloc(worstCaseDestSize);
 
-	if (dest == NULL)
-		goto fail;
+	if (writer->dest == NULL)
+		FATAL_ERROR("Fatal error while compressing LZ file.\n");
 
 	// header
-	dest[0] = 0x10; // LZ compression type
-	dest[1] = (unsigned char)srcSize;
-	dest[2] = (unsigned char)(srcSize >> 8);
-	dest[3] = (unsigned char)(srcSize >> 16);
+	writer->dest[0] = 0x10; // LZ compression type
+	writer->dest[1] = (unsigned char)srcSize;
+	writer->dest[2] = (unsigned char)(srcSize >> 8);
+	writer->dest[3] = (unsigned char)(srcSize >> 16);
+
+	writer->destPos = 4;
+	writer->flagsPos = 0;
+	writer->numTokens = 0;
+}
+
+static void LZBeginToken(struct LZWriter *writer)
+{
+	if (writer->numTokens % 8 == 0) {
+		writer->flagsPos = writer->destPos++;
+		writer->dest[writer->flagsPos] = 0;
+	}
+}
+
+static void LZWriteLiteral(struct LZWriter *writer, unsigned char value)
+{
+	LZBeginToken(writer);
+	writer->dest[writer->destPos++] = value;
+	writer->numTokens++;
+}
+
+static void LZWriteBlock(struct LZWriter *writer, int blockSize, int blockDistance)
+{
+	LZBeginToken(writer);
+	writer->dest[writer->flagsPos] |= (0x80 >> (writer->numTokens % 8));
+	blockSize -= 3;
+	blockDistance--;
+	writer->dest[writer->destPos++] = (blockSize << 4) | ((unsigned int)blockDistance >> 8);
+	writer->dest[writer->destPos++] = (unsigned char)blockDistance;
+	writer->numTokens++;
+}
+
+static unsigned char *LZFinishWriter(struct LZWriter *writer, int *compressedSize)
+{
+	// Pad to multiple of 4 bytes.
+	while (writer->destPos % 4 != 0)
+		writer->dest[writer->destPos++] = 0;
+
+	*compressedSize = writer->destPos;
+	return writer->dest;
+}
+
+unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+{
+	if (srcSize <= 0)
+		goto fail;
+
+	struct LZMatchFinder *mf = malloc(sizeof(struct LZMatchFinder));
+
+	if (mf == NULL)
+		goto fail;
+
+	LZInitMatchFinder(mf, src, srcSize, minDistance);
+
+	struct LZWriter writer;
+	LZInitWriter(&writer, srcSize);
 
 	int srcPos = 0;
-	int destPos = 4;
 
-	for (;;) {
-		unsigned char *flags = &dest[destPos++];
-		*flags = 0;
+	while (srcPos < srcSize) {
+		int blockDistance = 0;
+		int blockSize = LZFindLongestMatch(mf, srcPos, &blockDistance);
 
-		for (int i = 0; i < 8; i++) {
-			int bestBlockDistance = 0;
-			int bestBlockSize = 0;
-			int blockDistance = minDistance;
+		if (blockSize >= LZ_MIN_MATCH) {
+			LZWriteBlock(&writer, blockSize, blockDistance);
+			srcPos += blockSize;
+		} else {
+			LZWriteLiteral(&writer, src[srcPos++]);
+		}
+	}
 
-			while (blockDistance <= srcPos && blockDistance <= 0x1000) {
-				int blockStart = srcPos - blockDistance;
-				int blockSize = 0;
+	free(mf);
 
-				while (blockSize < 18
-				    && srcPos + blockSize < srcSize
-				    && src[blockStart + blockSize] == src[srcPos + blockSize])
-					blockSize++;
+	return LZFinishWriter(&writer, compressedSize);
 
-				if (blockSize > bestBlockSize) {
-					bestBlockDistance = blockDistance;
-					bestBlockSize = blockSize;
+fail:
+	FATAL_ERROR("Fatal error while compressing LZ file.\n");
+}
 
-					if (blockSize == 18)
-						break;
-				}
+// Finds the parse with the smallest encoded size. A literal costs 9 bits
+// (8 data bits plus its flag bit) and a block costs 17, so the cheapest
+// encoding of the suffix at each position is computed from back to front.
+// Any prefix of the longest match at a position is itself a valid block
+// with the same distance, so one longest-match query per position is
+// enough to enumerate every edge of the match graph. Ties are resolved in
+// favor of longer blocks, which means fewer tokens for the decoder.
+unsigned char *LZCompressOptimal(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+{
+	if (srcSize <= 0)
+		goto fail;
 
-				blockDistance++;
-			}
+	struct LZMatchFinder *mf = malloc(sizeof(struct LZMatchFinder));
+	int *matchSize = malloc(srcSize * sizeof(int));
+	int *matchDistance = malloc(srcSize * sizeof(int));
+	int *cost = malloc((srcSize + 1) * sizeof(int));
+	int *tokenSize = malloc(srcSize * sizeof(int));
 
-			if (bestBlockSize >= 3) {
-				*flags |= (0x80 >> i);
-				srcPos += bestBlockSize;
-				bestBlockSize -= 3;
-				bestBlockDistance--;
-				dest[destPos++] = (bestBlockSize << 4) | ((unsigned int)bestBlockDistance >> 8);
-				dest[destPos++] = (unsigned char)bestBlockDistance;
-			} else {
-				dest[destPos++] = src[srcPos++];
-			}
+	if (mf == NULL || matchSize == NULL || matchDistance == NULL || cost == NULL || tokenSize == NULL)
+		goto fail;
 
-			if (srcPos == srcSize) {
-				// Pad to multiple of 4 bytes.
-				int remainder = destPos % 4;
+	LZInitMatchFinder(mf, src, srcSize, minDistance);
 
-				if (remainder != 0) {
-					for (int i = 0; i < 4 - remainder; i++)
-						dest[destPos++] = 0;
-				}
+	for (int srcPos = 0; srcPos < srcSize; srcPos++)
+		matchSize[srcPos] = LZFindLongestMatch(mf, srcPos, &matchDistance[srcPos]);
 
-				*compressedSize = destPos;
-				return dest;
+	cost[srcSize] = 0;
+
+	for (int srcPos = srcSize - 1; srcPos >= 0; srcPos--) {
+		cost[srcPos] = cost[srcPos + 1] + 9;
+		tokenSize[srcPos] = 1;
+
+		for (int blockSize = LZ_MIN_MATCH; blockSize <= matchSize[srcPos]; blockSize++) {
+			if (cost[srcPos + blockSize] + 17 <= cost[srcPos]) {
+				cost[srcPos] = cost[srcPos + blockSize] + 17;
+				tokenSize[srcPos] = blockSize;
 			}
 		}
 	}
 
+	struct LZWriter writer;
+	LZInitWriter(&writer, srcSize);
+
+	for (int srcPos = 0; srcPos < srcSize; srcPos += tokenSize[srcPos]) {
+		if (tokenSize[srcPos] >= LZ_MIN_MATCH)
+			LZWriteBlock(&writer, tokenSize[srcPos], matchDistance[srcPos]);
+		else
+			LZWriteLiteral(&writer, src[srcPos]);
+	}
+
+	free(tokenSize);
+	free(cost);
+	free(matchDistance);
+	free(matchSize);
+	free(mf);
+
+	return LZFinishWriter(&writer, compressedSize);
+
 fail:
 	FATAL_ERROR("Fatal error while compressing LZ file.\n");
 }
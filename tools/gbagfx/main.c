@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
+#include <time.h>
 #include "global.h"
 #include "util.h"
 #include "options.h"
@@ -13,6 +14,9 @@
 #include "rl.h"
 #include "font.h"
 #include "huff.h"
+#include "batch.h"
+#include "tile_kernels.h"
+#include "compress_auto.h"
 
 struct CommandHandler
 {
@@ -375,6 +379,7 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
 {
     int overflowSize = 0;
     int minDistance = 2; // default, for compatibility with LZ77UnCompVram()
+    bool optimal = false;
 
     for (int i = 3; i < argc; i++)
     {
@@ -406,6 +411,10 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
             if (minDistance < 1)
                 FATAL_ERROR("LZ min search distance must be positive.\n");
         }
+        else if (strcmp(option, "-optimal") == 0)
+        {
+            optimal = true;
+        }
         else
         {
             FATAL_ERROR("Unrecognized option \"%s\".\n", option);
@@ -422,7 +431,12 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
     unsigned char *buffer = ReadWholeFileZeroPadded(inputPath, &fileSize, overflowSize);
 
     int compressedSize;
-    unsigned char *compressedData = LZCompress(buffer, fileSize + overflowSize, &compressedSize, minDistance);
+    unsigned char *compressedData;
+
+    if (optimal)
+        compressedData = LZCompressOptimal(buffer, fileSize + overflowSize, &compressedSize, minDistance);
+    else
+        compressedData = LZCompress(buffer, fileSize + overflowSize, &compressedSize, minDistance);
 
     compressedData[1] = (unsigned char)fileSize;
     compressedData[2] = (unsigned char)(fileSize >> 8);
@@ -535,12 +549,548 @@ void HandleHuffDecompressCommand(char *inputPath, char *outputPath, int argc UNU
     free(uncompressedData);
 }
 
-int main(int argc, char **argv)
+static char *CopyPath(const char *path)
 {
-    char converted = 0;
+    char *copy = malloc(strlen(path) + 1);
 
-    if (argc < 3)
-        FATAL_ERROR("Usage: gbagfx INPUT_PATH OUTPUT_PATH [options...]\n");
+    if (copy == NULL)
+        FATAL_ERROR("Failed to allocate path.\n");
+
+    strcpy(copy, path);
+    return copy;
+}
+
+// Returns the input files of a command that takes them either as the
+// arguments from argv[first] on, or, if there are none, from stdin one per
+// line. The list and its paths are freed with FreeInputPaths.
+static char **ReadInputPaths(int argc, char **argv, int first, int *numPaths)
+{
+    int capacity = first < argc ? argc - first : 256;
+    char **paths = malloc(capacity * sizeof(char *));
+
+    if (paths == NULL)
+        FATAL_ERROR("Failed to allocate path list.\n");
+
+    *numPaths = 0;
+
+    if (first < argc)
+    {
+        for (int i = first; i < argc; i++)
+            paths[(*numPaths)++] = CopyPath(argv[i]);
+    }
+    else
+    {
+        char path[4096];
+
+        while (fgets(path, sizeof(path), stdin) != NULL)
+        {
+            path[strcspn(path, "\r\n")] = 0;
+
+            if (path[0] == 0)
+                continue;
+
+            if (*numPaths == capacity)
+            {
+                capacity *= 2;
+                paths = realloc(paths, capacity * sizeof(char *));
+
+                if (paths == NULL)
+                    FATAL_ERROR("Failed to allocate path list.\n");
+            }
+
+            paths[(*numPaths)++] = CopyPath(path);
+        }
+    }
+
+    if (*numPaths == 0)
+        FATAL_ERROR("No input files.\n");
+
+    return paths;
+}
+
+static void FreeInputPaths(char **paths, int numPaths)
+{
+    for (int i = 0; i < numPaths; i++)
+        free(paths[i]);
+
+    free(paths);
+}
+
+static void BenchmarkLZFile(char *path, int minDistance, bool optimal, bool verify, double *seconds, long long *totalIn, long long *totalOut)
+{
+    int fileSize;
+    unsigned char *buffer = ReadWholeFile(path, &fileSize);
+
+    clock_t start = clock();
+    int compressedSize;
+    unsigned char *compressedData;
+
+    if (optimal)
+        compressedData = LZCompressOptimal(buffer, fileSize, &compressedSize, minDistance);
+    else
+        compressedData = LZCompress(buffer, fileSize, &compressedSize, minDistance);
+
+    *seconds += (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    if (verify)
+    {
+        int uncompressedSize;
+        unsigned char *uncompressedData = LZDecompress(compressedData, compressedSize, &uncompressedSize);
+
+        if (uncompressedSize != fileSize || memcmp(uncompressedData, buffer, fileSize) != 0)
+            FATAL_ERROR("LZ round trip mismatch for \"%s\".\n", path);
+
+        free(uncompressedData);
+    }
+
+    *totalIn += fileSize;
+    *totalOut += compressedSize;
+
+    free(compressedData);
+    free(buffer);
+}
+
+// Usage: gbagfx lzbench [-search N] [-optimal] [-verify] [FILES...]
+// Compresses every file in memory and reports the throughput of LZCompress.
+// If no files are given, paths are read from stdin one per line, e.g.
+//   find graphics -name '*.4bpp' | tools/gbagfx/gbagfx lzbench
+void HandleLZBenchmarkCommand(int argc, char **argv)
+{
+    int minDistance = 2;
+    bool optimal = false;
+    bool verify = false;
+    int numFiles = 0;
+    double seconds = 0.0;
+    long long totalIn = 0;
+    long long totalOut = 0;
+    int i;
+
+    for (i = 2; i < argc && argv[i][0] == '-'; i++)
+    {
+        char *option = argv[i];
+
+        if (strcmp(option, "-search") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No size following \"-search\".\n");
+
+            i++;
+
+            if (!ParseNumber(argv[i], NULL, 10, &minDistance))
+                FATAL_ERROR("Failed to parse LZ min search distance.\n");
+
+            if (minDistance < 1)
+                FATAL_ERROR("LZ min search distance must be positive.\n");
+        }
+        else if (strcmp(option, "-optimal") == 0)
+        {
+            optimal = true;
+        }
+        else if (strcmp(option, "-verify") == 0)
+        {
+            verify = true;
+        }
+        else
+        {
+            FATAL_ERROR("Unrecognized option \"%s\".\n", option);
+        }
+    }
+
+    char **paths = ReadInputPaths(argc, argv, i, &numFiles);
+
+    for (i = 0; i < numFiles; i++)
+        BenchmarkLZFile(paths[i], minDistance, optimal, verify, &seconds, &totalIn, &totalOut);
+
+    FreeInputPaths(paths, numFiles);
+
+    printf("files:      %d\n", numFiles);
+    printf("input:      %lld bytes\n", totalIn);
+    printf("output:     %lld bytes (%.2f%%)\n", totalOut, totalIn ? 100.0 * totalOut / totalIn : 0.0);
+    printf("time:       %.3f s\n", seconds);
+    printf("throughput: %.2f MB/s\n", seconds > 0.0 ? totalIn / seconds / 1e6 : 0.0);
+}
+
+static void BenchmarkHuffFile(char *path, int bitDepth, double *compressSeconds, double *decompressSeconds, long long *totalIn, long long *totalOut)
+{
+    int fileSize;
+    unsigned char *buffer = ReadWholeFile(path, &fileSize);
+
+    // Existing .huff files are benchmarked on the data they hold.
+    char *extension = GetFileExtensionAfterDot(path);
+
+    if (extension != NULL && strcmp(extension, "huff") == 0)
+    {
+        int uncompressedSize;
+        unsigned char *uncompressedData = HuffDecompress(buffer, fileSize, &uncompressedSize);
+
+        free(buffer);
+        buffer = uncompressedData;
+        fileSize = uncompressedSize;
+    }
+
+    if (fileSize == 0)
+    {
+        free(buffer);
+        return;
+    }
+
+    clock_t start = clock();
+    int compressedSize;
+    unsigned char *compressedData = HuffCompress(buffer, fileSize, &compressedSize, bitDepth);
+
+    *compressSeconds += (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    int uncompressedSize;
+    unsigned char *uncompressedData = HuffDecompress(compressedData, compressedSize, &uncompressedSize);
+
+    *decompressSeconds += (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    if (uncompressedSize != fileSize || memcmp(uncompressedData, buffer, fileSize) != 0)
+        FATAL_ERROR("Huffman round trip mismatch for \"%s\".\n", path);
+
+    *totalIn += fileSize;
+    *totalOut += compressedSize;
+
+    free(uncompressedData);
+    free(compressedData);
+    free(buffer);
+}
+
+// Usage: gbagfx huffbench [-depth N] [FILES...]
+// Compresses every file in memory, checks that it decompresses back to the
+// same data, and reports the throughput of HuffCompress and HuffDecompress.
+// If no files are given, paths are read from stdin one per line, e.g.
+//   find graphics -name '*.fwjpnfont' | tools/gbagfx/gbagfx huffbench
+void HandleHuffBenchmarkCommand(int argc, char **argv)
+{
+    int bitDepth = 4;
+    int numFiles = 0;
+    double compressSeconds = 0.0;
+    double decompressSeconds = 0.0;
+    long long totalIn = 0;
+    long long totalOut = 0;
+    int i;
+
+    for (i = 2; i < argc && argv[i][0] == '-'; i++)
+    {
+        char *option = argv[i];
+
+        if (strcmp(option, "-depth") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No size following \"-depth\".\n");
+
+            i++;
+
+            if (!ParseNumber(argv[i], NULL, 10, &bitDepth))
+                FATAL_ERROR("Failed to parse bit depth.\n");
+
+            if (bitDepth != 4 && bitDepth != 8)
+                FATAL_ERROR("GBA only supports bit depth of 4 or 8.\n");
+        }
+        else
+        {
+            FATAL_ERROR("Unrecognized option \"%s\".\n", option);
+        }
+    }
+
+    char **paths = ReadInputPaths(argc, argv, i, &numFiles);
+
+    for (i = 0; i < numFiles; i++)
+        BenchmarkHuffFile(paths[i], bitDepth, &compressSeconds, &decompressSeconds, &totalIn, &totalOut);
+
+    FreeInputPaths(paths, numFiles);
+
+    printf("files:      %d (all round trips match)\n", numFiles);
+    printf("input:      %lld bytes\n", totalIn);
+    printf("output:     %lld bytes (%.2f%%)\n", totalOut, totalIn ? 100.0 * totalOut / totalIn : 0.0);
+    printf("compress:   %.3f s, %.2f MB/s\n", compressSeconds, compressSeconds > 0.0 ? totalIn / compressSeconds / 1e6 : 0.0);
+    printf("decompress: %.3f s, %.2f MB/s\n", decompressSeconds, decompressSeconds > 0.0 ? totalIn / decompressSeconds / 1e6 : 0.0);
+}
+
+struct TileBenchImage
+{
+    unsigned char *pixels;
+    unsigned char *tiles;
+    int tilesWidth;
+    int numTiles;
+};
+
+static void LoadTileBenchImage(char *path, int bitDepth, struct TileBenchImage *benchImage)
+{
+    struct Image image = {};
+
+    image.bitDepth = bitDepth;
+    ReadPng(path, &image);
+
+    if (image.width % 8 != 0 || image.height % 8 != 0)
+        FATAL_ERROR("\"%s\" isn't a whole number of tiles.\n", path);
+
+    benchImage->pixels = image.pixels;
+    benchImage->tilesWidth = image.width / 8;
+    benchImage->numTiles = benchImage->tilesWidth * (image.height / 8);
+    benchImage->tiles = malloc(benchImage->numTiles * bitDepth * 8);
+
+    if (benchImage->tiles == NULL)
+        FATAL_ERROR("Failed to allocate memory for tiles.\n");
+}
+
+// Usage: gbagfx tilebench [-bpp N] [-iterations N] [-invert] [FILES...]
+// Converts every PNG to tiles and back in memory with each set of tile
+// kernels this CPU supports, checks that they all agree, and reports their
+// throughput. If no files are given, paths are read from stdin one per line, e.g.
+//   find graphics/pokemon -name '*.png' | tools/gbagfx/gbagfx tilebench
+void HandleTileBenchmarkCommand(int argc, char **argv)
+{
+    int bitDepth = 4;
+    int iterations = 20;
+    bool invertColors = false;
+    int numImages;
+    long long totalBytes = 0;
+    int i;
+
+    for (i = 2; i < argc && argv[i][0] == '-'; i++)
+    {
+        char *option = argv[i];
+
+        if (strcmp(option, "-bpp") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No bit depth following \"-bpp\".\n");
+
+            i++;
+
+            if (!ParseNumber(argv[i], NULL, 10, &bitDepth))
+                FATAL_ERROR("Failed to parse bit depth.\n");
+
+            if (bitDepth != 1 && bitDepth != 4 && bitDepth != 8)
+                FATAL_ERROR("Bit depth must be 1, 4, or 8.\n");
+        }
+        else if (strcmp(option, "-iterations") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No count following \"-iterations\".\n");
+
+            i++;
+
+            if (!ParseNumber(argv[i], NULL, 10, &iterations))
+                FATAL_ERROR("Failed to parse iteration count.\n");
+
+            if (iterations < 1)
+                FATAL_ERROR("Iteration count must be positive.\n");
+        }
+        else if (strcmp(option, "-invert") == 0)
+        {
+            invertColors = true;
+        }
+        else
+        {
+            FATAL_ERROR("Unrecognized option \"%s\".\n", option);
+        }
+    }
+
+    char **paths = ReadInputPaths(argc, argv, i, &numImages);
+    struct TileBenchImage *images = malloc(numImages * sizeof(*images));
+
+    if (images == NULL)
+        FATAL_ERROR("Failed to allocate image list.\n");
+
+    for (i = 0; i < numImages; i++)
+        LoadTileBenchImage(paths[i], bitDepth, &images[i]);
+
+    FreeInputPaths(paths, numImages);
+
+    int maxTiles = 0;
+
+    for (int j = 0; j < numImages; j++)
+    {
+        totalBytes += images[j].numTiles * bitDepth * 8;
+
+        if (images[j].numTiles > maxTiles)
+            maxTiles = images[j].numTiles;
+    }
+
+    // The round trip goes through a scratch image, which must come back
+    // identical; the scalar kernels' tiles are the reference for the others.
+    unsigned char *roundTrip = malloc(maxTiles * bitDepth * 8);
+    unsigned char **referenceTiles = malloc(numImages * sizeof(*referenceTiles));
+
+    if (roundTrip == NULL || referenceTiles == NULL)
+        FATAL_ERROR("Failed to allocate memory for tiles.\n");
+
+    const struct TileKernels *kernels[3];
+    int numKernels = GetSupportedTileKernels(kernels, 3);
+    const struct TileKernels *defaultKernels = GetTileKernels();
+
+    SetTileKernels(kernels[numKernels - 1]);
+
+    for (int j = 0; j < numImages; j++)
+    {
+        referenceTiles[j] = malloc(images[j].numTiles * bitDepth * 8);
+
+        if (referenceTiles[j] == NULL)
+            FATAL_ERROR("Failed to allocate memory for tiles.\n");
+
+        ConvertToTiles(images[j].pixels, referenceTiles[j], images[j].numTiles, bitDepth, images[j].tilesWidth, 1, 1, invertColors);
+    }
+
+    printf("files:      %d\n", numImages);
+    printf("tile data:  %lld bytes x %d iterations\n", totalBytes, iterations);
+
+    for (int k = numKernels - 1; k >= 0; k--)
+    {
+        SetTileKernels(kernels[k]);
+
+        clock_t start = clock();
+
+        for (int n = 0; n < iterations; n++)
+        {
+            for (int j = 0; j < numImages; j++)
+                ConvertToTiles(images[j].pixels, images[j].tiles, images[j].numTiles, bitDepth, images[j].tilesWidth, 1, 1, invertColors);
+        }
+
+        double toSeconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        start = clock();
+
+        for (int n = 0; n < iterations; n++)
+        {
+            for (int j = 0; j < numImages; j++)
+                ConvertFromTiles(images[j].tiles, roundTrip, images[j].numTiles, bitDepth, images[j].tilesWidth, 1, 1, invertColors);
+        }
+
+        double fromSeconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        for (int j = 0; j < numImages; j++)
+        {
+            int size = images[j].numTiles * bitDepth * 8;
+
+            if (memcmp(images[j].tiles, referenceTiles[j], size) != 0)
+                FATAL_ERROR("%s kernels disagree with the scalar kernels.\n", kernels[k]->name);
+
+            ConvertFromTiles(images[j].tiles, roundTrip, images[j].numTiles, bitDepth, images[j].tilesWidth, 1, 1, invertColors);
+
+            if (memcmp(roundTrip, images[j].pixels, size) != 0)
+                FATAL_ERROR("%s kernels don't round trip.\n", kernels[k]->name);
+        }
+
+        double megabytes = (double)totalBytes * iterations / 1e6;
+
+        printf("%-8s    to tiles %8.2f MB/s, from tiles %8.2f MB/s%s\n", kernels[k]->name,
+            toSeconds > 0.0 ? megabytes / toSeconds : 0.0,
+            fromSeconds > 0.0 ? megabytes / fromSeconds : 0.0,
+            kernels[k] == defaultKernels ? " (default)" : "");
+    }
+
+    SetTileKernels(defaultKernels);
+
+    for (int j = 0; j < numImages; j++)
+    {
+        free(images[j].pixels);
+        free(images[j].tiles);
+        free(referenceTiles[j]);
+    }
+
+    free(referenceTiles);
+    free(roundTrip);
+    free(images);
+}
+
+// Usage: gbagfx pngbench [FILES...]
+// Decodes every PNG with both the built-in decoder and libpng, checks that
+// they agree, also with the image data split over many IDAT chunks, and
+// reports the throughput of each. If no files are given, paths are read
+// from stdin one per line, e.g.
+//   find graphics -name '*.png' | tools/gbagfx/gbagfx pngbench
+void HandlePngBenchmarkCommand(int argc, char **argv)
+{
+    int numFiles = 0;
+    double builtinSeconds = 0.0;
+    double libpngSeconds = 0.0;
+    long long totalBytes = 0;
+
+    char **paths = ReadInputPaths(argc, argv, 2, &numFiles);
+
+    for (int i = 0; i < numFiles; i++)
+        BenchmarkPngFile(paths[i], &builtinSeconds, &libpngSeconds, &totalBytes);
+
+    FreeInputPaths(paths, numFiles);
+
+    printf("files:      %d (both decoders agree)\n", numFiles);
+    printf("pixels:     %lld bytes\n", totalBytes);
+    printf("built-in:   %.3f s, %.2f MB/s\n", builtinSeconds, builtinSeconds > 0.0 ? totalBytes / builtinSeconds / 1e6 : 0.0);
+    printf("libpng:     %.3f s, %.2f MB/s\n", libpngSeconds, libpngSeconds > 0.0 ? totalBytes / libpngSeconds / 1e6 : 0.0);
+}
+
+// Usage: gbagfx compress-auto [-o OUTPUT] [-report CSV] [-vram] [-j THREADS] [FILES...]
+// Tries every codec (LZ with several search distances, RL, 4- and 8-bit
+// Huffman) on each file and reports which is smallest. With -o, which takes a
+// single file, the smallest encoding is written to OUTPUT. If no files are
+// given, paths are read from stdin one per line, e.g.
+//   find graphics -name '*.4bpp' | tools/gbagfx/gbagfx compress-auto -report sizes.csv
+void HandleCompressAutoCommand(int argc, char **argv)
+{
+    int numThreads = GetDefaultThreadCount();
+    char *outputPath = NULL;
+    char *reportPath = NULL;
+    bool vramSafe = false;
+    int numPaths;
+    int i;
+
+    for (i = 2; i < argc && argv[i][0] == '-'; i++)
+    {
+        char *option = argv[i];
+
+        if (strcmp(option, "-o") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No output file following \"-o\".\n");
+
+            outputPath = argv[++i];
+        }
+        else if (strcmp(option, "-report") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No report file following \"-report\".\n");
+
+            reportPath = argv[++i];
+        }
+        else if (strcmp(option, "-vram") == 0)
+        {
+            vramSafe = true;
+        }
+        else if (strcmp(option, "-j") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No thread count following \"-j\".\n");
+
+            i++;
+
+            if (!ParseNumber(argv[i], NULL, 10, &numThreads))
+                FATAL_ERROR("Failed to parse thread count.\n");
+
+            if (numThreads < 1)
+                FATAL_ERROR("Thread count must be positive.\n");
+        }
+        else
+        {
+            FATAL_ERROR("Unrecognized option \"%s\".\n", option);
+        }
+    }
+
+    char **paths = ReadInputPaths(argc, argv, i, &numPaths);
+
+    if (outputPath != NULL && numPaths != 1)
+        FATAL_ERROR("\"-o\" takes exactly one input file.\n");
+
+    RunCompressAuto(paths, numPaths, outputPath, reportPath, vramSafe, numThreads);
+    FreeInputPaths(paths, numPaths);
+}
+
+static void RunCommand(int argc, char **argv)
+{
+    char converted = 0;
 
     struct CommandHandler handlers[] =
     {
@@ -621,6 +1171,97 @@ int main(int argc, char **argv)
 
     if (!converted)
         FATAL_ERROR("Don't know how to convert \"%s\" to \"%s\".\n", argv[1], argv[2]);
+}
+
+// Usage: gbagfx batch [-j THREADS] [-f] MANIFEST
+// Runs every conversion listed in MANIFEST (see batch.c for the format),
+// skipping those whose output is newer than their input unless -f is given.
+void HandleBatchCommand(int argc, char **argv)
+{
+    int numThreads = GetDefaultThreadCount();
+    bool force = false;
+    char *manifestPath = NULL;
+
+    for (int i = 2; i < argc; i++)
+    {
+        char *option = argv[i];
+
+        if (strcmp(option, "-j") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No thread count following \"-j\".\n");
+
+            i++;
+
+            if (!ParseNumber(argv[i], NULL, 10, &numThreads))
+                FATAL_ERROR("Failed to parse thread count.\n");
+
+            if (numThreads < 1)
+                FATAL_ERROR("Thread count must be positive.\n");
+        }
+        else if (strcmp(option, "-f") == 0)
+        {
+            force = true;
+        }
+        else if (option[0] == '-' || manifestPath != NULL)
+        {
+            FATAL_ERROR("Unrecognized option \"%s\".\n", option);
+        }
+        else
+        {
+            manifestPath = option;
+        }
+    }
+
+    if (manifestPath == NULL)
+        FATAL_ERROR("Usage: gbagfx batch [-j THREADS] [-f] MANIFEST\n");
+
+    SetPngCacheEnabled(true);
+    RunBatch(manifestPath, numThreads, force, RunCommand);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc >= 2 && strcmp(argv[1], "lzbench") == 0)
+    {
+        HandleLZBenchmarkCommand(argc, argv);
+        return 0;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "pngbench") == 0)
+    {
+        HandlePngBenchmarkCommand(argc, argv);
+        return 0;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "compress-auto") == 0)
+    {
+        HandleCompressAutoCommand(argc, argv);
+        return 0;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "huffbench") == 0)
+    {
+        HandleHuffBenchmarkCommand(argc, argv);
+        return 0;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "tilebench") == 0)
+    {
+        HandleTileBenchmarkCommand(argc, argv);
+        return 0;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "batch") == 0)
+    {
+        HandleBatchCommand(argc, argv);
+        return 0;
+    }
+
+    if (argc < 3)
+        FATAL_ERROR("Usage: gbagfx INPUT_PATH OUTPUT_PATH [options...]\n");
+
+    RunCommand(argc, argv);
 
     return 0;
 }
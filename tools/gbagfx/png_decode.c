@@ -0,0 +1,673 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "global.h"
+#include "png_decode.h"
+
+// A small PNG decoder for the images gbagfx actually reads: grayscale or
+// palette, 1 to 8 bits per pixel, not interlaced. It has its own inflate so
+// that these images don't go through libpng's per-row machinery.
+
+// Codes up to this long are decoded with one table lookup; longer ones,
+// which are rare, are decoded a bit at a time.
+#define INFLATE_FAST_BITS 10
+#define INFLATE_MAX_BITS  15
+
+struct InflateTable
+{
+    uint16_t fast[1 << INFLATE_FAST_BITS];
+    uint16_t counts[INFLATE_MAX_BITS + 1];
+    uint16_t symbols[288];
+};
+
+struct Inflater
+{
+    char *path;
+    const unsigned char *src;
+    size_t srcSize;
+    size_t srcPos;
+    uint64_t bitBuf;
+    int bitCount;
+    unsigned char *dest;
+    size_t destSize;
+    size_t destPos;
+};
+
+static const uint16_t sLengthBase[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t sLengthExtra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t sDistanceBase[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t sDistanceExtra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+static struct InflateTable sFixedLiterals;
+static struct InflateTable sFixedDistances;
+static uint32_t sCrcTable[256];
+static pthread_once_t sInitOnce = PTHREAD_ONCE_INIT;
+
+// Scratch buffers, kept for the life of the thread so that converting many
+// images doesn't allocate them over and over.
+static _Thread_local unsigned char *sIdat;
+static _Thread_local size_t sIdatCapacity;
+static _Thread_local unsigned char *sFiltered;
+static _Thread_local size_t sFilteredCapacity;
+
+// Grows a scratch buffer to at least size bytes. Its contents are only kept
+// if keepContents is set, which saves a copy for buffers about to be
+// overwritten anyway.
+static unsigned char *ReserveScratch(unsigned char **buffer, size_t *capacity, size_t size, bool keepContents)
+{
+    if (size > *capacity)
+    {
+        *capacity = size > *capacity * 2 ? size : *capacity * 2;
+
+        if (keepContents)
+        {
+            unsigned char *grown = realloc(*buffer, *capacity);
+
+            if (grown == NULL)
+                free(*buffer);
+            *buffer = grown;
+        }
+        else
+        {
+            free(*buffer);
+            *buffer = malloc(*capacity);
+        }
+
+        if (*buffer == NULL)
+            FATAL_ERROR("Failed to allocate PNG decoding buffer.\n");
+    }
+
+    return *buffer;
+}
+
+void FreePngDecodeScratch(void)
+{
+    free(sIdat);
+    free(sFiltered);
+    sIdat = NULL;
+    sFiltered = NULL;
+    sIdatCapacity = 0;
+    sFilteredCapacity = 0;
+}
+
+static inline void Refill(struct Inflater *inf)
+{
+    while (inf->bitCount <= 56)
+    {
+        // Past the end of the data, feed zeros; Inflate catches streams
+        // that really needed them.
+        uint64_t byte = inf->srcPos < inf->srcSize ? inf->src[inf->srcPos] : 0;
+        inf->srcPos++;
+        inf->bitBuf |= byte << inf->bitCount;
+        inf->bitCount += 8;
+    }
+}
+
+static inline unsigned GetBits(struct Inflater *inf, int count)
+{
+    if (inf->bitCount < count)
+        Refill(inf);
+
+    unsigned value = inf->bitBuf & ((1u << count) - 1);
+    inf->bitBuf >>= count;
+    inf->bitCount -= count;
+    return value;
+}
+
+// Builds a decoding table from code lengths. Returns false if the lengths
+// don't form a valid code. Incomplete codes are allowed, as deflate uses one
+// for a distance tree with a single code.
+static bool BuildTable(struct InflateTable *table, const uint8_t *lengths, int numSymbols)
+{
+    uint16_t offsets[INFLATE_MAX_BITS + 2];
+    uint16_t nextCode[INFLATE_MAX_BITS + 1];
+
+    memset(table->counts, 0, sizeof(table->counts));
+    memset(table->fast, 0, sizeof(table->fast));
+
+    for (int i = 0; i < numSymbols; i++)
+        table->counts[lengths[i]]++;
+
+    table->counts[0] = 0;
+
+    int left = 1;
+
+    for (int len = 1; len <= INFLATE_MAX_BITS; len++)
+    {
+        left = (left << 1) - table->counts[len];
+
+        if (left < 0)
+            return false;
+    }
+
+    offsets[1] = 0;
+
+    for (int len = 1; len <= INFLATE_MAX_BITS; len++)
+        offsets[len + 1] = offsets[len] + table->counts[len];
+
+    int code = 0;
+
+    nextCode[0] = 0;
+
+    for (int len = 1; len <= INFLATE_MAX_BITS; len++)
+    {
+        code = (code + table->counts[len - 1]) << 1;
+        nextCode[len] = code;
+    }
+
+    for (int i = 0; i < numSymbols; i++)
+    {
+        int len = lengths[i];
+
+        if (len == 0)
+            continue;
+
+        table->symbols[offsets[len]++] = i;
+
+        int symbolCode = nextCode[len]++;
+
+        if (len > INFLATE_FAST_BITS)
+            continue;
+
+        // Deflate sends codes most significant bit first, but the bits are
+        // read from the least significant end, so index the table reversed.
+        int reversed = 0;
+
+        for (int j = 0; j < len; j++)
+            reversed |= ((symbolCode >> j) & 1) << (len - 1 - j);
+
+        for (int j = reversed; j < (1 << INFLATE_FAST_BITS); j += 1 << len)
+            table->fast[j] = (i << 4) | len;
+    }
+
+    return true;
+}
+
+static int DecodeSymbol(struct Inflater *inf, const struct InflateTable *table)
+{
+    if (inf->bitCount < INFLATE_MAX_BITS)
+        Refill(inf);
+
+    unsigned entry = table->fast[inf->bitBuf & ((1 << INFLATE_FAST_BITS) - 1)];
+
+    if (entry != 0)
+    {
+        int len = entry & 15;
+        inf->bitBuf >>= len;
+        inf->bitCount -= len;
+        return entry >> 4;
+    }
+
+    // Canonical decoding, one bit at a time.
+    int code = 0;
+    int first = 0;
+    int index = 0;
+
+    for (int len = 1; len <= INFLATE_MAX_BITS; len++)
+    {
+        code |= (inf->bitBuf >> (len - 1)) & 1;
+
+        int count = table->counts[len];
+
+        if (code - first < count)
+        {
+            inf->bitBuf >>= len;
+            inf->bitCount -= len;
+            return table->symbols[index + code - first];
+        }
+
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+
+    FATAL_ERROR("Invalid Huffman code in \"%s\".\n", inf->path);
+}
+
+static void InitTables(void)
+{
+    uint8_t lengths[288];
+
+    for (int i = 0; i < 144; i++)
+        lengths[i] = 8;
+    for (int i = 144; i < 256; i++)
+        lengths[i] = 9;
+    for (int i = 256; i < 280; i++)
+        lengths[i] = 7;
+    for (int i = 280; i < 288; i++)
+        lengths[i] = 8;
+
+    BuildTable(&sFixedLiterals, lengths, 288);
+
+    for (int i = 0; i < 30; i++)
+        lengths[i] = 5;
+
+    BuildTable(&sFixedDistances, lengths, 30);
+
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t crc = i;
+
+        for (int j = 0; j < 8; j++)
+            crc = (crc & 1) ? 0xEDB88320 ^ (crc >> 1) : crc >> 1;
+
+        sCrcTable[i] = crc;
+    }
+}
+
+static void ReadDynamicTables(struct Inflater *inf, struct InflateTable *literals, struct InflateTable *distances)
+{
+    static const uint8_t order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+    uint8_t lengths[288 + 32];
+    struct InflateTable codeLengths;
+
+    int numLiterals = GetBits(inf, 5) + 257;
+    int numDistances = GetBits(inf, 5) + 1;
+    int numCodeLengths = GetBits(inf, 4) + 4;
+
+    if (numLiterals > 286 || numDistances > 30)
+        FATAL_ERROR("Invalid deflate block in \"%s\".\n", inf->path);
+
+    memset(lengths, 0, 19);
+
+    for (int i = 0; i < numCodeLengths; i++)
+        lengths[order[i]] = GetBits(inf, 3);
+
+    if (!BuildTable(&codeLengths, lengths, 19))
+        FATAL_ERROR("Invalid deflate block in \"%s\".\n", inf->path);
+
+    for (int i = 0; i < numLiterals + numDistances;)
+    {
+        int symbol = DecodeSymbol(inf, &codeLengths);
+        int repeat;
+        uint8_t value = 0;
+
+        if (symbol < 16)
+        {
+            lengths[i++] = symbol;
+            continue;
+        }
+
+        if (symbol == 16)
+        {
+            if (i == 0)
+                FATAL_ERROR("Invalid deflate block in \"%s\".\n", inf->path);
+            value = lengths[i - 1];
+            repeat = 3 + GetBits(inf, 2);
+        }
+        else if (symbol == 17)
+        {
+            repeat = 3 + GetBits(inf, 3);
+        }
+        else
+        {
+            repeat = 11 + GetBits(inf, 7);
+        }
+
+        if (i + repeat > numLiterals + numDistances)
+            FATAL_ERROR("Invalid deflate block in \"%s\".\n", inf->path);
+
+        memset(&lengths[i], value, repeat);
+        i += repeat;
+    }
+
+    if (lengths[256] == 0
+     || !BuildTable(literals, lengths, numLiterals)
+     || !BuildTable(distances, lengths + numLiterals, numDistances))
+        FATAL_ERROR("Invalid deflate block in \"%s\".\n", inf->path);
+}
+
+static void InflateBlock(struct Inflater *inf, const struct InflateTable *literals, const struct InflateTable *distances)
+{
+    for (;;)
+    {
+        int symbol = DecodeSymbol(inf, literals);
+
+        if (symbol < 256)
+        {
+            if (inf->destPos >= inf->destSize)
+                FATAL_ERROR("Too much image data in \"%s\".\n", inf->path);
+
+            inf->dest[inf->destPos++] = symbol;
+            continue;
+        }
+
+        if (symbol == 256)
+            return;
+
+        symbol -= 257;
+
+        if (symbol >= 29)
+            FATAL_ERROR("Invalid deflate length in \"%s\".\n", inf->path);
+
+        size_t length = sLengthBase[symbol] + GetBits(inf, sLengthExtra[symbol]);
+        int distanceSymbol = DecodeSymbol(inf, distances);
+
+        if (distanceSymbol >= 30)
+            FATAL_ERROR("Invalid deflate distance in \"%s\".\n", inf->path);
+
+        size_t distance = sDistanceBase[distanceSymbol] + GetBits(inf, sDistanceExtra[distanceSymbol]);
+
+        if (distance > inf->destPos)
+            FATAL_ERROR("Invalid deflate distance in \"%s\".\n", inf->path);
+
+        if (length > inf->destSize - inf->destPos)
+            FATAL_ERROR("Too much image data in \"%s\".\n", inf->path);
+
+        // The copy may overlap itself, so it goes a byte at a time.
+        unsigned char *out = &inf->dest[inf->destPos];
+        const unsigned char *from = out - distance;
+
+        for (size_t i = 0; i < length; i++)
+            out[i] = from[i];
+
+        inf->destPos += length;
+    }
+}
+
+static void InflateStored(struct Inflater *inf)
+{
+    GetBits(inf, inf->bitCount & 7);
+
+    unsigned length = GetBits(inf, 16);
+    unsigned complement = GetBits(inf, 16);
+
+    if (length != (~complement & 0xFFFF))
+        FATAL_ERROR("Invalid stored deflate block in \"%s\".\n", inf->path);
+
+    if (length > inf->destSize - inf->destPos)
+        FATAL_ERROR("Too much image data in \"%s\".\n", inf->path);
+
+    for (unsigned i = 0; i < length; i++)
+        inf->dest[inf->destPos++] = GetBits(inf, 8);
+}
+
+// Inflates a zlib stream, which must fill dest exactly.
+static void Inflate(char *path, const unsigned char *src, size_t srcSize, unsigned char *dest, size_t destSize)
+{
+    struct Inflater inf = { path, src, srcSize, 0, 0, 0, dest, destSize, 0 };
+
+    if (srcSize < 6 || (src[0] & 0x0F) != 8 || ((src[0] << 8) | src[1]) % 31 != 0 || (src[1] & 0x20))
+        FATAL_ERROR("Invalid zlib header in \"%s\".\n", path);
+
+    inf.srcPos = 2;
+
+    bool last;
+
+    do
+    {
+        last = GetBits(&inf, 1);
+
+        switch (GetBits(&inf, 2))
+        {
+        case 0:
+            InflateStored(&inf);
+            break;
+        case 1:
+            InflateBlock(&inf, &sFixedLiterals, &sFixedDistances);
+            break;
+        case 2:
+        {
+            struct InflateTable literals;
+            struct InflateTable distances;
+
+            ReadDynamicTables(&inf, &literals, &distances);
+            InflateBlock(&inf, &literals, &distances);
+            break;
+        }
+        default:
+            FATAL_ERROR("Invalid deflate block type in \"%s\".\n", path);
+        }
+    } while (!last);
+
+    if (inf.destPos != destSize)
+        FATAL_ERROR("Not enough image data in \"%s\".\n", path);
+
+    // Give back the whole bytes still in the bit buffer, then check the
+    // Adler-32 checksum that follows.
+    size_t end = inf.srcPos - inf.bitCount / 8;
+
+    if (end + 4 > srcSize)
+        FATAL_ERROR("Truncated image data in \"%s\".\n", path);
+
+    uint32_t expected = ((uint32_t)src[end] << 24) | (src[end + 1] << 16) | (src[end + 2] << 8) | src[end + 3];
+    uint32_t a = 1;
+    uint32_t b = 0;
+
+    for (size_t i = 0; i < destSize;)
+    {
+        // 5552 bytes is as many as can be summed before b could overflow.
+        size_t blockEnd = i + 5552 < destSize ? i + 5552 : destSize;
+
+        for (; i < blockEnd; i++)
+        {
+            a += dest[i];
+            b += a;
+        }
+
+        a %= 65521;
+        b %= 65521;
+    }
+
+    if (((b << 16) | a) != expected)
+        FATAL_ERROR("Image data checksum mismatch in \"%s\".\n", path);
+}
+
+static inline uint32_t ReadBigEndian32(const unsigned char *p)
+{
+    return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static uint32_t Crc32(const unsigned char *data, size_t size)
+{
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (size_t i = 0; i < size; i++)
+        crc = sCrcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+    return crc ^ 0xFFFFFFFF;
+}
+
+static inline unsigned char Paeth(unsigned char a, unsigned char b, unsigned char c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+
+    if (pa <= pb && pa <= pc)
+        return a;
+    if (pb <= pc)
+        return b;
+    return c;
+}
+
+// Every supported format has less than a byte per pixel (or exactly one),
+// so filters always look one byte back.
+static void Unfilter(char *path, const unsigned char *src, unsigned char *dest, int rowBytes, int height)
+{
+    const unsigned char *prev = NULL;
+
+    for (int y = 0; y < height; y++)
+    {
+        int filter = *src++;
+        unsigned char *row = dest + (size_t)y * rowBytes;
+
+        switch (filter)
+        {
+        case 0:
+            memcpy(row, src, rowBytes);
+            break;
+        case 1:
+            row[0] = src[0];
+            for (int x = 1; x < rowBytes; x++)
+                row[x] = src[x] + row[x - 1];
+            break;
+        case 2:
+            for (int x = 0; x < rowBytes; x++)
+                row[x] = src[x] + (prev ? prev[x] : 0);
+            break;
+        case 3:
+            for (int x = 0; x < rowBytes; x++)
+            {
+                int left = x > 0 ? row[x - 1] : 0;
+                int up = prev ? prev[x] : 0;
+                row[x] = src[x] + ((left + up) >> 1);
+            }
+            break;
+        case 4:
+            for (int x = 0; x < rowBytes; x++)
+            {
+                int left = x > 0 ? row[x - 1] : 0;
+                int up = prev ? prev[x] : 0;
+                int upLeft = (x > 0 && prev) ? prev[x - 1] : 0;
+                row[x] = src[x] + Paeth(left, up, upLeft);
+            }
+            break;
+        default:
+            FATAL_ERROR("Invalid row filter %d in \"%s\".\n", filter, path);
+        }
+
+        src += rowBytes;
+        prev = row;
+    }
+}
+
+bool DecodeIndexedPng(char *path, const unsigned char *data, int size, bool paletteOnly, struct DecodedPng *png)
+{
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+    pthread_once(&sInitOnce, InitTables);
+
+    if (size < 8 + 25 || memcmp(data, signature, 8) != 0)
+        FATAL_ERROR("\"%s\" does not have a valid PNG signature.\n", path);
+
+    // The first chunk must be IHDR.
+    const unsigned char *ihdr = data + 16;
+
+    if (ReadBigEndian32(data + 8) != 13 || memcmp(data + 12, "IHDR", 4) != 0)
+        FATAL_ERROR("\"%s\" does not start with a PNG header.\n", path);
+
+    uint32_t width = ReadBigEndian32(ihdr);
+    uint32_t height = ReadBigEndian32(ihdr + 4);
+    int bitDepth = ihdr[8];
+    int colorType = ihdr[9];
+    int interlace = ihdr[12];
+
+    if (colorType != PNG_COLOR_GRAY && colorType != PNG_COLOR_PALETTE)
+        return false;
+    if (bitDepth != 1 && bitDepth != 2 && bitDepth != 4 && bitDepth != 8)
+        return false;
+    if (interlace != 0 || ihdr[10] != 0 || ihdr[11] != 0)
+        return false;
+    if (width == 0 || height == 0 || width > 0x10000 || height > 0x10000)
+        return false;
+
+    memset(png, 0, sizeof(*png));
+    png->width = width;
+    png->height = height;
+    png->bitDepth = bitDepth;
+    png->colorType = colorType;
+    png->rowBytes = (width * bitDepth + 7) / 8;
+
+    size_t idatSize = 0;
+    int pos = 8;
+    bool sawEnd = false;
+
+    while (!sawEnd)
+    {
+        if (pos + 12 > size)
+            FATAL_ERROR("\"%s\" is truncated.\n", path);
+
+        uint32_t length = ReadBigEndian32(data + pos);
+        const unsigned char *type = data + pos + 4;
+        const unsigned char *chunk = data + pos + 8;
+
+        if (length > (uint32_t)(size - pos - 12))
+            FATAL_ERROR("\"%s\" is truncated.\n", path);
+
+        if (Crc32(type, length + 4) != ReadBigEndian32(chunk + length))
+            FATAL_ERROR("CRC error in \"%s\".\n", path);
+
+        if (memcmp(type, "PLTE", 4) == 0)
+        {
+            if (length % 3 != 0 || length / 3 > 256)
+                FATAL_ERROR("Invalid palette in \"%s\".\n", path);
+
+            // Like libpng, ignore any entries that no pixel could use.
+            int numColors = length / 3;
+
+            if (numColors > (1 << bitDepth))
+                numColors = 1 << bitDepth;
+
+            png->hasPalette = true;
+            png->palette.numColors = numColors;
+
+            for (int i = 0; i < numColors; i++)
+            {
+                png->palette.colors[i].red = chunk[i * 3];
+                png->palette.colors[i].green = chunk[i * 3 + 1];
+                png->palette.colors[i].blue = chunk[i * 3 + 2];
+            }
+        }
+        else if (memcmp(type, "IDAT", 4) == 0)
+        {
+            if (!paletteOnly)
+            {
+                unsigned char *idat = ReserveScratch(&sIdat, &sIdatCapacity, idatSize + length, true);
+                memcpy(idat + idatSize, chunk, length);
+                idatSize += length;
+            }
+        }
+        else if (memcmp(type, "IHDR", 4) == 0)
+        {
+            if (pos != 8)
+                FATAL_ERROR("\"%s\" has more than one PNG header.\n", path);
+        }
+        else if (memcmp(type, "IEND", 4) == 0)
+        {
+            sawEnd = true;
+        }
+        else if (!(type[0] & 0x20))
+        {
+            FATAL_ERROR("\"%s\" has an unknown critical chunk.\n", path);
+        }
+
+        pos += length + 12;
+    }
+
+    if (colorType == PNG_COLOR_PALETTE && !png->hasPalette)
+        FATAL_ERROR("\"%s\" has no palette.\n", path);
+
+    if (paletteOnly)
+        return true;
+
+    size_t filteredSize = (size_t)height * (png->rowBytes + 1);
+    unsigned char *filtered = ReserveScratch(&sFiltered, &sFilteredCapacity, filteredSize, false);
+
+    Inflate(path, sIdat, idatSize, filtered, filteredSize);
+
+    png->pixels = malloc((size_t)height * png->rowBytes);
+
+    if (png->pixels == NULL)
+        FATAL_ERROR("Failed to allocate pixel buffer.\n");
+
+    Unfilter(path, filtered, png->pixels, png->rowBytes, height);
+
+    return true;
+}
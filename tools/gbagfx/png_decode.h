@@ -0,0 +1,33 @@
+#ifndef PNG_DECODE_H
+#define PNG_DECODE_H
+
+#include <stdbool.h>
+#include "gfx.h"
+
+#define PNG_COLOR_GRAY    0
+#define PNG_COLOR_PALETTE 3
+
+// A PNG's pixels, unpacked from the file but not converted: rows are
+// rowBytes apart and hold bitDepth-bit values, leftmost pixel in the high bits.
+struct DecodedPng
+{
+    int width;
+    int height;
+    int bitDepth;
+    int colorType;
+    int rowBytes;
+    bool hasPalette;
+    struct Palette palette;
+    unsigned char *pixels;
+};
+
+// Decodes non-interlaced grayscale and palette images of up to 8 bits per
+// pixel without libpng. Returns false, having done nothing, for any other
+// kind of PNG. If paletteOnly is set, the pixels are left NULL.
+bool DecodeIndexedPng(char *path, const unsigned char *data, int size, bool paletteOnly, struct DecodedPng *png);
+
+// Frees the calling thread's scratch buffers. They are allocated again, at
+// the smallest size that will do, by the next decode.
+void FreePngDecodeScratch(void);
+
+#endif // PNG_DECODE_H
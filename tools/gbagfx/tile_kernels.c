@@ -0,0 +1,326 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include "global.h"
+#include "tile_kernels.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TILE_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+// In a linear image the leftmost pixel of a pair is in the high nibble (and
+// the leftmost pixel of an octet in the high bit); the GBA stores them the
+// other way around. Inverting the colors maps n to (15 - n) or (255 - n),
+// which is the same as flipping every bit.
+
+static unsigned char sReverseBits[256];
+static pthread_once_t sInitOnce = PTHREAD_ONCE_INIT;
+static const struct TileKernels *sKernels;
+
+static inline uint32_t Load32(const unsigned char *p)
+{
+    uint32_t value;
+    memcpy(&value, p, 4);
+    return value;
+}
+
+static inline void Store32(unsigned char *p, uint32_t value)
+{
+    memcpy(p, &value, 4);
+}
+
+static inline uint64_t Load64(const unsigned char *p)
+{
+    uint64_t value;
+    memcpy(&value, p, 8);
+    return value;
+}
+
+static inline void Store64(unsigned char *p, uint64_t value)
+{
+    memcpy(p, &value, 8);
+}
+
+static inline uint32_t SwapNibbles32(uint32_t value)
+{
+    return ((value >> 4) & 0x0F0F0F0F) | ((value << 4) & 0xF0F0F0F0);
+}
+
+// Scalar kernels, one tile row per step.
+
+static void Gather1BppScalar(const unsigned char *src, int pitch, unsigned char *dest, unsigned char invertMask)
+{
+    for (int i = 0; i < 8; i++)
+        dest[i] = sReverseBits[src[i * pitch]] ^ invertMask;
+}
+
+static void Scatter1BppScalar(const unsigned char *src, unsigned char *dest, int pitch, unsigned char invertMask)
+{
+    for (int i = 0; i < 8; i++)
+        dest[i * pitch] = sReverseBits[src[i]] ^ invertMask;
+}
+
+static void Gather4BppScalar(const unsigned char *src, int pitch, unsigned char *dest, unsigned char invertMask)
+{
+    uint32_t mask = invertMask * 0x01010101u;
+
+    for (int i = 0; i < 8; i++)
+        Store32(&dest[i * 4], SwapNibbles32(Load32(&src[i * pitch])) ^ mask);
+}
+
+static void Scatter4BppScalar(const unsigned char *src, unsigned char *dest, int pitch, unsigned char invertMask)
+{
+    uint32_t mask = invertMask * 0x01010101u;
+
+    for (int i = 0; i < 8; i++)
+        Store32(&dest[i * pitch], SwapNibbles32(Load32(&src[i * 4])) ^ mask);
+}
+
+static void Gather8BppScalar(const unsigned char *src, int pitch, unsigned char *dest, unsigned char invertMask)
+{
+    uint64_t mask = invertMask * 0x0101010101010101ull;
+
+    for (int i = 0; i < 8; i++)
+        Store64(&dest[i * 8], Load64(&src[i * pitch]) ^ mask);
+}
+
+static void Scatter8BppScalar(const unsigned char *src, unsigned char *dest, int pitch, unsigned char invertMask)
+{
+    uint64_t mask = invertMask * 0x0101010101010101ull;
+
+    for (int i = 0; i < 8; i++)
+        Store64(&dest[i * pitch], Load64(&src[i * 8]) ^ mask);
+}
+
+static const struct TileKernels sScalarKernels =
+{
+    .name = "scalar",
+    .gather = { [1] = Gather1BppScalar, [4] = Gather4BppScalar, [8] = Gather8BppScalar },
+    .scatter = { [1] = Scatter1BppScalar, [4] = Scatter4BppScalar, [8] = Scatter8BppScalar },
+};
+
+#ifdef TILE_KERNELS_X86
+
+// SSE2 kernels. A 4bpp tile row is only 4 bytes, so four rows are packed
+// into each register; an 8bpp tile fills two rows per register.
+
+#define SSE2 __attribute__((target("sse2")))
+#define AVX2 __attribute__((target("avx2")))
+
+static inline SSE2 __m128i SwapNibblesSse2(__m128i value)
+{
+    __m128i lowNibbles = _mm_set1_epi8(0x0F);
+    __m128i high = _mm_and_si128(_mm_srli_epi16(value, 4), lowNibbles);
+    __m128i low = _mm_slli_epi16(_mm_and_si128(value, lowNibbles), 4);
+    return _mm_or_si128(high, low);
+}
+
+static inline SSE2 __m128i Load4RowsSse2(const unsigned char *src, int pitch)
+{
+    return _mm_setr_epi32(Load32(src), Load32(src + pitch), Load32(src + 2 * pitch), Load32(src + 3 * pitch));
+}
+
+static inline SSE2 void Store4RowsSse2(unsigned char *dest, int pitch, __m128i rows)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        Store32(dest + i * pitch, _mm_cvtsi128_si32(rows));
+        rows = _mm_srli_si128(rows, 4);
+    }
+}
+
+static inline SSE2 __m128i Load2RowsSse2(const unsigned char *src, int pitch)
+{
+    return _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)src), _mm_loadl_epi64((const __m128i *)(src + pitch)));
+}
+
+static inline SSE2 void Store2RowsSse2(unsigned char *dest, int pitch, __m128i rows)
+{
+    _mm_storel_epi64((__m128i *)dest, rows);
+    _mm_storel_epi64((__m128i *)(dest + pitch), _mm_unpackhi_epi64(rows, rows));
+}
+
+static SSE2 void Gather4BppSse2(const unsigned char *src, int pitch, unsigned char *dest, unsigned char invertMask)
+{
+    __m128i mask = _mm_set1_epi8(invertMask);
+
+    for (int i = 0; i < 2; i++)
+    {
+        __m128i rows = Load4RowsSse2(src + i * 4 * pitch, pitch);
+        _mm_storeu_si128((__m128i *)(dest + i * 16), _mm_xor_si128(SwapNibblesSse2(rows), mask));
+    }
+}
+
+static SSE2 void Scatter4BppSse2(const unsigned char *src, unsigned char *dest, int pitch, unsigned char invertMask)
+{
+    __m128i mask = _mm_set1_epi8(invertMask);
+
+    for (int i = 0; i < 2; i++)
+    {
+        __m128i rows = _mm_loadu_si128((const __m128i *)(src + i * 16));
+        Store4RowsSse2(dest + i * 4 * pitch, pitch, _mm_xor_si128(SwapNibblesSse2(rows), mask));
+    }
+}
+
+static SSE2 void Gather8BppSse2(const unsigned char *src, int pitch, unsigned char *dest, unsigned char invertMask)
+{
+    __m128i mask = _mm_set1_epi8(invertMask);
+
+    for (int i = 0; i < 4; i++)
+    {
+        __m128i rows = Load2RowsSse2(src + i * 2 * pitch, pitch);
+        _mm_storeu_si128((__m128i *)(dest + i * 16), _mm_xor_si128(rows, mask));
+    }
+}
+
+static SSE2 void Scatter8BppSse2(const unsigned char *src, unsigned char *dest, int pitch, unsigned char invertMask)
+{
+    __m128i mask = _mm_set1_epi8(invertMask);
+
+    for (int i = 0; i < 4; i++)
+    {
+        __m128i rows = _mm_loadu_si128((const __m128i *)(src + i * 16));
+        Store2RowsSse2(dest + i * 2 * pitch, pitch, _mm_xor_si128(rows, mask));
+    }
+}
+
+static const struct TileKernels sSse2Kernels =
+{
+    .name = "sse2",
+    .gather = { [1] = Gather1BppScalar, [4] = Gather4BppSse2, [8] = Gather8BppSse2 },
+    .scatter = { [1] = Scatter1BppScalar, [4] = Scatter4BppSse2, [8] = Scatter8BppSse2 },
+};
+
+// AVX2 kernels. A whole 4bpp tile fits in one register, an 8bpp tile in two.
+
+static inline AVX2 __m256i SwapNibblesAvx2(__m256i value)
+{
+    __m256i lowNibbles = _mm256_set1_epi8(0x0F);
+    __m256i high = _mm256_and_si256(_mm256_srli_epi16(value, 4), lowNibbles);
+    __m256i low = _mm256_slli_epi16(_mm256_and_si256(value, lowNibbles), 4);
+    return _mm256_or_si256(high, low);
+}
+
+static inline AVX2 __m256i Combine128Avx2(__m128i low, __m128i high)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+}
+
+static AVX2 void Gather4BppAvx2(const unsigned char *src, int pitch, unsigned char *dest, unsigned char invertMask)
+{
+    __m256i rows = Combine128Avx2(Load4RowsSse2(src, pitch), Load4RowsSse2(src + 4 * pitch, pitch));
+    _mm256_storeu_si256((__m256i *)dest, _mm256_xor_si256(SwapNibblesAvx2(rows), _mm256_set1_epi8(invertMask)));
+}
+
+static AVX2 void Scatter4BppAvx2(const unsigned char *src, unsigned char *dest, int pitch, unsigned char invertMask)
+{
+    __m256i rows = _mm256_loadu_si256((const __m256i *)src);
+    rows = _mm256_xor_si256(SwapNibblesAvx2(rows), _mm256_set1_epi8(invertMask));
+    Store4RowsSse2(dest, pitch, _mm256_castsi256_si128(rows));
+    Store4RowsSse2(dest + 4 * pitch, pitch, _mm256_extracti128_si256(rows, 1));
+}
+
+static AVX2 void Gather8BppAvx2(const unsigned char *src, int pitch, unsigned char *dest, unsigned char invertMask)
+{
+    __m256i mask = _mm256_set1_epi8(invertMask);
+
+    for (int i = 0; i < 2; i++)
+    {
+        const unsigned char *rowsSrc = src + i * 4 * pitch;
+        __m256i rows = Combine128Avx2(Load2RowsSse2(rowsSrc, pitch), Load2RowsSse2(rowsSrc + 2 * pitch, pitch));
+        _mm256_storeu_si256((__m256i *)(dest + i * 32), _mm256_xor_si256(rows, mask));
+    }
+}
+
+static AVX2 void Scatter8BppAvx2(const unsigned char *src, unsigned char *dest, int pitch, unsigned char invertMask)
+{
+    __m256i mask = _mm256_set1_epi8(invertMask);
+
+    for (int i = 0; i < 2; i++)
+    {
+        unsigned char *rowsDest = dest + i * 4 * pitch;
+        __m256i rows = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(src + i * 32)), mask);
+        Store2RowsSse2(rowsDest, pitch, _mm256_castsi256_si128(rows));
+        Store2RowsSse2(rowsDest + 2 * pitch, pitch, _mm256_extracti128_si256(rows, 1));
+    }
+}
+
+static const struct TileKernels sAvx2Kernels =
+{
+    .name = "avx2",
+    .gather = { [1] = Gather1BppScalar, [4] = Gather4BppAvx2, [8] = Gather8BppAvx2 },
+    .scatter = { [1] = Scatter1BppScalar, [4] = Scatter4BppAvx2, [8] = Scatter8BppAvx2 },
+};
+
+#endif // TILE_KERNELS_X86
+
+// Fastest first.
+int GetSupportedTileKernels(const struct TileKernels **list, int maxCount)
+{
+    int count = 0;
+
+#ifdef TILE_KERNELS_X86
+    __builtin_cpu_init();
+
+    if (count < maxCount && __builtin_cpu_supports("avx2"))
+        list[count++] = &sAvx2Kernels;
+
+    if (count < maxCount && __builtin_cpu_supports("sse2"))
+        list[count++] = &sSse2Kernels;
+#endif
+
+    if (count < maxCount)
+        list[count++] = &sScalarKernels;
+
+    return count;
+}
+
+static void InitTileKernels(void)
+{
+    for (int i = 0; i < 256; i++)
+    {
+        unsigned char reversed = 0;
+
+        for (int j = 0; j < 8; j++)
+            reversed |= ((i >> j) & 1) << (7 - j);
+
+        sReverseBits[i] = reversed;
+    }
+
+    const struct TileKernels *supported[3];
+    int numSupported = GetSupportedTileKernels(supported, 3);
+    const char *name = getenv("GBAGFX_TILE_KERNELS");
+
+    sKernels = supported[0];
+
+    if (name != NULL && name[0] != 0)
+    {
+        int i;
+
+        for (i = 0; i < numSupported; i++)
+        {
+            if (strcmp(supported[i]->name, name) == 0)
+                break;
+        }
+
+        if (i == numSupported)
+            FATAL_ERROR("Tile kernels \"%s\" aren't supported on this machine.\n", name);
+
+        sKernels = supported[i];
+    }
+}
+
+const struct TileKernels *GetTileKernels(void)
+{
+    pthread_once(&sInitOnce, InitTileKernels);
+    return sKernels;
+}
+
+// Not thread-safe; only for benchmarking.
+void SetTileKernels(const struct TileKernels *kernels)
+{
+    pthread_once(&sInitOnce, InitTileKernels);
+    sKernels = kernels;
+}
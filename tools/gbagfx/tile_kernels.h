@@ -0,0 +1,23 @@
+#ifndef TILE_KERNELS_H
+#define TILE_KERNELS_H
+
+// Kernels that move one 8x8 tile between a linear image, whose rows are
+// `pitch` bytes apart, and the packed GBA tile format. `invertMask` is 0xFF
+// to invert the colors and 0 otherwise.
+typedef void (*TileGatherFunc)(const unsigned char *src, int pitch, unsigned char *dest, unsigned char invertMask);
+typedef void (*TileScatterFunc)(const unsigned char *src, unsigned char *dest, int pitch, unsigned char invertMask);
+
+struct TileKernels
+{
+    const char *name;
+    TileGatherFunc gather[9];
+    TileScatterFunc scatter[9];
+};
+
+// Returns the fastest kernels this CPU supports, unless the
+// GBAGFX_TILE_KERNELS environment variable names another set.
+const struct TileKernels *GetTileKernels(void);
+void SetTileKernels(const struct TileKernels *kernels);
+int GetSupportedTileKernels(const struct TileKernels **list, int maxCount);
+
+#endif // TILE_KERNELS_H
@@ -0,0 +1,4 @@
+// gflib/malloc.c as the ROM builds it.
+#define HEAP_NAME(name) FirstFit_##name
+#include "heap_variant.h"
+#include "../../gflib/malloc.c"
@@ -0,0 +1,25 @@
+#ifndef GUARD_HEAPBENCH_GLOBAL_H
+#define GUARD_HEAPBENCH_GLOBAL_H
+
+// Stands in for include/global.h when gflib/malloc.c is built for the host.
+// Pointers are 8 bytes here, so block headers are bigger than on the GBA.
+
+#include <stdint.h>
+#include <string.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef u16 bool16;
+typedef u32 bool32;
+
+#define TRUE 1
+#define FALSE 0
+
+#define EWRAM_DATA
+#define UNUSED __attribute__((unused))
+
+#define CpuFill32(value, dest, size) memset(dest, value, size)
+#define AGBPrintf(...)
+
+#endif // GUARD_HEAPBENCH_GLOBAL_H
@@ -0,0 +1,21 @@
+#ifndef GUARD_HEAP_VARIANT_H
+#define GUARD_HEAP_VARIANT_H
+
+// Renames everything gflib/malloc.c exports with HEAP_NAME, so that both
+// of its allocators can be linked into heapbench.
+
+#define PutMemBlockHeader HEAP_NAME(PutMemBlockHeader)
+#define PutFirstMemBlockHeader HEAP_NAME(PutFirstMemBlockHeader)
+#define AllocInternal HEAP_NAME(AllocInternal)
+#define FreeInternal HEAP_NAME(FreeInternal)
+#define AllocZeroedInternal HEAP_NAME(AllocZeroedInternal)
+#define CheckMemBlockInternal HEAP_NAME(CheckMemBlockInternal)
+#define InitHeap HEAP_NAME(InitHeap)
+#define Alloc HEAP_NAME(Alloc)
+#define AllocZeroed HEAP_NAME(AllocZeroed)
+#define Free HEAP_NAME(Free)
+#define CheckMemBlock HEAP_NAME(CheckMemBlock)
+#define CheckHeap HEAP_NAME(CheckHeap)
+#define gHeapStats HEAP_NAME(gHeapStats)
+
+#endif // GUARD_HEAP_VARIANT_H
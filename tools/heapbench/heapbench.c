@@ -0,0 +1,452 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include "global.h"
+
+#define SIZE_CLASS_HEAP
+#include "../../gflib/malloc.h"
+#undef malloc
+#undef calloc
+#undef free
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+// heapbench replays a sequence of Alloc and Free calls against both of
+// gflib/malloc.c's allocators: the first-fit one the ROM uses and the one
+// SIZE_CLASS_HEAP selects. Traces are recorded by building with HEAP_TRACE
+// (see include/config.h), which logs each call with AGBPrintf as
+// "heap a ADDRESS SIZE" or "heap f ADDRESS"; other lines are ignored, so an
+// emulator's log can be given as is. Without trace files, a synthetic one
+// is generated that enters and leaves a number of screens, each of which
+// allocates its buffers, churns small blocks and frees everything but a few
+// blocks that outlive it for a while.
+
+static const char *const USAGE =
+    "Usage: heapbench [-n REPEATS] [-scenes N] [-seed N] [-verify] [TRACE...]\n";
+
+void FirstFit_InitHeap(void *heapStart, u32 heapSize);
+void *FirstFit_Alloc(u32 size);
+void FirstFit_Free(void *pointer);
+bool32 FirstFit_CheckHeap(void);
+
+void SizeClass_InitHeap(void *heapStart, u32 heapSize);
+void *SizeClass_Alloc(u32 size);
+void SizeClass_Free(void *pointer);
+bool32 SizeClass_CheckHeap(void);
+extern struct HeapStats SizeClass_gHeapStats;
+
+struct Allocator
+{
+    const char *name;
+    void (*initHeap)(void *heapStart, u32 heapSize);
+    void *(*alloc)(u32 size);
+    void (*free)(void *pointer);
+    bool32 (*checkHeap)(void);
+};
+
+static const struct Allocator sAllocators[] =
+{
+    {"first-fit", FirstFit_InitHeap, FirstFit_Alloc, FirstFit_Free, FirstFit_CheckHeap},
+    {"size-class", SizeClass_InitHeap, SizeClass_Alloc, SizeClass_Free, SizeClass_CheckHeap},
+};
+
+// An Alloc stores its result in slots[slot] and a Free frees it.
+struct HeapEvent
+{
+    bool isAlloc;
+    u32 slot;
+    u32 size;
+};
+
+struct Trace
+{
+    struct HeapEvent *events;
+    int numEvents;
+    int capacity;
+    u32 numSlots;
+};
+
+static _Alignas(8) u8 sHeap[HEAP_SIZE];
+static struct HeapStats sSizeClassStats;
+
+static void AddEvent(struct Trace *trace, bool isAlloc, u32 slot, u32 size)
+{
+    if (trace->numEvents == trace->capacity)
+    {
+        trace->capacity = trace->capacity ? trace->capacity * 2 : 1024;
+        trace->events = realloc(trace->events, trace->capacity * sizeof(struct HeapEvent));
+
+        if (trace->events == NULL)
+            FATAL_ERROR("Failed to allocate memory for trace.\n");
+    }
+
+    trace->events[trace->numEvents++] = (struct HeapEvent){isAlloc, slot, size};
+}
+
+// Maps the addresses in a trace to the slot of the allocation that is live
+// there, with open addressing.
+#define ADDRESS_TABLE_SIZE (1 << 16)
+
+struct AddressEntry
+{
+    u32 address;
+    u32 slot;
+};
+
+static u32 HashAddress(u32 address)
+{
+    return (address * 2654435761u) >> 16;
+}
+
+static void ReadTrace(struct Trace *trace, const char *path)
+{
+    FILE *fp = fopen(path, "r");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", path);
+
+    struct AddressEntry *table = calloc(ADDRESS_TABLE_SIZE, sizeof(struct AddressEntry));
+    char line[256];
+    int numLive = 0;
+
+    if (table == NULL)
+        FATAL_ERROR("Failed to allocate memory for address table.\n");
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        char *event = strstr(line, "heap ");
+        unsigned address;
+        unsigned size;
+
+        if (event == NULL)
+            continue;
+
+        if (sscanf(event, "heap a %x %u", &address, &size) == 2)
+        {
+            u32 slot = trace->numSlots++;
+
+            AddEvent(trace, true, slot, size);
+
+            if (address == 0)
+                continue;
+
+            if (++numLive >= ADDRESS_TABLE_SIZE / 2)
+                FATAL_ERROR("Too many live allocations in \"%s\".\n", path);
+
+            u32 i = HashAddress(address);
+
+            while (table[i].address != 0 && table[i].address != address)
+                i = (i + 1) % ADDRESS_TABLE_SIZE;
+
+            table[i].address = address;
+            table[i].slot = slot;
+        }
+        else if (sscanf(event, "heap f %x", &address) == 1)
+        {
+            u32 i = HashAddress(address);
+
+            while (table[i].address != 0 && table[i].address != address)
+                i = (i + 1) % ADDRESS_TABLE_SIZE;
+
+            if (table[i].address == 0)
+            {
+                fprintf(stderr, "%s: free of unknown address %X, ignoring.\n", path, address);
+                continue;
+            }
+
+            AddEvent(trace, false, table[i].slot, 0);
+
+            // Remove the entry, moving up any later entries of its run.
+            u32 hole = i;
+
+            table[hole].address = 0;
+            numLive--;
+
+            for (i = (i + 1) % ADDRESS_TABLE_SIZE; table[i].address != 0; i = (i + 1) % ADDRESS_TABLE_SIZE)
+            {
+                u32 home = HashAddress(table[i].address);
+
+                if ((i > hole && (home <= hole || home > i)) || (i < hole && home <= hole && home > i))
+                {
+                    table[hole] = table[i];
+                    table[i].address = 0;
+                    hole = i;
+                }
+            }
+        }
+    }
+
+    free(table);
+    fclose(fp);
+}
+
+static u32 sRandomState;
+
+static u32 Random(u32 range)
+{
+    sRandomState = sRandomState * 1103515245 + 12345;
+    return (sRandomState >> 8) % range;
+}
+
+static u32 RandomBlockSize(void)
+{
+    u32 kind = Random(100);
+
+    if (kind < 70)
+        return 4 + Random(64) * 4;
+    else if (kind < 95)
+        return 0x100 + Random(0x700);
+    else
+        return 0x800 << Random(3);
+}
+
+// Each scene allocates its buffers, then allocates and frees small blocks
+// as it runs, then frees everything except a few blocks that are only
+// freed two scenes later. A few blocks are allocated first and never freed.
+static void GenerateTrace(struct Trace *trace, int numScenes)
+{
+    enum { MAX_LIVE = 256 };
+    u32 live[MAX_LIVE];
+    u32 survivors[3][8];
+    int numSurvivors[3] = {0};
+    int numLive;
+    u32 liveBytes;
+    int i;
+
+    for (i = 0; i < 8; i++)
+        AddEvent(trace, true, trace->numSlots++, RandomBlockSize());
+
+    for (int scene = 0; scene < numScenes; scene++)
+    {
+        int numBuffers = 20 + Random(40);
+        int survivorGen = scene % 3;
+
+        numLive = 0;
+        liveBytes = 0;
+
+        for (i = 0; i < numBuffers && liveBytes < HEAP_SIZE / 2; i++)
+        {
+            u32 size = RandomBlockSize();
+
+            live[numLive++] = trace->numSlots;
+            liveBytes += size;
+            AddEvent(trace, true, trace->numSlots++, size);
+        }
+
+        for (i = 0; i < 100; i++)
+        {
+            if (numLive > 0 && (Random(2) || numLive == MAX_LIVE))
+            {
+                int victim = Random(numLive);
+
+                AddEvent(trace, false, live[victim], 0);
+                live[victim] = live[--numLive];
+            }
+            else
+            {
+                live[numLive++] = trace->numSlots;
+                AddEvent(trace, true, trace->numSlots++, 4 + Random(48) * 4);
+            }
+        }
+
+        for (i = 0; i < numSurvivors[survivorGen]; i++)
+            AddEvent(trace, false, survivors[survivorGen][i], 0);
+
+        numSurvivors[survivorGen] = 0;
+
+        while (numLive > 0)
+        {
+            int victim = Random(numLive);
+
+            if (numSurvivors[survivorGen] < 8 && Random(10) == 0)
+                survivors[survivorGen][numSurvivors[survivorGen]++] = live[victim];
+            else
+                AddEvent(trace, false, live[victim], 0);
+
+            live[victim] = live[--numLive];
+        }
+    }
+}
+
+static double GetSeconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Returns the size of the largest block that can be allocated.
+static u32 FindLargestAllocation(const struct Allocator *allocator)
+{
+    u32 low = 0;
+    u32 high = HEAP_SIZE;
+
+    while (low < high)
+    {
+        u32 size = (low + high + 1) / 2;
+        void *mem = allocator->alloc(size);
+
+        if (mem != NULL)
+        {
+            allocator->free(mem);
+            low = size;
+        }
+        else
+        {
+            high = size - 1;
+        }
+    }
+
+    return low;
+}
+
+// Fills each block with its slot number and checks it when it's freed, and
+// checks the whole heap after every event.
+static void VerifyTrace(const struct Allocator *allocator, const struct Trace *trace, void **slots, u32 *sizes)
+{
+    allocator->initHeap(sHeap, HEAP_SIZE);
+
+    for (int i = 0; i < trace->numEvents; i++)
+    {
+        const struct HeapEvent *event = &trace->events[i];
+
+        if (event->isAlloc)
+        {
+            slots[event->slot] = allocator->alloc(event->size);
+            sizes[event->slot] = event->size;
+
+            if (slots[event->slot] != NULL)
+                memset(slots[event->slot], event->slot & 0xFF, event->size);
+        }
+        else if (slots[event->slot] != NULL)
+        {
+            u8 *mem = slots[event->slot];
+
+            for (u32 j = 0; j < sizes[event->slot]; j++)
+            {
+                if (mem[j] != (event->slot & 0xFF))
+                    FATAL_ERROR("%s: block %u was overwritten before event %d.\n", allocator->name, event->slot, i);
+            }
+
+            allocator->free(mem);
+            slots[event->slot] = NULL;
+        }
+
+        if (!allocator->checkHeap())
+            FATAL_ERROR("%s: heap is corrupt after event %d.\n", allocator->name, i);
+    }
+}
+
+static void RunBenchmark(const struct Allocator *allocator, const struct Trace *trace, int numRepeats, bool verify)
+{
+    void **slots = calloc(trace->numSlots ? trace->numSlots : 1, sizeof(void *));
+    u32 *sizes = calloc(trace->numSlots ? trace->numSlots : 1, sizeof(u32));
+    int numFailed = 0;
+    double seconds = 0.0;
+
+    if (slots == NULL || sizes == NULL)
+        FATAL_ERROR("Failed to allocate memory for slots.\n");
+
+    if (verify)
+        VerifyTrace(allocator, trace, slots, sizes);
+
+    for (int repeat = 0; repeat < numRepeats; repeat++)
+    {
+        allocator->initHeap(sHeap, HEAP_SIZE);
+        memset(slots, 0, trace->numSlots * sizeof(void *));
+
+        double start = GetSeconds();
+
+        for (int i = 0; i < trace->numEvents; i++)
+        {
+            const struct HeapEvent *event = &trace->events[i];
+
+            if (event->isAlloc)
+                slots[event->slot] = allocator->alloc(event->size);
+            else
+                allocator->free(slots[event->slot]);
+        }
+
+        seconds += GetSeconds() - start;
+    }
+
+    for (int i = 0; i < trace->numEvents; i++)
+    {
+        if (trace->events[i].isAlloc && slots[trace->events[i].slot] == NULL)
+            numFailed++;
+    }
+
+    // Before FindLargestAllocation's allocations change the peak.
+    if (allocator->checkHeap == SizeClass_CheckHeap)
+    {
+        SizeClass_CheckHeap();
+        sSizeClassStats = SizeClass_gHeapStats;
+    }
+
+    printf("%-10s  %8.1f  %6d  %10u\n", allocator->name,
+        seconds * 1e9 / ((double)trace->numEvents * numRepeats), numFailed, FindLargestAllocation(allocator));
+
+    free(slots);
+    free(sizes);
+}
+
+int main(int argc, char **argv)
+{
+    struct Trace trace = {0};
+    int numRepeats = 20;
+    int numScenes = 500;
+    bool verify = false;
+    int i;
+
+    sRandomState = 1;
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++)
+    {
+        if (strcmp(argv[i], "-verify") == 0)
+            verify = true;
+        else if (i + 1 >= argc)
+            FATAL_ERROR(USAGE);
+        else if (strcmp(argv[i], "-n") == 0)
+            numRepeats = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-scenes") == 0)
+            numScenes = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-seed") == 0)
+            sRandomState = strtoul(argv[++i], NULL, 0);
+        else
+            FATAL_ERROR(USAGE);
+    }
+
+    if (numRepeats < 1)
+        numRepeats = 1;
+
+    if (i == argc)
+        GenerateTrace(&trace, numScenes);
+
+    for (; i < argc; i++)
+        ReadTrace(&trace, argv[i]);
+
+    if (trace.numEvents == 0)
+        FATAL_ERROR("No heap events found.\n");
+
+    printf("%d events, %u allocations\n\n", trace.numEvents, trace.numSlots);
+    printf("allocator     ns/op  failed  largest free\n");
+
+    for (size_t j = 0; j < sizeof(sAllocators) / sizeof(sAllocators[0]); j++)
+        RunBenchmark(&sAllocators[j], &trace, numRepeats, verify);
+
+    printf("\nsize-class peak: %u bytes in %u blocks, fragmentation at end: %u%%\n",
+        sSizeClassStats.peakUsedBytes, sSizeClassStats.peakNumAllocs, sSizeClassStats.fragmentation);
+
+    free(trace.events);
+    return 0;
+}
@@ -0,0 +1,5 @@
+// gflib/malloc.c with SIZE_CLASS_HEAP from include/config.h.
+#define SIZE_CLASS_HEAP
+#define HEAP_NAME(name) SizeClass_##name
+#include "heap_variant.h"
+#include "../../gflib/malloc.c"
@@ -2834,7 +2834,7 @@ class Renderer {
         break;
     }
     try {
-      return &m_data->at(json::json_pointer(ptr.data()));
+      return &lookup(ptr);
     } catch (std::exception&) {
       // try to evaluate as a no-argument callback
       if (auto callback = m_callbacks.find_callback(bc.str, 0)) {
@@ -2868,15 +2868,12 @@ class Renderer {
     LoopLevel& level = m_loop_stack.back();
 
     if (level.loop_type == LoopLevel::Type::Array) {
-      level.data[static_cast<std::string>(level.value_name)] = level.values.at(level.index);  // *level.it;
-      auto& loopData = level.data["loop"];
-      loopData["index"] = level.index;
-      loopData["index1"] = level.index + 1;
-      loopData["is_first"] = (level.index == 0);
-      loopData["is_last"] = (level.index == level.size - 1);
+      level.loop["index"] = level.index;
+      level.loop["index1"] = level.index + 1;
+      level.loop["is_first"] = (level.index == 0);
+      level.loop["is_last"] = (level.index == level.size - 1);
     } else {
-      level.data[static_cast<std::string>(level.key_name)] = level.map_it->first;
-      level.data[static_cast<std::string>(level.value_name)] = *level.map_it->second;
+      level.key = static_cast<std::string>(level.map_it->first);
     }
   }
 
@@ -2892,7 +2889,9 @@ class Renderer {
     Type loop_type;
     nonstd::string_view key_name;   // variable name for keys
     nonstd::string_view value_name; // variable name for values
-    json data;                      // data with loop info added
+    json loop;                      // "loop" variable
+    bool has_loop;                  // whether "loop" is defined at this level
+    json key;                       // current key when looping over a map
 
     json values;                    // values to iterate over
 
@@ -2913,6 +2912,72 @@ class Renderer {
 
   std::vector<const json*> m_tmp_args;
   json m_tmp_val;
+  json m_merged_data;
+
+  // Loop variables are looked up through the loop stack rather than by
+  // copying the whole data object into every loop level, which made
+  // rendering large data quadratic. A variable resolves to the innermost
+  // loop that defines it, otherwise to the data passed to render_to.
+  const json* find_loop_var(const LoopLevel& level, nonstd::string_view name) const {
+    if (level.loop_type == LoopLevel::Type::Array) {
+      if (name == "loop") {
+        return &level.loop;
+      }
+      if (name == level.value_name) {
+        return &level.values.at(level.index);
+      }
+    } else {
+      if (name == level.value_name) {
+        return level.map_it->second;
+      }
+      if (name == level.key_name) {
+        return &level.key;
+      }
+      if (name == "loop" && level.has_loop) {
+        return &level.loop;
+      }
+    }
+    return nullptr;
+  }
+
+  const json& lookup(nonstd::string_view ptr) {
+    if (ptr.size() < 2 || m_loop_stack.empty()) {
+      return (ptr.size() < 2 ? merged_data() : *m_data).at(json::json_pointer(static_cast<std::string>(ptr)));
+    }
+
+    size_t name_end = ptr.find('/', 1);
+    nonstd::string_view name = ptr.substr(1, name_end == nonstd::string_view::npos ? nonstd::string_view::npos : name_end - 1);
+
+    for (auto it = m_loop_stack.rbegin(); it != m_loop_stack.rend(); ++it) {
+      const json* var = find_loop_var(*it, name);
+      if (var != nullptr) {
+        if (name_end == nonstd::string_view::npos) {
+          return *var;
+        }
+        return var->at(json::json_pointer(static_cast<std::string>(ptr.substr(name_end))));
+      }
+    }
+
+    return m_data->at(json::json_pointer(static_cast<std::string>(ptr)));
+  }
+
+  // The data with all loop variables applied, for included templates.
+  const json& merged_data() {
+    m_merged_data = *m_data;
+    for (const LoopLevel& level : m_loop_stack) {
+      if (level.loop_type == LoopLevel::Type::Array) {
+        m_merged_data[static_cast<std::string>(level.value_name)] = level.values.at(level.index);
+        m_merged_data["loop"] = level.loop;
+      } else {
+        if (level.has_loop) {
+          m_merged_data["loop"] = level.loop;
+        }
+        m_merged_data[static_cast<std::string>(level.key_name)] = level.key;
+        m_merged_data[static_cast<std::string>(level.value_name)] = *level.map_it->second;
+      }
+    }
+    return m_merged_data;
+  }
 
 
  public:
@@ -3209,7 +3274,7 @@ class Renderer {
           break;
         }
         case Bytecode::Op::Include:
-          Renderer(m_included_templates, m_callbacks).render_to(os, m_included_templates.find(get_imm(bc)->get_ref<const std::string&>())->second, *m_data);
+          Renderer(m_included_templates, m_callbacks).render_to(os, m_included_templates.find(get_imm(bc)->get_ref<const std::string&>())->second, m_loop_stack.empty() ? *m_data : merged_data());
           break;
         case Bytecode::Op::Callback: {
           auto callback = m_callbacks.find_callback(bc.str, bc.args);
@@ -3240,13 +3305,29 @@ class Renderer {
             break;
           }
 
+          // provide parent access in nested loop
+          json parent_loop;
+          bool has_parent_loop = true;
+          try {
+            parent_loop = lookup("/loop");
+          } catch (std::exception&) {
+            has_parent_loop = false;
+          }
+
           m_loop_stack.emplace_back();
           LoopLevel& level = m_loop_stack.back();
           level.value_name = bc.str;
           level.values = std::move(m_stack.back());
-          level.data = (*m_data);
           m_stack.pop_back();
 
+          if (has_parent_loop) {
+            level.loop = parent_loop;
+            level.loop["parent"] = std::move(parent_loop);
+          } else {
+            level.loop = json::object();
+          }
+          level.has_loop = has_parent_loop;
+
           if (bc.value.is_string()) {
             // map iterator
             if (!level.values.is_object()) {
@@ -3272,17 +3353,9 @@ class Renderer {
             level.loop_type = LoopLevel::Type::Array;
             level.index = 0;
             level.size = level.values.size();
+            level.has_loop = true;
           }
 
-          // provide parent access in nested loop
-          auto parent_loop_it = level.data.find("loop");
-          if (parent_loop_it != level.data.end()) {
-            json loop_copy = *parent_loop_it;
-            (*parent_loop_it)["parent"] = std::move(loop_copy);
-          }
-
-          // set "current" data to loop data
-          m_data = &level.data;
           update_loop_data();
           break;
         }
@@ -3303,12 +3376,6 @@ class Renderer {
 
           if (done) {
             m_loop_stack.pop_back();
-            // set "current" data to outer loop data or main data as appropriate
-            if (!m_loop_stack.empty()) {
-              m_data = &m_loop_stack.back().data;
-            } else {
-              m_data = &data;
-            }
             break;
           }
 
@@ -1,42 +1,75 @@
 // jsonproc.cpp
 
 #include "jsonproc.h"
+#include "write_if_changed.h"
+
+#include <chrono>
+
+#include <cstdint>
+
+#include <fstream>
+using std::ifstream;
 
 #include <map>
 
 #include <string>
 using std::string; using std::to_string;
 
+#include <vector>
+using std::vector;
+
 #include <inja.hpp>
 using namespace inja;
 using json = nlohmann::json;
 
 std::map<string, string> customVars;
 
-void set_custom_var(string key, string value)
+// The files being processed by the current job, for doNotModifyHeader.
+string currentJsonFilepath;
+string currentTemplateFilepath;
+
+void set_custom_var(const string& key, const string& value)
 {
     customVars[key] = value;
 }
 
-string get_custom_var(string key)
+string get_custom_var(const string& key)
 {
     return customVars[key];
 }
 
-int main(int argc, char *argv[])
+double elapsed_ms(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+string read_text_file(const string& filepath)
 {
-    if (argc != 4)
-        FATAL_ERROR("USAGE: jsonproc <json-filepath> <template-filepath> <output-filepath>\n");
+    ifstream in_file(filepath, std::ifstream::binary);
 
-    string jsonfilepath = argv[1];
-    string templateFilepath = argv[2];
-    string outputFilepath = argv[3];
+    if (!in_file.is_open())
+        FATAL_ERROR("JSONPROC_ERROR: Cannot open file %s for reading.\n", filepath.c_str());
 
-    Environment env;
+    return string((std::istreambuf_iterator<char>(in_file)), std::istreambuf_iterator<char>());
+}
+
+uint64_t hash_text(const string& text)
+{
+    uint64_t hash = 0xCBF29CE484222325ULL;
+
+    for (unsigned char c : text)
+    {
+        hash ^= c;
+        hash *= 0x100000001B3ULL;
+    }
+
+    return hash;
+}
 
-    // Add custom command callbacks.
-    env.add_callback("doNotModifyHeader", 0, [jsonfilepath, templateFilepath](Arguments& args) {
-        return "//\n// DO NOT MODIFY THIS FILE! It is auto-generated from " + jsonfilepath +" and Inja template " + templateFilepath + "\n//\n";
+void add_callbacks(Environment& env)
+{
+    env.add_callback("doNotModifyHeader", 0, [](Arguments& args) {
+        return "//\n// DO NOT MODIFY THIS FILE! It is auto-generated from " + currentJsonFilepath +" and Inja template " + currentTemplateFilepath + "\n//\n";
     });
 
     env.add_callback("subtract", 2, [](Arguments& args) {
@@ -46,44 +79,42 @@ int main(int argc, char *argv[])
         return minuend - subtrahend;
     });
 
-    env.add_callback("setVar", 2, [=](Arguments& args) {
-        string key = args.at(0)->get<string>();
-        string value = args.at(1)->get<string>();
+    env.add_callback("setVar", 2, [](Arguments& args) {
+        const string& key = args.at(0)->get_ref<const string&>();
+        const string& value = args.at(1)->get_ref<const string&>();
         set_custom_var(key, value);
         return "";
     });
 
-    env.add_callback("setVarInt", 2, [=](Arguments& args) {
-        string key = args.at(0)->get<string>();
-        string value = to_string(args.at(1)->get<int>());
-        set_custom_var(key, value);
+    env.add_callback("setVarInt", 2, [](Arguments& args) {
+        const string& key = args.at(0)->get_ref<const string&>();
+        set_custom_var(key, to_string(args.at(1)->get<int>()));
         return "";
     });
 
-    env.add_callback("getVar", 1, [=](Arguments& args) {
-        string key = args.at(0)->get<string>();
+    env.add_callback("getVar", 1, [](Arguments& args) {
+        const string& key = args.at(0)->get_ref<const string&>();
         return get_custom_var(key);
     });
 
     env.add_callback("concat", 2, [](Arguments& args) {
-        string first = args.at(0)->get<string>();
-        string second = args.at(1)->get<string>();
+        const string& first = args.at(0)->get_ref<const string&>();
+        const string& second = args.at(1)->get_ref<const string&>();
         return first + second;
     });
 
     env.add_callback("removePrefix", 2, [](Arguments& args) {
-        string rawValue = args.at(0)->get<string>();
-        string prefix = args.at(1)->get<string>();
-        string::size_type i = rawValue.find(prefix);
-        if (i != 0)
+        const string& rawValue = args.at(0)->get_ref<const string&>();
+        const string& prefix = args.at(1)->get_ref<const string&>();
+        if (rawValue.compare(0, prefix.length(), prefix) != 0)
             return rawValue;
 
-        return rawValue.erase(0, prefix.length());
+        return rawValue.substr(prefix.length());
     });
 
     env.add_callback("removeSuffix", 2, [](Arguments& args) {
-        string rawValue = args.at(0)->get<string>();
-        string suffix = args.at(1)->get<string>();
+        const string& rawValue = args.at(0)->get_ref<const string&>();
+        const string& suffix = args.at(1)->get_ref<const string&>();
         string::size_type i = rawValue.rfind(suffix);
         if (i == string::npos)
             return rawValue;
@@ -95,14 +126,254 @@ int main(int argc, char *argv[])
     env.add_callback("isEmpty", 1, [](Arguments& args) {
         return args.at(0)->empty();
     });
+}
+
+// Precompiled templates are cached as CBOR. A cache entry holds the parsed
+// bytecode of a template and of every template it includes, along with a
+// hash of each of their sources; the entry is only used if all of the
+// sources still hash the same.
+
+const int kTemplateCacheVersion = 1;
+
+json serialize_template(const Template& tmpl)
+{
+    json bytecodes = json::array();
+
+    for (const Bytecode& bc : tmpl.bytecodes)
+        bytecodes.push_back(json::array({ static_cast<int>(bc.op), bc.args, bc.flags, bc.value, bc.str }));
+
+    return bytecodes;
+}
+
+Template deserialize_template(const json& bytecodes)
+{
+    Template tmpl;
+
+    for (const json& entry : bytecodes)
+    {
+        Bytecode bc;
+        bc.op = static_cast<Bytecode::Op>(entry.at(0).get<int>());
+        bc.args = entry.at(1).get<uint32_t>();
+        bc.flags = entry.at(2).get<uint32_t>();
+        bc.value = entry.at(3);
+        bc.str = entry.at(4).get<string>();
+        tmpl.bytecodes.push_back(std::move(bc));
+    }
+
+    return tmpl;
+}
+
+// Collects the names of the templates included by tmpl, directly or not.
+void find_includes(Environment& env, const Template& tmpl, std::map<string, Template>& includes)
+{
+    for (const Bytecode& bc : tmpl.bytecodes)
+    {
+        if (bc.op != Bytecode::Op::Include)
+            continue;
+
+        string name = bc.value.get<string>();
+
+        if (includes.count(name) != 0)
+            continue;
+
+        includes[name] = env.parse_template(name);
+        find_includes(env, includes[name], includes);
+    }
+}
+
+string get_cache_filepath(const string& cacheDir, const string& templateFilepath)
+{
+    string name = templateFilepath;
+
+    for (char& c : name)
+    {
+        if (c == '/' || c == '\\' || c == ':')
+            c = '_';
+    }
+
+    return cacheDir + "/" + name + ".cache";
+}
+
+bool load_cached_template(Environment& env, const string& cacheFilepath, const string& templateFilepath, Template& tmpl)
+{
+    ifstream in_file(cacheFilepath, std::ifstream::binary);
+
+    if (!in_file.is_open())
+        return false;
+
+    vector<uint8_t> data((std::istreambuf_iterator<char>(in_file)), std::istreambuf_iterator<char>());
 
     try
     {
-        env.write_with_json_file(templateFilepath, jsonfilepath, outputFilepath);
+        json cache = json::from_cbor(data);
+
+        if (cache.at("version").get<int>() != kTemplateCacheVersion)
+            return false;
+
+        for (const auto& source : cache.at("sources").items())
+        {
+            if (hash_text(read_text_file(source.key())) != source.value().get<uint64_t>())
+                return false;
+        }
+
+        if (cache.at("sources").count(templateFilepath) == 0)
+            return false;
+
+        for (const auto& include : cache.at("includes").items())
+            env.include_template(include.key(), deserialize_template(include.value()));
+
+        tmpl = deserialize_template(cache.at("template"));
     }
     catch (const std::exception& e)
     {
-        FATAL_ERROR("JSONPROC_ERROR: %s\n", e.what());
+        return false;
+    }
+
+    return true;
+}
+
+void save_cached_template(const string& cacheFilepath, const string& templateFilepath, const Template& tmpl, const std::map<string, Template>& includes)
+{
+    json cache;
+    cache["version"] = kTemplateCacheVersion;
+    cache["sources"][templateFilepath] = hash_text(read_text_file(templateFilepath));
+    cache["includes"] = json::object();
+
+    for (const auto& include : includes)
+    {
+        cache["sources"][include.first] = hash_text(read_text_file(include.first));
+        cache["includes"][include.first] = serialize_template(include.second);
+    }
+
+    cache["template"] = serialize_template(tmpl);
+
+    vector<uint8_t> data = json::to_cbor(cache);
+
+    if (!WriteFileIfChanged(cacheFilepath, string(data.begin(), data.end())))
+        FATAL_ERROR("JSONPROC_ERROR: Cannot open file %s for writing.\n", cacheFilepath.c_str());
+}
+
+// Parses a template, or loads it from the cache directory if one was given
+// and holds an up-to-date entry for it. Returns true if it was cached.
+bool load_template(Environment& env, const string& templateFilepath, const string& cacheDir, Template& tmpl)
+{
+    string cacheFilepath;
+
+    if (!cacheDir.empty())
+    {
+        cacheFilepath = get_cache_filepath(cacheDir, templateFilepath);
+
+        if (load_cached_template(env, cacheFilepath, templateFilepath, tmpl))
+            return true;
+    }
+
+    tmpl = env.parse_template(templateFilepath);
+
+    if (!cacheDir.empty())
+    {
+        std::map<string, Template> includes;
+        find_includes(env, tmpl, includes);
+        save_cached_template(cacheFilepath, templateFilepath, tmpl, includes);
+    }
+
+    return false;
+}
+
+void usage()
+{
+    FATAL_ERROR("USAGE: jsonproc [--time] [--cache <cache-dir>] <json-filepath> <template-filepath> <output-filepath> [...]\n");
+}
+
+int main(int argc, char *argv[])
+{
+    bool printTimes = false;
+    string cacheDir;
+    int argi = 1;
+
+    for (; argi < argc && argv[argi][0] == '-' && argv[argi][1] == '-'; argi++)
+    {
+        string option = argv[argi];
+
+        if (option == "--time")
+        {
+            printTimes = true;
+        }
+        else if (option == "--cache")
+        {
+            if (++argi >= argc)
+                usage();
+
+            cacheDir = argv[argi];
+        }
+        else
+        {
+            usage();
+        }
+    }
+
+    if (argc - argi < 3 || (argc - argi) % 3 != 0)
+        usage();
+
+    Environment env;
+    add_callbacks(env);
+
+    // Each template is parsed (or loaded from the cache) only once, however
+    // many of the (json, template, output) triples use it.
+    std::map<string, Template> templates;
+
+    for (; argi < argc; argi += 3)
+    {
+        string jsonfilepath = argv[argi];
+        string templateFilepath = argv[argi + 1];
+        string outputFilepath = argv[argi + 2];
+
+        currentJsonFilepath = jsonfilepath;
+        currentTemplateFilepath = templateFilepath;
+        customVars.clear();
+
+        double parseJsonTime, parseTemplateTime, renderTime, writeTime;
+        const char *templateSource = "reused";
+        string output;
+
+        try
+        {
+            auto start = std::chrono::steady_clock::now();
+            const json data = env.load_json(jsonfilepath);
+            parseJsonTime = elapsed_ms(start);
+
+            start = std::chrono::steady_clock::now();
+            auto it = templates.find(templateFilepath);
+
+            if (it == templates.end())
+            {
+                Template tmpl;
+                templateSource = load_template(env, templateFilepath, cacheDir, tmpl) ? "cached" : "parsed";
+                it = templates.emplace(templateFilepath, std::move(tmpl)).first;
+            }
+
+            parseTemplateTime = elapsed_ms(start);
+
+            start = std::chrono::steady_clock::now();
+            output = env.render(it->second, data);
+            renderTime = elapsed_ms(start);
+        }
+        catch (const std::exception& e)
+        {
+            FATAL_ERROR("JSONPROC_ERROR: %s\n", e.what());
+        }
+
+        // Leave the output alone if it hasn't changed, so that make doesn't
+        // rebuild everything that includes it.
+        auto start = std::chrono::steady_clock::now();
+
+        if (!WriteFileIfChanged(outputFilepath, output))
+            FATAL_ERROR("JSONPROC_ERROR: Cannot open file %s for writing.\n", outputFilepath.c_str());
+
+        writeTime = elapsed_ms(start);
+
+        if (printTimes)
+            fprintf(stderr, "jsonproc: %s: json %.2f ms, template %.2f ms (%s), render %.2f ms, write %.2f ms\n",
+                    outputFilepath.c_str(), parseJsonTime, parseTemplateTime, templateSource, renderTime, writeTime);
     }
 
     return 0;
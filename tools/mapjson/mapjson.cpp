@@ -16,7 +16,7 @@ using std::sort; using std::find;
 using std::map;
 
 #include <fstream>
-using std::ofstream; using std::ifstream;
+using std::ifstream;
 
 #include <sstream>
 using std::ostringstream;
@@ -24,10 +24,18 @@ using std::ostringstream;
 #include <limits>
 using std::numeric_limits;
 
+#include <atomic>
+using std::atomic;
+
+#include <thread>
+using std::thread;
+
 #include "json11.h"
 using json11::Json;
 
 #include "mapjson.h"
+#include "write_if_changed.h"
+#include "tool_daemon.h"
 
 
 string read_text_file(string filepath) {
@@ -49,15 +57,57 @@ string read_text_file(string filepath) {
     return text;
 }
 
+// Leaves the file alone if it already has this text, so that make doesn't
+// consider everything that depends on it out of date.
 void write_text_file(string filepath, string text) {
-    ofstream out_file(filepath, std::ofstream::binary);
-
-    if (!out_file.is_open())
+    if (!WriteFileIfChanged(filepath, text))
         FATAL_ERROR("Cannot open file %s for writing.\n", filepath.c_str());
+}
+
+struct CachedJson {
+    FileStamp stamp;
+    Json data;
+};
+
+// Files parsed by the daemon before it forks each request. Only
+// cache_json_file() adds to this, and never once worker threads have
+// started, so reading it needs no lock.
+static map<string, CachedJson> json_cache;
 
-    out_file << text;
+// Parses a file into the cache unless an unchanged copy is already there.
+// Files that are missing or don't parse are left for the request to report.
+void cache_json_file(string filepath) {
+    FileStamp stamp = GetFileStamp(filepath);
+    auto it = json_cache.find(filepath);
 
-    out_file.close();
+    if (it != json_cache.end() && it->second.stamp == stamp)
+        return;
+
+    json_cache.erase(filepath);
+
+    if (stamp.size < 0)
+        return;
+
+    string err;
+    Json data = Json::parse(read_text_file(filepath), err);
+
+    if (data != Json())
+        json_cache[filepath] = CachedJson{stamp, data};
+}
+
+Json read_json_file(string filepath) {
+    auto it = json_cache.find(filepath);
+
+    if (it != json_cache.end() && it->second.stamp == GetFileStamp(filepath))
+        return it->second.data;
+
+    string err;
+    Json data = Json::parse(read_text_file(filepath), err);
+
+    if (data == Json())
+        FATAL_ERROR("%s: %s\n", filepath.c_str(), err.c_str());
+
+    return data;
 }
 
 string generate_map_header_text(Json map_data, Json layouts_data, string version) {
@@ -271,20 +321,7 @@ string get_directory_name(string filename) {
     return filename.substr(0, dir_pos + 1);
 }
 
-void process_map(string map_filepath, string layouts_filepath, string version) {
-    string mapdata_err, layouts_err;
-
-    string mapdata_json_text = read_text_file(map_filepath);
-    string layouts_json_text = read_text_file(layouts_filepath);
-
-    Json map_data = Json::parse(mapdata_json_text, mapdata_err);
-    if (map_data == Json())
-        FATAL_ERROR("%s\n", mapdata_err.c_str());
-
-    Json layouts_data = Json::parse(layouts_json_text, layouts_err);
-    if (layouts_data == Json())
-        FATAL_ERROR("%s\n", layouts_err.c_str());
-
+void write_map_files(string map_filepath, Json map_data, Json layouts_data, string version) {
     string header_text = generate_map_header_text(map_data, layouts_data, version);
     string events_text = generate_map_events_text(map_data);
     string connections_text = generate_map_connections_text(map_data);
@@ -295,6 +332,13 @@ void process_map(string map_filepath, string layouts_filepath, string version) {
     write_text_file(files_dir + "connections.inc", connections_text);
 }
 
+void process_map(string map_filepath, string layouts_filepath, string version) {
+    Json map_data = read_json_file(map_filepath);
+    Json layouts_data = read_json_file(layouts_filepath);
+
+    write_map_files(map_filepath, map_data, layouts_data, version);
+}
+
 string generate_groups_text(Json groups_data) {
     ostringstream text;
 
@@ -381,10 +425,7 @@ string generate_events_text(Json groups_data) {
     return text.str();
 }
 
-string generate_map_constants_text(string groups_filepath, Json groups_data) {
-    string file_dir = get_directory_name(groups_filepath);
-    char dir_separator = file_dir.back();
-
+string generate_map_constants_text(Json groups_data, const map<string, Json> &maps_data) {
     ostringstream text;
 
     text << "#ifndef GUARD_CONSTANTS_MAP_GROUPS_H\n"
@@ -400,9 +441,7 @@ string generate_map_constants_text(string groups_filepath, Json groups_data) {
         size_t max_length = 0;
 
         for (auto &map_name : groups_data[group.string_value()].array_items()) {
-            string header_filepath = file_dir + map_name.string_value() + dir_separator + "map.json";
-            string err_str;
-            Json map_data = Json::parse(read_text_file(header_filepath), err_str);
+            Json map_data = maps_data.at(map_name.string_value());
             map_ids.push_back(map_data["id"]);
             if (map_data["id"].string_value().length() > max_length)
                 max_length = map_data["id"].string_value().length();
@@ -424,18 +463,29 @@ string generate_map_constants_text(string groups_filepath, Json groups_data) {
     return text.str();
 }
 
-void process_groups(string groups_filepath) {
-    string err;
-    Json groups_data = Json::parse(read_text_file(groups_filepath), err);
+vector<string> get_group_map_names(Json groups_data) {
+    vector<string> map_names;
+
+    for (auto &group : groups_data["group_order"].array_items())
+    for (auto &map_name : groups_data[group.string_value()].array_items())
+        map_names.push_back(map_name.string_value());
+
+    return map_names;
+}
 
-    if (groups_data == Json())
-        FATAL_ERROR("%s\n", err.c_str());
+string get_map_filepath(string groups_filepath, string map_name) {
+    string file_dir = get_directory_name(groups_filepath);
+    char dir_separator = file_dir.back();
 
+    return file_dir + map_name + dir_separator + "map.json";
+}
+
+void write_groups_files(string groups_filepath, Json groups_data, const map<string, Json> &maps_data) {
     string groups_text = generate_groups_text(groups_data);
     string connections_text = generate_connections_text(groups_data);
     string headers_text = generate_headers_text(groups_data);
     string events_text = generate_events_text(groups_data);
-    string map_header_text = generate_map_constants_text(groups_filepath, groups_data);
+    string map_header_text = generate_map_constants_text(groups_data, maps_data);
 
     string file_dir = get_directory_name(groups_filepath);
     char s = file_dir.back();
@@ -447,6 +497,16 @@ void process_groups(string groups_filepath) {
     write_text_file(file_dir + ".." + s + ".." + s + "include" + s + "constants" + s + "map_groups.h", map_header_text);
 }
 
+void process_groups(string groups_filepath) {
+    Json groups_data = read_json_file(groups_filepath);
+    map<string, Json> maps_data;
+
+    for (string map_name : get_group_map_names(groups_data))
+        maps_data[map_name] = read_json_file(get_map_filepath(groups_filepath, map_name));
+
+    write_groups_files(groups_filepath, groups_data, maps_data);
+}
+
 string generate_layout_headers_text(Json layouts_data) {
     ostringstream text;
 
@@ -503,13 +563,7 @@ string generate_layouts_constants_text(Json layouts_data) {
     return text.str();
 }
 
-void process_layouts(string layouts_filepath) {
-    string err;
-    Json layouts_data = Json::parse(read_text_file(layouts_filepath), err);
-
-    if (layouts_data == Json())
-        FATAL_ERROR("%s\n", err.c_str());
-
+void write_layouts_files(string layouts_filepath, Json layouts_data) {
     string layout_headers_text = generate_layout_headers_text(layouts_data);
     string layouts_table_text = generate_layouts_table_text(layouts_data);
     string layouts_constants_text = generate_layouts_constants_text(layouts_data);
@@ -522,9 +576,86 @@ void process_layouts(string layouts_filepath) {
     write_text_file(file_dir + ".." + s + ".." + s + "include" + s + "constants" + s + "layouts.h", layouts_constants_text);
 }
 
-int main(int argc, char *argv[]) {
+void process_layouts(string layouts_filepath) {
+    Json layouts_data = read_json_file(layouts_filepath);
+
+    write_layouts_files(layouts_filepath, layouts_data);
+}
+
+// Generates the groups, layouts, and every map's files in one run. The
+// groups and layouts files are parsed only once, and the maps are processed
+// on a pool of worker threads.
+void process_all(string groups_filepath, string layouts_filepath, string version, unsigned int num_threads) {
+    Json groups_data = read_json_file(groups_filepath);
+    Json layouts_data = read_json_file(layouts_filepath);
+
+    vector<string> map_names = get_group_map_names(groups_data);
+    vector<Json> maps_list(map_names.size());
+    atomic<size_t> next_map(0);
+
+    auto worker = [&]() {
+        for (size_t i = next_map++; i < map_names.size(); i = next_map++) {
+            string map_filepath = get_map_filepath(groups_filepath, map_names[i]);
+            maps_list[i] = read_json_file(map_filepath);
+            write_map_files(map_filepath, maps_list[i], layouts_data, version);
+        }
+    };
+
+    if (num_threads > map_names.size())
+        num_threads = map_names.size();
+
+    vector<thread> threads;
+
+    for (unsigned int i = 1; i < num_threads; i++)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (thread &t : threads)
+        t.join();
+
+    map<string, Json> maps_data;
+
+    for (size_t i = 0; i < map_names.size(); i++)
+        maps_data[map_names[i]] = maps_list[i];
+
+    write_layouts_files(layouts_filepath, layouts_data);
+    write_groups_files(groups_filepath, groups_data, maps_data);
+}
+
+// Parses every file the request will read, so that after editing one map
+// only that map is parsed again.
+void prepare_daemon_request(int argc, char *argv[]) {
+    if (argc < 4)
+        return;
+
+    string mode(argv[1]);
+
+    if (mode == "map" || mode == "layouts") {
+        for (int i = 3; i < argc && i < 5; i++)
+            cache_json_file(argv[i]);
+    }
+    else if (mode == "groups" || mode == "all") {
+        string groups_filepath(argv[3]);
+
+        cache_json_file(groups_filepath);
+
+        if (mode == "all" && argc >= 5)
+            cache_json_file(argv[4]);
+
+        auto it = json_cache.find(groups_filepath);
+
+        if (it != json_cache.end()) {
+            for (string map_name : get_group_map_names(it->second.data))
+                cache_json_file(get_map_filepath(groups_filepath, map_name));
+        }
+    }
+}
+
+int run_mapjson(int argc, char *argv[]) {
     if (argc < 3)
-        FATAL_ERROR("USAGE: mapjson <mode> <game-version> [options]\n");
+        FATAL_ERROR("USAGE: mapjson <mode> <game-version> [options]\n"
+                    "       mapjson --daemon <socket_path>\n");
 
     char *version_arg = argv[2];
     string version(version_arg);
@@ -533,8 +664,8 @@ int main(int argc, char *argv[]) {
 
     char *mode_arg = argv[1];
     string mode(mode_arg);
-    if (mode != "layouts" && mode != "map" && mode != "groups")
-        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', or 'groups'.\n");
+    if (mode != "layouts" && mode != "map" && mode != "groups" && mode != "all")
+        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', 'groups', or 'all'.\n");
 
     if (mode == "map") {
         if (argc != 5)
@@ -561,6 +692,34 @@ int main(int argc, char *argv[]) {
 
         process_layouts(filepath);
     }
+    else if (mode == "all") {
+        if (argc != 5 && !(argc == 7 && string(argv[5]) == "-j"))
+            FATAL_ERROR("USAGE: mapjson all <game-version> <groups_file> <layouts_file> [-j <threads>]\n");
+
+        string groups_filepath(argv[3]);
+        string layouts_filepath(argv[4]);
+        int num_threads = thread::hardware_concurrency();
+
+        if (argc == 7)
+            num_threads = std::atoi(argv[6]);
+
+        if (num_threads < 1)
+            num_threads = 1;
+
+        process_all(groups_filepath, layouts_filepath, version, num_threads);
+    }
 
     return 0;
 }
+
+int main(int argc, char *argv[]) {
+    if (argc == 3 && string(argv[1]) == "--daemon")
+        return RunToolDaemon("mapjson", argv[0], argv[2], prepare_daemon_request, run_mapjson);
+
+    int exit_code;
+
+    if (ForwardToDaemon("mapjson", argc, argv, &exit_code))
+        return exit_code;
+
+    return run_mapjson(argc, argv);
+}
@@ -23,126 +23,133 @@
 #include <cstring>
 #include <vector>
 #include "agb.h"
-#include "main.h"
+#include "song.h"
 #include "midi.h"
 #include "tables.h"
 
-int g_agbTrack;
-
-static std::string s_lastOpName;
-static int s_blockNum;
-static bool s_keepLastOpName;
-static int s_lastNote;
-static int s_lastVelocity;
-static bool s_noteChanged;
-static bool s_velocityChanged;
-static bool s_inPattern;
-static int s_extendedCommand;
-static int s_memaccOp;
-static int s_memaccParam1;
-static int s_memaccParam2;
-
-void PrintAgbHeader()
+// Appends to the song's output.
+static void VPrint(Song& song, const char *format, std::va_list args)
 {
-    std::fprintf(g_outputFile, "\t.include \"MPlayDef.s\"\n\n");
-    std::fprintf(g_outputFile, "\t.equ\t%s_grp, voicegroup%03u\n", g_asmLabel.c_str(), g_voiceGroup);
-    std::fprintf(g_outputFile, "\t.equ\t%s_pri, %u\n", g_asmLabel.c_str(), g_priority);
+    std::va_list argsCopy;
+    va_copy(argsCopy, args);
+    int length = std::vsnprintf(nullptr, 0, format, argsCopy);
+    va_end(argsCopy);
+
+    std::size_t pos = song.output.size();
+    song.output.resize(pos + length + 1);
+    std::vsnprintf(&song.output[pos], length + 1, format, args);
+    song.output.resize(pos + length);
+}
+
+static void Print(Song& song, const char *format, ...)
+{
+    std::va_list args;
+    va_start(args, format);
+    VPrint(song, format, args);
+    va_end(args);
+}
+
+void PrintAgbHeader(Song& song)
+{
+    Print(song, "\t.include \"MPlayDef.s\"\n\n");
+    Print(song, "\t.equ\t%s_grp, voicegroup%03u\n", song.options.asmLabel.c_str(), song.options.voiceGroup);
+    Print(song, "\t.equ\t%s_pri, %u\n", song.options.asmLabel.c_str(), song.options.priority);
 
-    if (g_reverb >= 0)
-        std::fprintf(g_outputFile, "\t.equ\t%s_rev, reverb_set+%u\n", g_asmLabel.c_str(), g_reverb);
+    if (song.options.reverb >= 0)
+        Print(song, "\t.equ\t%s_rev, reverb_set+%u\n", song.options.asmLabel.c_str(), song.options.reverb);
     else
-        std::fprintf(g_outputFile, "\t.equ\t%s_rev, 0\n", g_asmLabel.c_str());
+        Print(song, "\t.equ\t%s_rev, 0\n", song.options.asmLabel.c_str());
 
-    std::fprintf(g_outputFile, "\t.equ\t%s_mvl, %u\n", g_asmLabel.c_str(), g_masterVolume);
-    std::fprintf(g_outputFile, "\t.equ\t%s_key, %u\n", g_asmLabel.c_str(), 0);
-    std::fprintf(g_outputFile, "\t.equ\t%s_tbs, %u\n", g_asmLabel.c_str(), g_clocksPerBeat);
-    std::fprintf(g_outputFile, "\t.equ\t%s_exg, %u\n", g_asmLabel.c_str(), g_exactGateTime);
-    std::fprintf(g_outputFile, "\t.equ\t%s_cmp, %u\n", g_asmLabel.c_str(), g_compressionEnabled);
+    Print(song, "\t.equ\t%s_mvl, %u\n", song.options.asmLabel.c_str(), song.options.masterVolume);
+    Print(song, "\t.equ\t%s_key, %u\n", song.options.asmLabel.c_str(), 0);
+    Print(song, "\t.equ\t%s_tbs, %u\n", song.options.asmLabel.c_str(), song.options.clocksPerBeat);
+    Print(song, "\t.equ\t%s_exg, %u\n", song.options.asmLabel.c_str(), song.options.exactGateTime);
+    Print(song, "\t.equ\t%s_cmp, %u\n", song.options.asmLabel.c_str(), song.options.compressionEnabled);
 
-    std::fprintf(g_outputFile, "\n\t.section .rodata\n");
-    std::fprintf(g_outputFile, "\t.global\t%s\n", g_asmLabel.c_str());
+    Print(song, "\n\t.section .rodata\n");
+    Print(song, "\t.global\t%s\n", song.options.asmLabel.c_str());
 
-    std::fprintf(g_outputFile, "\t.align\t2\n");
+    Print(song, "\t.align\t2\n");
 }
 
-void ResetTrackVars()
+void ResetTrackVars(Song& song)
 {
-    s_lastVelocity = -1;
-    s_lastNote = -1;
-    s_velocityChanged = false;
-    s_noteChanged = false;
-    s_keepLastOpName = false;
-    s_lastOpName = "";
-    s_inPattern = false;
+    song.lastVelocity = -1;
+    song.lastNote = -1;
+    song.velocityChanged = false;
+    song.noteChanged = false;
+    song.keepLastOpName = false;
+    song.lastOpName = "";
+    song.inPattern = false;
 }
 
-void PrintWait(int wait)
+void PrintWait(Song& song, int wait)
 {
     if (wait > 0)
     {
-        std::fprintf(g_outputFile, "\t.byte\tW%02d\n", wait);
-        s_velocityChanged = true;
-        s_noteChanged = true;
-        s_keepLastOpName = true;
+        Print(song, "\t.byte\tW%02d\n", wait);
+        song.velocityChanged = true;
+        song.noteChanged = true;
+        song.keepLastOpName = true;
     }
 }
 
-void PrintOp(int wait, std::string name, const char *format, ...)
+void PrintOp(Song& song, int wait, std::string name, const char *format, ...)
 {
     std::va_list args;
     va_start(args, format);
-    std::fprintf(g_outputFile, "\t.byte\t\t");
+    Print(song, "\t.byte\t\t");
 
     if (format != nullptr)
     {
-        if (!g_compressionEnabled || s_lastOpName != name)
+        if (!song.options.compressionEnabled || song.lastOpName != name)
         {
-            std::fprintf(g_outputFile, "%s, ", name.c_str());
-            s_lastOpName = name;
+            Print(song, "%s, ", name.c_str());
+            song.lastOpName = name;
         }
         else
         {
-            std::fprintf(g_outputFile, "        ");
+            Print(song, "        ");
         }
-        std::vfprintf(g_outputFile, format, args);
+        VPrint(song, format, args);
     }
     else
     {
-        std::fputs(name.c_str(), g_outputFile);
-        s_lastOpName = name;
+        song.output += name;
+        song.lastOpName = name;
     }
 
-    std::fprintf(g_outputFile, "\n");
+    Print(song, "\n");
 
     va_end(args);
 
-    PrintWait(wait);
+    PrintWait(song, wait);
 }
 
-void PrintByte(const char *format, ...)
+void PrintByte(Song& song, const char *format, ...)
 {
     std::va_list args;
     va_start(args, format);
-    std::fprintf(g_outputFile, "\t.byte\t");
-    std::vfprintf(g_outputFile, format, args);
-    std::fprintf(g_outputFile, "\n");
-    s_velocityChanged = true;
-    s_noteChanged = true;
-    s_keepLastOpName = true;
+    Print(song, "\t.byte\t");
+    VPrint(song, format, args);
+    Print(song, "\n");
+    song.velocityChanged = true;
+    song.noteChanged = true;
+    song.keepLastOpName = true;
     va_end(args);
 }
 
-void PrintWord(const char *format, ...)
+void PrintWord(Song& song, const char *format, ...)
 {
     std::va_list args;
     va_start(args, format);
-    std::fprintf(g_outputFile, "\t .word\t");
-    std::vfprintf(g_outputFile, format, args);
-    std::fprintf(g_outputFile, "\n");
+    Print(song, "\t .word\t");
+    VPrint(song, format, args);
+    Print(song, "\n");
     va_end(args);
 }
 
-void PrintNote(const Event& event)
+void PrintNote(Song& song, const Event& event)
 {
     int note = event.note;
     int velocity = g_noteVelocityLUT[event.param1];
@@ -153,7 +160,7 @@ void PrintNote(const Event& event)
 
     int gateTimeParam = 0;
 
-    if (g_exactGateTime && duration != -1)
+    if (song.options.exactGateTime && duration != -1)
         gateTimeParam = event.param2 - duration;
 
     char gtpBuf[16];
@@ -173,20 +180,20 @@ void PrintNote(const Event& event)
     bool noteChanged = true;
     bool velocityChanged = true;
 
-    if (g_compressionEnabled)
+    if (song.options.compressionEnabled)
     {
-        noteChanged = (note != s_lastNote);
-        velocityChanged = (velocity != s_lastVelocity);
+        noteChanged = (note != song.lastNote);
+        velocityChanged = (velocity != song.lastVelocity);
     }
 
-    if (s_keepLastOpName)
-        s_keepLastOpName = false;
+    if (song.keepLastOpName)
+        song.keepLastOpName = false;
     else
-        s_lastOpName = "";
+        song.lastOpName = "";
 
     if (noteChanged || velocityChanged || (gateTimeParam > 0))
     {
-        s_lastNote = note;
+        song.lastNote = note;
 
         char noteBuf[16];
 
@@ -199,7 +206,7 @@ void PrintNote(const Event& event)
 
         if (velocityChanged || (gateTimeParam > 0))
         {
-            s_lastVelocity = velocity;
+            song.lastVelocity = velocity;
             std::snprintf(velocityBuf, sizeof(velocityBuf), ", v%03u", velocity);
         }
         else
@@ -207,70 +214,70 @@ void PrintNote(const Event& event)
             velocityBuf[0] = 0;
         }
 
-        PrintOp(event.time, opName, "%s%s%s", noteBuf, velocityBuf, gtpBuf);
+        PrintOp(song, event.time, opName, "%s%s%s", noteBuf, velocityBuf, gtpBuf);
     }
     else
     {
-        PrintOp(event.time, opName, 0);
+        PrintOp(song, event.time, opName, 0);
     }
 
-    s_noteChanged = noteChanged;
-    s_velocityChanged = velocityChanged;
+    song.noteChanged = noteChanged;
+    song.velocityChanged = velocityChanged;
 }
 
-void PrintEndOfTieOp(const Event& event)
+void PrintEndOfTieOp(Song& song, const Event& event)
 {
     int note = event.note;
-    bool noteChanged = (note != s_lastNote);
+    bool noteChanged = (note != song.lastNote);
 
-    if (!noteChanged || !s_noteChanged)
-        s_lastOpName = "";
+    if (!noteChanged || !song.noteChanged)
+        song.lastOpName = "";
 
-    if (!noteChanged && g_compressionEnabled)
+    if (!noteChanged && song.options.compressionEnabled)
     {
-        PrintOp(event.time, "EOT   ", nullptr);
+        PrintOp(song, event.time, "EOT   ", nullptr);
     }
     else
     {
-        s_lastNote = note;
+        song.lastNote = note;
         if (note >= 24)
-            PrintOp(event.time, "EOT   ", g_noteTable[note % 12], note / 12 - 2);
+            PrintOp(song, event.time, "EOT   ", g_noteTable[note % 12], note / 12 - 2);
         else
-            PrintOp(event.time, "EOT   ", g_minusNoteTable[note % 12], note / -12 + 2);
+            PrintOp(song, event.time, "EOT   ", g_minusNoteTable[note % 12], note / -12 + 2);
     }
 
-    s_noteChanged = noteChanged;
+    song.noteChanged = noteChanged;
 }
 
-void PrintSeqLoopLabel(const Event& event)
+void PrintSeqLoopLabel(Song& song, const Event& event)
 {
-    s_blockNum = event.param1 + 1;
-    std::fprintf(g_outputFile, "%s_%u_B%u:\n", g_asmLabel.c_str(), g_agbTrack, s_blockNum);
-    PrintWait(event.time);
-    ResetTrackVars();
+    song.blockNum = event.param1 + 1;
+    Print(song, "%s_%u_B%u:\n", song.options.asmLabel.c_str(), song.agbTrack, song.blockNum);
+    PrintWait(song, event.time);
+    ResetTrackVars(song);
 }
 
-void PrintMemAcc(const Event& event)
+void PrintMemAcc(Song& song, const Event& event)
 {
-    switch (s_memaccOp)
+    switch (song.memaccOp)
     {
     case 0x00:
-        PrintByte("MEMACC, mem_set, 0x%02X, %u", s_memaccParam1, event.param2);
+        PrintByte(song, "MEMACC, mem_set, 0x%02X, %u", song.memaccParam1, event.param2);
         break;
     case 0x01:
-        PrintByte("MEMACC, mem_add, 0x%02X, %u", s_memaccParam1, event.param2);
+        PrintByte(song, "MEMACC, mem_add, 0x%02X, %u", song.memaccParam1, event.param2);
         break;
     case 0x02:
-        PrintByte("MEMACC, mem_sub, 0x%02X, %u", s_memaccParam1, event.param2);
+        PrintByte(song, "MEMACC, mem_sub, 0x%02X, %u", song.memaccParam1, event.param2);
         break;
     case 0x03:
-        PrintByte("MEMACC, mem_mem_set, 0x%02X, 0x%02X", s_memaccParam1, event.param2);
+        PrintByte(song, "MEMACC, mem_mem_set, 0x%02X, 0x%02X", song.memaccParam1, event.param2);
         break;
     case 0x04:
-        PrintByte("MEMACC, mem_mem_add, 0x%02X, 0x%02X", s_memaccParam1, event.param2);
+        PrintByte(song, "MEMACC, mem_mem_add, 0x%02X, 0x%02X", song.memaccParam1, event.param2);
         break;
     case 0x05:
-        PrintByte("MEMACC, mem_mem_sub, 0x%02X, 0x%02X", s_memaccParam1, event.param2);
+        PrintByte(song, "MEMACC, mem_mem_sub, 0x%02X, 0x%02X", song.memaccParam1, event.param2);
         break;
     // TODO: everything else
     case 0x06:
@@ -325,104 +332,104 @@ void PrintMemAcc(const Event& event)
         break;
     }
 
-    PrintWait(event.time);
+    PrintWait(song, event.time);
 }
 
-void PrintExtendedOp(const Event& event)
+void PrintExtendedOp(Song& song, const Event& event)
 {
     // TODO: support for other extended commands
 
-    switch (s_extendedCommand)
+    switch (song.extendedCommand)
     {
     case 0x08:
-        PrintOp(event.time, "XCMD  ", "xIECV , %u", event.param2);
+        PrintOp(song, event.time, "XCMD  ", "xIECV , %u", event.param2);
         break;
     case 0x09:
-        PrintOp(event.time, "XCMD  ", "xIECL , %u", event.param2);
+        PrintOp(song, event.time, "XCMD  ", "xIECL , %u", event.param2);
         break;
     default:
-        PrintWait(event.time);
+        PrintWait(song, event.time);
         break;
     }
 }
 
-void PrintControllerOp(const Event& event)
+void PrintControllerOp(Song& song, const Event& event)
 {
     switch (event.param1)
     {
     case 0x01:
-        PrintOp(event.time, "MOD   ", "%u", event.param2);
+        PrintOp(song, event.time, "MOD   ", "%u", event.param2);
         break;
     case 0x07:
-        PrintOp(event.time, "VOL   ", "%u*%s_mvl/mxv", event.param2, g_asmLabel.c_str());
+        PrintOp(song, event.time, "VOL   ", "%u*%s_mvl/mxv", event.param2, song.options.asmLabel.c_str());
         break;
     case 0x0A:
-        PrintOp(event.time, "PAN   ", "c_v%+d", event.param2 - 64);
+        PrintOp(song, event.time, "PAN   ", "c_v%+d", event.param2 - 64);
         break;
     case 0x0C:
     case 0x10:
-        PrintMemAcc(event);
+        PrintMemAcc(song, event);
         break;
     case 0x0D:
-        s_memaccOp = event.param2;
-        PrintWait(event.time);
+        song.memaccOp = event.param2;
+        PrintWait(song, event.time);
         break;
     case 0x0E:
-        s_memaccParam1 = event.param2;
-        PrintWait(event.time);
+        song.memaccParam1 = event.param2;
+        PrintWait(song, event.time);
         break;
     case 0x0F:
-        s_memaccParam2 = event.param2;
-        PrintWait(event.time);
+        song.memaccParam2 = event.param2;
+        PrintWait(song, event.time);
         break;
     case 0x11:
-        std::fprintf(g_outputFile, "%s_%u_L%u:\n", g_asmLabel.c_str(), g_agbTrack, event.param2);
-        PrintWait(event.time);
-        ResetTrackVars();
+        Print(song, "%s_%u_L%u:\n", song.options.asmLabel.c_str(), song.agbTrack, event.param2);
+        PrintWait(song, event.time);
+        ResetTrackVars(song);
         break;
     case 0x14:
-        PrintOp(event.time, "BENDR ", "%u", event.param2);
+        PrintOp(song, event.time, "BENDR ", "%u", event.param2);
         break;
     case 0x15:
-        PrintOp(event.time, "LFOS  ", "%u", event.param2);
+        PrintOp(song, event.time, "LFOS  ", "%u", event.param2);
         break;
     case 0x16:
-        PrintOp(event.time, "MODT  ", "%u", event.param2);
+        PrintOp(song, event.time, "MODT  ", "%u", event.param2);
         break;
     case 0x18:
-        PrintOp(event.time, "TUNE  ", "c_v%+d", event.param2 - 64);
+        PrintOp(song, event.time, "TUNE  ", "c_v%+d", event.param2 - 64);
         break;
     case 0x1A:
-        PrintOp(event.time, "LFODL ", "%u", event.param2);
+        PrintOp(song, event.time, "LFODL ", "%u", event.param2);
         break;
     case 0x1D:
     case 0x1F:
-        PrintExtendedOp(event);
+        PrintExtendedOp(song, event);
         break;
     case 0x1E:
-        s_extendedCommand = event.param2;
+        song.extendedCommand = event.param2;
         // TODO: loop op
         break;
     case 0x21:
     case 0x27:
-        PrintByte("PRIO  , %u", event.param2);
-        PrintWait(event.time);
+        PrintByte(song, "PRIO  , %u", event.param2);
+        PrintWait(song, event.time);
         break;
     default:
-        PrintWait(event.time);
+        PrintWait(song, event.time);
         break;
     }
 }
 
-void PrintAgbTrack(std::vector<Event>& events)
+void PrintAgbTrack(Song& song, std::vector<Event>& events)
 {
-    std::fprintf(g_outputFile, "\n@**************** Track %u (Midi-Chn.%u) ****************@\n\n", g_agbTrack, g_midiChan + 1);
-    std::fprintf(g_outputFile, "%s_%u:\n", g_asmLabel.c_str(), g_agbTrack);
+    Print(song, "\n@**************** Track %u (Midi-Chn.%u) ****************@\n\n", song.agbTrack, song.midiChan + 1);
+    Print(song, "%s_%u:\n", song.options.asmLabel.c_str(), song.agbTrack);
 
     int wholeNoteCount = 0;
     int loopEndBlockNum = 0;
 
-    ResetTrackVars();
+    ResetTrackVars(song);
 
     bool foundVolBeforeNote = false;
 
@@ -439,10 +446,10 @@ void PrintAgbTrack(std::vector<Event>& events)
     }
 
     if (!foundVolBeforeNote)
-        PrintByte("\tVOL   , 127*%s_mvl/mxv", g_asmLabel.c_str());
+        PrintByte(song, "\tVOL   , 127*%s_mvl/mxv", song.options.asmLabel.c_str());
 
-    PrintWait(g_initialWait);
-    PrintByte("KEYSH , %s_key%+d", g_asmLabel.c_str(), 0);
+    PrintWait(song, song.initialWait);
+    PrintByte(song, "KEYSH , %s_key%+d", song.options.asmLabel.c_str(), 0);
 
     for (unsigned i = 0; events[i].type != EventType::EndOfTrack; i++)
     {
@@ -450,98 +457,98 @@ void PrintAgbTrack(std::vector<Event>& events)
 
         if (IsPatternBoundary(event.type))
         {
-            if (s_inPattern)
-                PrintByte("PEND");
-            s_inPattern = false;
+            if (song.inPattern)
+                PrintByte(song, "PEND");
+            song.inPattern = false;
         }
 
         if (event.type == EventType::WholeNoteMark || event.type == EventType::Pattern)
-            std::fprintf(g_outputFile, "@ %03d   ----------------------------------------\n", wholeNoteCount++);
+            Print(song, "@ %03d   ----------------------------------------\n", wholeNoteCount++);
 
         switch (event.type)
         {
         case EventType::Note:
-            PrintNote(event);
+            PrintNote(song, event);
             break;
         case EventType::EndOfTie:
-            PrintEndOfTieOp(event);
+            PrintEndOfTieOp(song, event);
             break;
         case EventType::Label:
-            PrintSeqLoopLabel(event);
+            PrintSeqLoopLabel(song, event);
             break;
         case EventType::LoopEnd:
-            PrintByte("GOTO");
-            PrintWord("%s_%u_B%u", g_asmLabel.c_str(), g_agbTrack, loopEndBlockNum);
-            PrintSeqLoopLabel(event);
+            PrintByte(song, "GOTO");
+            PrintWord(song, "%s_%u_B%u", song.options.asmLabel.c_str(), song.agbTrack, loopEndBlockNum);
+            PrintSeqLoopLabel(song, event);
             break;
         case EventType::LoopEndBegin:
-            PrintByte("GOTO");
-            PrintWord("%s_%u_B%u", g_asmLabel.c_str(), g_agbTrack, loopEndBlockNum);
-            PrintSeqLoopLabel(event);
-            loopEndBlockNum = s_blockNum;
+            PrintByte(song, "GOTO");
+            PrintWord(song, "%s_%u_B%u", song.options.asmLabel.c_str(), song.agbTrack, loopEndBlockNum);
+            PrintSeqLoopLabel(song, event);
+            loopEndBlockNum = song.blockNum;
             break;
         case EventType::LoopBegin:
-            PrintSeqLoopLabel(event);
-            loopEndBlockNum = s_blockNum;
+            PrintSeqLoopLabel(song, event);
+            loopEndBlockNum = song.blockNum;
             break;
         case EventType::WholeNoteMark:
             if (event.param2 & 0x80000000)
             {
-                std::fprintf(g_outputFile, "%s_%u_%03lu:\n", g_asmLabel.c_str(), g_agbTrack, (unsigned long)(event.param2 & 0x7FFFFFFF));
-                ResetTrackVars();
-                s_inPattern = true;
+                Print(song, "%s_%u_%03lu:\n", song.options.asmLabel.c_str(), song.agbTrack, (unsigned long)(event.param2 & 0x7FFFFFFF));
+                ResetTrackVars(song);
+                song.inPattern = true;
             }
-            PrintWait(event.time);
+            PrintWait(song, event.time);
             break;
         case EventType::Pattern:
-            PrintByte("PATT");
-            PrintWord("%s_%u_%03lu", g_asmLabel.c_str(), g_agbTrack, event.param2);
+            PrintByte(song, "PATT");
+            PrintWord(song, "%s_%u_%03lu", song.options.asmLabel.c_str(), song.agbTrack, event.param2);
 
             while (!IsPatternBoundary(events[i + 1].type))
                 i++;
 
-            ResetTrackVars();
+            ResetTrackVars(song);
             break;
         case EventType::Tempo:
-            PrintByte("TEMPO , %u*%s_tbs/2", 60000000 / event.param2, g_asmLabel.c_str());
-            PrintWait(event.time);
+            PrintByte(song, "TEMPO , %u*%s_tbs/2", 60000000 / event.param2, song.options.asmLabel.c_str());
+            PrintWait(song, event.time);
             break;
         case EventType::InstrumentChange:
-            PrintOp(event.time, "VOICE ", "%u", event.param1);
+            PrintOp(song, event.time, "VOICE ", "%u", event.param1);
             break;
         case EventType::PitchBend:
-            PrintOp(event.time, "BEND  ", "c_v%+d", event.param2 - 64);
+            PrintOp(song, event.time, "BEND  ", "c_v%+d", event.param2 - 64);
             break;
         case EventType::Controller:
-            PrintControllerOp(event);
+            PrintControllerOp(song, event);
             break;
         default:
-            PrintWait(event.time);
+            PrintWait(song, event.time);
             break;
         }
     }
 
-    PrintByte("FINE");
+    PrintByte(song, "FINE");
 }
 
-void PrintAgbFooter()
+void PrintAgbFooter(Song& song)
 {
-    int trackCount = g_agbTrack - 1;
-
-    std::fprintf(g_outputFile, "\n@******************************************************@\n");
-    std::fprintf(g_outputFile, "\t.align\t2\n");
-    std::fprintf(g_outputFile, "\n%s:\n", g_asmLabel.c_str());
-    std::fprintf(g_outputFile, "\t.byte\t%u\t@ NumTrks\n", trackCount);
-    std::fprintf(g_outputFile, "\t.byte\t%u\t@ NumBlks\n", 0);
-    std::fprintf(g_outputFile, "\t.byte\t%s_pri\t@ Priority\n", g_asmLabel.c_str());
-    std::fprintf(g_outputFile, "\t.byte\t%s_rev\t@ Reverb.\n", g_asmLabel.c_str());
-    std::fprintf(g_outputFile, "\n");
-    std::fprintf(g_outputFile, "\t.word\t%s_grp\n", g_asmLabel.c_str());
-    std::fprintf(g_outputFile, "\n");
+    int trackCount = song.agbTrack - 1;
+
+    Print(song, "\n@******************************************************@\n");
+    Print(song, "\t.align\t2\n");
+    Print(song, "\n%s:\n", song.options.asmLabel.c_str());
+    Print(song, "\t.byte\t%u\t@ NumTrks\n", trackCount);
+    Print(song, "\t.byte\t%u\t@ NumBlks\n", 0);
+    Print(song, "\t.byte\t%s_pri\t@ Priority\n", song.options.asmLabel.c_str());
+    Print(song, "\t.byte\t%s_rev\t@ Reverb.\n", song.options.asmLabel.c_str());
+    Print(song, "\n");
+    Print(song, "\t.word\t%s_grp\n", song.options.asmLabel.c_str());
+    Print(song, "\n");
 
     // track pointers
     for (int i = 1; i <= trackCount; i++)
-        std::fprintf(g_outputFile, "\t.word\t%s_%u\n", g_asmLabel.c_str(), i);
+        Print(song, "\t.word\t%s_%u\n", song.options.asmLabel.c_str(), i);
 
-    std::fprintf(g_outputFile, "\n\t.end\n");
+    Print(song, "\n\t.end\n");
 }
@@ -24,10 +24,10 @@
 #include <vector>
 #include "midi.h"
 
-void PrintAgbHeader();
-void PrintAgbTrack(std::vector<Event>& events);
-void PrintAgbFooter();
+struct Song;
 
-extern int g_agbTrack;
+void PrintAgbHeader(Song& song);
+void PrintAgbTrack(Song& song, std::vector<Event>& events);
+void PrintAgbFooter(Song& song);
 
 #endif // AGB_H
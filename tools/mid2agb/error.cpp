@@ -21,6 +21,16 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstdarg>
+#include <string>
+#include "error.h"
+
+// The file being converted by this thread, if errors should name it.
+static thread_local std::string t_errorFilename;
+
+void SetErrorFilename(const std::string& filename)
+{
+    t_errorFilename = filename;
+}
 
 // Reports an error diagnostic and terminates the program.
 [[noreturn]] void RaiseError(const char* format, ...)
@@ -30,7 +40,10 @@
     std::va_list args;
     va_start(args, format);
     std::vsnprintf(buffer, bufferSize, format, args);
-    std::fprintf(stderr, "error: %s\n", buffer);
+    if (t_errorFilename.empty())
+        std::fprintf(stderr, "error: %s\n", buffer);
+    else
+        std::fprintf(stderr, "error: %s: %s\n", t_errorFilename.c_str(), buffer);
     va_end(args);
     std::exit(1);
 }
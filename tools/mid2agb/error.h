@@ -21,6 +21,12 @@
 #ifndef ERROR_H
 #define ERROR_H
 
+#include <string>
+
 [[noreturn]] void RaiseError(const char* format, ...);
 
+// Makes the errors raised on this thread name the given file. Used in batch
+// mode, where several songs are converted at once.
+void SetErrorFilename(const std::string& filename);
+
 #endif // ERROR_H
@@ -23,24 +23,27 @@
 #include <cstring>
 #include <cctype>
 #include <cassert>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <sstream>
 #include <string>
-#include <set>
-#include "main.h"
+#include <thread>
+#include <vector>
+#include "song.h"
 #include "error.h"
 #include "midi.h"
 #include "agb.h"
+#include "mapped_file.h"
 
-FILE* g_inputFile = nullptr;
-FILE* g_outputFile = nullptr;
-
-std::string g_asmLabel;
-int g_masterVolume = 127;
-int g_voiceGroup = 0;
-int g_priority = 0;
-int g_reverb = -1;
-int g_clocksPerBeat = 1;
-bool g_exactGateTime = false;
-bool g_compressionEnabled = true;
+struct Conversion
+{
+    std::string inputFilename;
+    std::string outputFilename;
+    SongOptions options;
+    double milliseconds = 0;
+};
 
 [[noreturn]] static void PrintUsage()
 {
@@ -58,6 +61,11 @@ bool g_compressionEnabled = true;
         "            -X  48 clocks/beat (default:24 clocks/beat)\n"
         "            -E  exact gate-time\n"
         "            -N  no compression\n"
+        "\n"
+        "Usage: MID2AGB --batch [-j threads] manifest_file\n"
+        "\n"
+        "  Converts every song in manifest_file, which has one line of\n"
+        "  arguments per song, and reports each song's conversion time.\n"
     );
     std::exit(1);
 }
@@ -127,10 +135,12 @@ static const char *GetArgument(int argc, char **argv, int& index)
     }
 }
 
-int main(int argc, char** argv)
+// Parses the arguments for one song. argv[0] is ignored, as for main.
+static void ParseArguments(int argc, char **argv, Conversion& conversion)
 {
-    std::string inputFilename;
-    std::string outputFilename;
+    SongOptions& options = conversion.options;
+    std::string& inputFilename = conversion.inputFilename;
+    std::string& outputFilename = conversion.outputFilename;
 
     for (int i = 1; i < argc; i++)
     {
@@ -143,43 +153,43 @@ int main(int argc, char** argv)
             switch (std::toupper(option[1]))
             {
             case 'E':
-                g_exactGateTime = true;
+                options.exactGateTime = true;
                 break;
             case 'G':
                 arg = GetArgument(argc, argv, i);
                 if (arg == nullptr)
                     PrintUsage();
-                g_voiceGroup = std::stoi(arg);
+                options.voiceGroup = std::stoi(arg);
                 break;
             case 'L':
                 arg = GetArgument(argc, argv, i);
                 if (arg == nullptr)
                     PrintUsage();
-                g_asmLabel = arg;
+                options.asmLabel = arg;
                 break;
             case 'N':
-                g_compressionEnabled = false;
+                options.compressionEnabled = false;
                 break;
             case 'P':
                 arg = GetArgument(argc, argv, i);
                 if (arg == nullptr)
                     PrintUsage();
-                g_priority = std::stoi(arg);
+                options.priority = std::stoi(arg);
                 break;
             case 'R':
                 arg = GetArgument(argc, argv, i);
                 if (arg == nullptr)
                     PrintUsage();
-                g_reverb = std::stoi(arg);
+                options.reverb = std::stoi(arg);
                 break;
             case 'V':
                 arg = GetArgument(argc, argv, i);
                 if (arg == nullptr)
                     PrintUsage();
-                g_masterVolume = std::stoi(arg);
+                options.masterVolume = std::stoi(arg);
                 break;
             case 'X':
-                g_clocksPerBeat = 2;
+                options.clocksPerBeat = 2;
                 break;
             default:
                 PrintUsage();
@@ -208,26 +218,158 @@ int main(int argc, char** argv)
     if (GetExtension(outputFilename) != "s")
         RaiseError("output filename extension is not \"s\"");
 
-    if (g_asmLabel.empty())
-        g_asmLabel = BaseName(outputFilename);
+    if (options.asmLabel.empty())
+        options.asmLabel = BaseName(outputFilename);
+}
+
+static void ConvertSong(Conversion& conversion)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    std::shared_ptr<const MappedFile> inputFile = MappedFile::Open(conversion.inputFilename);
+
+    if (inputFile == nullptr)
+        RaiseError("failed to open \"%s\" for reading", conversion.inputFilename.c_str());
+
+    Song song;
+    song.options = conversion.options;
+    song.input = inputFile->Data();
+    song.inputSize = inputFile->Size();
+
+    ReadMidiFileHeader(song);
+    PrintAgbHeader(song);
+    ReadMidiTracks(song);
+    PrintAgbFooter(song);
+
+    FILE *outputFile = std::fopen(conversion.outputFilename.c_str(), "w");
+
+    if (outputFile == nullptr)
+        RaiseError("failed to open \"%s\" for writing", conversion.outputFilename.c_str());
+
+    std::fwrite(song.output.data(), 1, song.output.size(), outputFile);
+    std::fclose(outputFile);
+
+    conversion.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Reads a batch manifest: one line of arguments per song, in the same form
+// as on the command line. Blank lines and lines starting with '#' are
+// ignored.
+static std::vector<Conversion> ReadManifest(const char *filename)
+{
+    std::ifstream manifest(filename);
+
+    if (!manifest.is_open())
+        RaiseError("failed to open \"%s\" for reading", filename);
+
+    std::vector<Conversion> conversions;
+    std::string line;
+
+    while (std::getline(manifest, line))
+    {
+        std::istringstream stream(line);
+        std::vector<std::string> args = { "mid2agb" };
+        std::string arg;
+
+        while (stream >> arg)
+            args.push_back(arg);
+
+        if (args.size() == 1 || args[1][0] == '#')
+            continue;
+
+        std::vector<char *> argv;
+
+        for (std::string& a : args)
+            argv.push_back(&a[0]);
+
+        conversions.emplace_back();
+        ParseArguments(argv.size(), argv.data(), conversions.back());
+    }
+
+    return conversions;
+}
+
+static void RunBatch(int argc, char **argv)
+{
+    unsigned numThreads = std::thread::hardware_concurrency();
+    const char *manifestFilename = nullptr;
+
+    for (int i = 2; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-j") == 0)
+        {
+            if (i + 1 >= argc)
+                PrintUsage();
+            numThreads = std::atoi(argv[++i]);
+        }
+        else if (manifestFilename == nullptr)
+        {
+            manifestFilename = argv[i];
+        }
+        else
+        {
+            PrintUsage();
+        }
+    }
+
+    if (manifestFilename == nullptr)
+        PrintUsage();
+
+    std::vector<Conversion> conversions = ReadManifest(manifestFilename);
 
-    g_inputFile = std::fopen(inputFilename.c_str(), "rb");
+    if (numThreads > conversions.size())
+        numThreads = conversions.size();
 
-    if (g_inputFile == nullptr)
-        RaiseError("failed to open \"%s\" for reading", inputFilename.c_str());
+    if (numThreads < 1)
+        numThreads = 1;
 
-    g_outputFile = std::fopen(outputFilename.c_str(), "w");
+    auto start = std::chrono::steady_clock::now();
+    std::atomic<std::size_t> next(0);
 
-    if (g_outputFile == nullptr)
-        RaiseError("failed to open \"%s\" for writing", outputFilename.c_str());
+    auto worker = [&]() {
+        std::size_t i;
 
-    ReadMidiFileHeader();
-    PrintAgbHeader();
-    ReadMidiTracks();
-    PrintAgbFooter();
+        while ((i = next++) < conversions.size())
+        {
+            SetErrorFilename(conversions[i].inputFilename);
+            ConvertSong(conversions[i]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+
+    for (unsigned i = 1; i < numThreads; i++)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    double totalMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    double songMilliseconds = 0;
+
+    for (const Conversion& conversion : conversions)
+    {
+        std::printf("%s: %.2f ms\n", conversion.outputFilename.c_str(), conversion.milliseconds);
+        songMilliseconds += conversion.milliseconds;
+    }
+
+    std::printf("%zu songs in %.2f ms (%.2f ms of conversion on %u threads)\n",
+                conversions.size(), totalMilliseconds, songMilliseconds, numThreads);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc >= 2 && std::strcmp(argv[1], "--batch") == 0)
+    {
+        RunBatch(argc, argv);
+        return 0;
+    }
 
-    std::fclose(g_inputFile);
-    std::fclose(g_outputFile);
+    Conversion conversion;
+    ParseArguments(argc, argv, conversion);
+    ConvertSong(conversion);
 
     return 0;
 }
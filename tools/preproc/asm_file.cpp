@@ -27,7 +27,7 @@
 #include "utf8.h"
 #include "string_parser.h"
 
-AsmFile::AsmFile(std::string filename) : m_filename(filename)
+AsmFile::AsmFile(std::string filename, FILE *output) : m_filename(filename), m_output(output)
 {
     FILE *fp = std::fopen(filename.c_str(), "rb");
 
@@ -59,7 +59,7 @@ AsmFile::AsmFile(std::string filename) : m_filename(filename)
     RemoveComments();
 }
 
-AsmFile::AsmFile(AsmFile&& other) : m_filename(std::move(other.m_filename))
+AsmFile::AsmFile(AsmFile&& other) : m_filename(std::move(other.m_filename)), m_output(other.m_output)
 {
     m_buffer = other.m_buffer;
     m_pos = other.m_pos;
@@ -440,7 +440,8 @@ void AsmFile::OutputLine()
         if (m_pos >= m_size)
         {
             RaiseWarning("file doesn't end with newline");
-            puts(&m_buffer[m_lineStart]);
+            std::fputs(&m_buffer[m_lineStart], m_output);
+            std::fputc('\n', m_output);
         }
         else
         {
@@ -450,7 +451,8 @@ void AsmFile::OutputLine()
     else
     {
         m_buffer[m_pos] = 0;
-        puts(&m_buffer[m_lineStart]);
+        std::fputs(&m_buffer[m_lineStart], m_output);
+        std::fputc('\n', m_output);
         m_buffer[m_pos] = '\n';
         m_pos++;
         m_lineStart = m_pos;
@@ -497,7 +499,7 @@ bool AsmFile::IsAtEnd()
 // Output the current location to set gas's logical file and line numbers.
 void AsmFile::OutputLocation()
 {
-    std::printf("# %ld \"%s\"\n", m_lineNum, m_filename.c_str());
+    std::fprintf(m_output, "# %ld \"%s\"\n", m_lineNum, m_filename.c_str());
 }
 
 // Reports a diagnostic message.
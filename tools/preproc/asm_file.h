@@ -22,6 +22,7 @@
 #define ASM_FILE_H
 
 #include <cstdarg>
+#include <cstdio>
 #include <cstdint>
 #include <string>
 #include "preproc.h"
@@ -37,7 +38,7 @@ enum class Directive
 class AsmFile
 {
 public:
-    AsmFile(std::string filename);
+    AsmFile(std::string filename, FILE *output);
     AsmFile(AsmFile&& other);
     AsmFile(const AsmFile&) = delete;
     ~AsmFile();
@@ -57,6 +58,7 @@ private:
     long m_lineNum;
     long m_lineStart;
     std::string m_filename;
+    FILE *m_output;
 
     bool ConsumeComma();
     int ReadPadLength();
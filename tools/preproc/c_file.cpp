@@ -25,13 +25,40 @@
 #include <memory>
 #include <cstring>
 #include <cerrno>
+#include <map>
+#include <mutex>
 #include "preproc.h"
 #include "c_file.h"
+#include "mapped_file.h"
 #include "char_util.h"
 #include "utf8.h"
 #include "string_parser.h"
 
-CFile::CFile(const char * filenameCStr, bool isStdin)
+// Returns the contents of an incbin'd file. Files stay open for the rest
+// of the run, so a file that is incbin'd several times (by one source
+// file or, in batch mode, by several) is only opened and mapped once.
+// Thread-safe.
+static std::shared_ptr<const MappedFile> GetIncbinFile(const std::string& path)
+{
+    static std::mutex s_mutex;
+    static std::map<std::string, std::shared_ptr<const MappedFile>> s_files;
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    auto it = s_files.find(path);
+
+    if (it != s_files.end())
+        return it->second;
+
+    std::shared_ptr<const MappedFile> file = MappedFile::Open(path);
+
+    if (file != nullptr)
+        s_files[path] = file;
+
+    return file;
+}
+
+CFile::CFile(const char * filenameCStr, bool isStdin, FILE *output) : m_output(output)
 {
     FILE *fp;
 
@@ -86,7 +113,7 @@ CFile::CFile(const char * filenameCStr, bool isStdin)
     m_isStdin = isStdin;
 }
 
-CFile::CFile(CFile&& other) : m_filename(std::move(other.m_filename))
+CFile::CFile(CFile&& other) : m_filename(std::move(other.m_filename)), m_output(other.m_output)
 {
     m_buffer = other.m_buffer;
     m_pos = other.m_pos;
@@ -112,21 +139,21 @@ void CFile::Preproc()
         {
             if (m_buffer[m_pos] == stringChar)
             {
-                std::putchar(stringChar);
+                std::fputc(stringChar, m_output);
                 m_pos++;
                 stringChar = 0;
             }
             else if (m_buffer[m_pos] == '\\' && m_buffer[m_pos + 1] == stringChar)
             {
-                std::putchar('\\');
-                std::putchar(stringChar);
+                std::fputc('\\', m_output);
+                std::fputc(stringChar, m_output);
                 m_pos += 2;
             }
             else
             {
                 if (m_buffer[m_pos] == '\n')
                     m_lineNum++;
-                std::putchar(m_buffer[m_pos]);
+                std::fputc(m_buffer[m_pos], m_output);
                 m_pos++;
             }
         }
@@ -140,7 +167,7 @@ void CFile::Preproc()
 
             char c = m_buffer[m_pos++];
 
-            std::putchar(c);
+            std::fputc(c, m_output);
 
             if (c == '\n')
                 m_lineNum++;
@@ -169,7 +196,7 @@ bool CFile::ConsumeNewline()
     {
         m_pos += 2;
         m_lineNum++;
-        std::putchar('\n');
+        std::fputc('\n', m_output);
         return true;
     }
 
@@ -177,7 +204,7 @@ bool CFile::ConsumeNewline()
     {
         m_pos++;
         m_lineNum++;
-        std::putchar('\n');
+        std::fputc('\n', m_output);
         return true;
     }
 
@@ -220,7 +247,7 @@ void CFile::TryConvertString()
 
     SkipWhitespace();
 
-    std::printf("{ ");
+    std::fprintf(m_output, "{ ");
 
     while (1)
     {
@@ -242,7 +269,7 @@ void CFile::TryConvertString()
             }
 
             for (int i = 0; i < length; i++)
-                printf("0x%02X, ", s[i]);
+                std::fprintf(m_output, "0x%02X, ", s[i]);
         }
         else if (m_buffer[m_pos] == ')')
         {
@@ -261,9 +288,9 @@ void CFile::TryConvertString()
     }
 
     if (noTerminator)
-        std::printf(" }");
+        std::fprintf(m_output, " }");
     else
-        std::printf("0xFF }");
+        std::fprintf(m_output, "0xFF }");
 }
 
 bool CFile::CheckIdentifier(const std::string& ident)
@@ -277,48 +304,55 @@ bool CFile::CheckIdentifier(const std::string& ident)
     return (i == ident.length());
 }
 
-std::unique_ptr<unsigned char[]> CFile::ReadWholeFile(const std::string& path, int& size)
-{
-    FILE* fp = std::fopen(path.c_str(), "rb");
-
-    if (fp == nullptr)
-        RaiseError("Failed to open \"%s\" for reading.\n", path.c_str());
-
-    std::fseek(fp, 0, SEEK_END);
-
-    size = std::ftell(fp);
-
-    std::unique_ptr<unsigned char[]> buffer = std::unique_ptr<unsigned char[]>(new unsigned char[size]);
-
-    std::rewind(fp);
-
-    if (std::fread(buffer.get(), size, 1, fp) != 1)
-        RaiseError("Failed to read \"%s\".\n", path.c_str());
-
-    std::fclose(fp);
-
-    return buffer;
-}
-
-int ExtractData(const std::unique_ptr<unsigned char[]>& buffer, int offset, int size)
+std::uint32_t ExtractData(const unsigned char* buffer, int size)
 {
     switch (size)
     {
     case 1:
-        return buffer[offset];
+        return buffer[0];
     case 2:
-        return (buffer[offset + 1] << 8)
-            | buffer[offset];
+        return (buffer[1] << 8)
+            | buffer[0];
     case 4:
-        return (buffer[offset + 3] << 24)
-            | (buffer[offset + 2] << 16)
-            | (buffer[offset + 1] << 8)
-            | buffer[offset];
+        return ((std::uint32_t)buffer[3] << 24)
+            | (buffer[2] << 16)
+            | (buffer[1] << 8)
+            | buffer[0];
     default:
         FATAL_ERROR("Invalid size passed to ExtractData.\n");
     }
 }
 
+// Writes an incbin value followed by a comma, in the same format that
+// printf's "%d," or "%uu," would give, and returns the end of the output.
+char* FormatIncbinValue(char* out, std::uint32_t value, bool isSigned)
+{
+    char digits[10];
+    int numDigits = 0;
+
+    if (isSigned && (std::int32_t)value < 0)
+    {
+        *out++ = '-';
+        value = 0u - value;
+    }
+
+    do
+    {
+        digits[numDigits++] = '0' + (value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    while (numDigits > 0)
+        *out++ = digits[--numDigits];
+
+    if (!isSigned)
+        *out++ = 'u';
+
+    *out++ = ',';
+
+    return out;
+}
+
 void CFile::TryConvertIncbin()
 {
     std::string idents[6] = { "INCBIN_S8", "INCBIN_U8", "INCBIN_S16", "INCBIN_U16", "INCBIN_S32", "INCBIN_U32" };
@@ -355,7 +389,7 @@ void CFile::TryConvertIncbin()
 
     m_pos++;
 
-    std::printf("{");
+    std::fprintf(m_output, "{");
 
     while (true)
     {
@@ -391,26 +425,37 @@ void CFile::TryConvertIncbin()
 
         m_pos++;
 
-        int fileSize;
-        std::unique_ptr<unsigned char[]> buffer = ReadWholeFile(path, fileSize);
+        std::shared_ptr<const MappedFile> file = GetIncbinFile(path);
+
+        if (file == nullptr)
+            RaiseError("Failed to open \"%s\" for reading.\n", path.c_str());
+
+        int fileSize = file->Size();
 
         if ((fileSize % size) != 0)
             RaiseError("Size %d doesn't evenly divide file size %d.\n", size, fileSize);
 
-        int count = fileSize / size;
-        int offset = 0;
+        // The values are formatted into a buffer rather than printed one at
+        // a time, since this is where most of the time goes for sources
+        // with many incbins like src/graphics.c.
+        const unsigned char* data = file->Data();
+        const unsigned char* end = data + fileSize;
+        char buffer[CHUNK_SIZE];
+        char* out = buffer;
 
-        for (int i = 0; i < count; i++)
+        for (; data != end; data += size)
         {
-            int data = ExtractData(buffer, offset, size);
-            offset += size;
+            if (out - buffer > CHUNK_SIZE - 16)
+            {
+                std::fwrite(buffer, 1, out - buffer, m_output);
+                out = buffer;
+            }
 
-            if (isSigned)
-                std::printf("%d,", data);
-            else
-                std::printf("%uu,", data);
+            out = FormatIncbinValue(out, ExtractData(data, size), isSigned);
         }
 
+        std::fwrite(buffer, 1, out - buffer, m_output);
+
         SkipWhitespace();
 
         if (m_buffer[m_pos] != ',')
@@ -424,7 +469,7 @@ void CFile::TryConvertIncbin()
 
     m_pos++;
 
-    std::printf("}");
+    std::fprintf(m_output, "}");
 }
 
 // Reports a diagnostic message.
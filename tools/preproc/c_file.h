@@ -22,6 +22,7 @@
 #define C_FILE_H
 
 #include <cstdarg>
+#include <cstdio>
 #include <cstdint>
 #include <string>
 #include <memory>
@@ -30,7 +31,7 @@
 class CFile
 {
 public:
-    CFile(const char * filenameCStr, bool isStdin);
+    CFile(const char * filenameCStr, bool isStdin, FILE *output);
     CFile(CFile&& other);
     CFile(const CFile&) = delete;
     ~CFile();
@@ -43,12 +44,12 @@ private:
     long m_lineNum;
     std::string m_filename;
     bool m_isStdin;
+    FILE *m_output;
 
     bool ConsumeHorizontalWhitespace();
     bool ConsumeNewline();
     void SkipWhitespace();
     void TryConvertString();
-    std::unique_ptr<unsigned char[]> ReadWholeFile(const std::string& path, int& size);
     bool CheckIdentifier(const std::string& ident);
     void TryConvertIncbin();
     void ReportDiagnostic(const char* type, const char* format, std::va_list args);
@@ -21,6 +21,7 @@
 #include <cstdio>
 #include <cstdint>
 #include <cstdarg>
+#include <cstring>
 #include "preproc.h"
 #include "charmap.h"
 #include "char_util.h"
@@ -369,40 +370,351 @@ void CharmapReader::SkipWhitespace()
         m_pos++;
 }
 
+static const char kCompiledMagic[8] = { 'C', 'H', 'A', 'R', 'M', 'A', 'P', 1 };
+
 Charmap::Charmap(std::string filename)
 {
+    if (Load(filename))
+        return;
+
     CharmapReader reader(filename);
+    std::map<std::string, std::uint32_t> constants;
+
+    m_sequences.push_back(std::string());
+    m_denseChars.assign(kDenseCharLimit, 0);
 
+    for (int i = 0; i < 128; i++)
+        m_escapes[i] = 0;
+
+    // Sequences are never empty, so index 0 means "not defined yet".
     for (;;)
     {
         Lhs lhs = reader.ReadLhs();
 
         if (lhs.type == LhsType::None)
-            return;
+            break;
 
         reader.ExpectEqualsSign();
 
-        std::string sequence = reader.ReadSequence();
+        std::uint32_t index = AddSequence(reader.ReadSequence());
 
         switch (lhs.type)
         {
         case LhsType::Char:
-            if (m_chars.find(lhs.code) != m_chars.end())
-                reader.RaiseError("redefining char");
-            m_chars[lhs.code] = sequence;
+            if (lhs.code >= 0 && lhs.code < kDenseCharLimit)
+            {
+                if (m_denseChars[lhs.code] != 0)
+                    reader.RaiseError("redefining char");
+                m_denseChars[lhs.code] = index;
+            }
+            else
+            {
+                if (m_sparseChars.find(lhs.code) != m_sparseChars.end())
+                    reader.RaiseError("redefining char");
+                m_sparseChars[lhs.code] = index;
+            }
             break;
         case LhsType::Escape:
-            if (m_escapes[lhs.code].length() != 0)
+            if (m_escapes[lhs.code] != 0)
                 reader.RaiseError("redefining escape");
-            m_escapes[lhs.code] = sequence;
+            m_escapes[lhs.code] = index;
             break;
         case LhsType::Constant:
-            if (m_constants.find(lhs.name) != m_constants.end())
+            if (constants.find(lhs.name) != constants.end())
                 reader.RaiseError("redefining constant");
-            m_constants[lhs.name] = sequence;
+            constants[lhs.name] = index;
             break;
         }
 
         reader.ExpectEmptyRestOfLine();
     }
+
+    BuildTrie(constants);
+}
+
+std::uint32_t Charmap::AddSequence(std::string sequence)
+{
+    std::uint32_t index = m_sequences.size();
+
+    if (index > UINT16_MAX)
+        FATAL_ERROR("too many byte sequences in charmap\n");
+
+    m_sequences.push_back(std::move(sequence));
+    return index;
+}
+
+// Builds the trie breadth first so that each node's edges are contiguous
+// and sorted by character. The constants are visited in sorted order, so a
+// node's children are created in sorted order and only the last one can
+// share a prefix with the next constant.
+void Charmap::BuildTrie(const std::map<std::string, std::uint32_t>& constants)
+{
+    struct BuildNode
+    {
+        std::uint32_t sequence = 0;
+        std::vector<std::pair<unsigned char, std::size_t>> children;
+    };
+
+    std::vector<BuildNode> nodes(1);
+
+    for (const auto& entry : constants)
+    {
+        std::size_t node = 0;
+
+        for (unsigned char c : entry.first)
+        {
+            if (nodes[node].children.empty() || nodes[node].children.back().first != c)
+            {
+                nodes.push_back(BuildNode());
+                nodes[node].children.push_back(std::make_pair(c, nodes.size() - 1));
+            }
+
+            node = nodes[node].children.back().second;
+        }
+
+        nodes[node].sequence = entry.second;
+    }
+
+    std::vector<std::size_t> order(1, 0);
+    std::vector<std::uint32_t> finalIndex(nodes.size());
+
+    m_trieNodes.clear();
+    m_trieEdges.clear();
+
+    for (std::size_t i = 0; i < order.size(); i++)
+    {
+        finalIndex[order[i]] = i;
+
+        for (const auto& child : nodes[order[i]].children)
+            order.push_back(child.second);
+    }
+
+    for (std::size_t i = 0; i < order.size(); i++)
+    {
+        const BuildNode& node = nodes[order[i]];
+        TrieNode trieNode;
+
+        trieNode.sequence = node.sequence;
+        trieNode.firstEdge = m_trieEdges.size();
+        trieNode.numEdges = node.children.size();
+        m_trieNodes.push_back(trieNode);
+
+        for (const auto& child : node.children)
+            m_trieEdges.push_back(TrieEdge{ child.first, finalIndex[child.second] });
+    }
+}
+
+const std::string& Charmap::Constant(const char *name, std::size_t length) const
+{
+    std::uint32_t node = 0;
+
+    for (std::size_t i = 0; i < length; i++)
+    {
+        const TrieNode& trieNode = m_trieNodes[node];
+        const TrieEdge *edge = &m_trieEdges[trieNode.firstEdge];
+        const TrieEdge *end = edge + trieNode.numEdges;
+        unsigned char c = name[i];
+
+        while (edge != end && edge->c < c)
+            edge++;
+
+        if (edge == end || edge->c != c)
+            return m_sequences[0];
+
+        node = edge->node;
+    }
+
+    return m_sequences[m_trieNodes[node].sequence];
+}
+
+// The compiled format is a magic header followed by little-endian 32-bit
+// fields: the sequence table (length-prefixed byte strings), the non-empty
+// char mappings as (code, index) pairs, the 128 escape indices, and the trie
+// nodes and edges.
+
+static void WriteU32(std::string& out, std::uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+        out += (char)(value >> (8 * i));
+}
+
+static bool ReadU32(const std::string& in, std::size_t& pos, std::uint32_t& value)
+{
+    if (pos + 4 > in.size())
+        return false;
+
+    value = 0;
+
+    for (int i = 0; i < 4; i++)
+        value |= (std::uint32_t)(unsigned char)in[pos + i] << (8 * i);
+
+    pos += 4;
+    return true;
+}
+
+void Charmap::Save(std::string filename) const
+{
+    std::string out(kCompiledMagic, sizeof(kCompiledMagic));
+
+    WriteU32(out, m_sequences.size());
+
+    for (const std::string& sequence : m_sequences)
+    {
+        WriteU32(out, sequence.size());
+        out += sequence;
+    }
+
+    std::vector<std::pair<std::int32_t, std::uint32_t>> chars;
+
+    for (std::int32_t code = 0; code < kDenseCharLimit; code++)
+    {
+        if (m_denseChars[code] != 0)
+            chars.push_back(std::make_pair(code, m_denseChars[code]));
+    }
+
+    for (const auto& entry : m_sparseChars)
+        chars.push_back(entry);
+
+    WriteU32(out, chars.size());
+
+    for (const auto& entry : chars)
+    {
+        WriteU32(out, entry.first);
+        WriteU32(out, entry.second);
+    }
+
+    for (int i = 0; i < 128; i++)
+        WriteU32(out, m_escapes[i]);
+
+    WriteU32(out, m_trieNodes.size());
+
+    for (const TrieNode& node : m_trieNodes)
+    {
+        WriteU32(out, node.sequence);
+        WriteU32(out, node.firstEdge);
+        WriteU32(out, node.numEdges);
+    }
+
+    WriteU32(out, m_trieEdges.size());
+
+    for (const TrieEdge& edge : m_trieEdges)
+    {
+        WriteU32(out, edge.c);
+        WriteU32(out, edge.node);
+    }
+
+    FILE *fp = std::fopen(filename.c_str(), "wb");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", filename.c_str());
+
+    if (std::fwrite(out.data(), out.size(), 1, fp) != 1)
+        FATAL_ERROR("Failed to write \"%s\".\n", filename.c_str());
+
+    std::fclose(fp);
+}
+
+// Loads a file written by Save(). Returns false if the file is not a
+// compiled charmap, so that it gets parsed as charmap source instead.
+bool Charmap::Load(std::string filename)
+{
+    FILE *fp = std::fopen(filename.c_str(), "rb");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", filename.c_str());
+
+    char magic[sizeof(kCompiledMagic)];
+
+    if (std::fread(magic, sizeof(magic), 1, fp) != 1 || std::memcmp(magic, kCompiledMagic, sizeof(magic)) != 0)
+    {
+        std::fclose(fp);
+        return false;
+    }
+
+    std::string in;
+    char buffer[4096];
+    std::size_t count;
+
+    while ((count = std::fread(buffer, 1, sizeof(buffer), fp)) > 0)
+        in.append(buffer, count);
+
+    std::fclose(fp);
+
+    std::size_t pos = 0;
+    std::uint32_t numSequences, numChars, numNodes, numEdges;
+
+    if (!ReadU32(in, pos, numSequences) || numSequences == 0)
+        FATAL_ERROR("\"%s\" is a corrupt compiled charmap.\n", filename.c_str());
+
+    m_sequences.resize(numSequences);
+
+    for (std::string& sequence : m_sequences)
+    {
+        std::uint32_t length;
+
+        if (!ReadU32(in, pos, length) || pos + length > in.size())
+            FATAL_ERROR("\"%s\" is a corrupt compiled charmap.\n", filename.c_str());
+
+        sequence = in.substr(pos, length);
+        pos += length;
+    }
+
+    m_denseChars.assign(kDenseCharLimit, 0);
+
+    if (!ReadU32(in, pos, numChars))
+        FATAL_ERROR("\"%s\" is a corrupt compiled charmap.\n", filename.c_str());
+
+    for (std::uint32_t i = 0; i < numChars; i++)
+    {
+        std::uint32_t code, index;
+
+        if (!ReadU32(in, pos, code) || !ReadU32(in, pos, index) || index >= numSequences)
+            FATAL_ERROR("\"%s\" is a corrupt compiled charmap.\n", filename.c_str());
+
+        if ((std::int32_t)code >= 0 && (std::int32_t)code < kDenseCharLimit)
+            m_denseChars[code] = index;
+        else
+            m_sparseChars[code] = index;
+    }
+
+    for (int i = 0; i < 128; i++)
+    {
+        if (!ReadU32(in, pos, m_escapes[i]) || m_escapes[i] >= numSequences)
+            FATAL_ERROR("\"%s\" is a corrupt compiled charmap.\n", filename.c_str());
+    }
+
+    if (!ReadU32(in, pos, numNodes) || numNodes == 0)
+        FATAL_ERROR("\"%s\" is a corrupt compiled charmap.\n", filename.c_str());
+
+    m_trieNodes.resize(numNodes);
+
+    for (TrieNode& node : m_trieNodes)
+    {
+        if (!ReadU32(in, pos, node.sequence) || !ReadU32(in, pos, node.firstEdge) || !ReadU32(in, pos, node.numEdges)
+         || node.sequence >= numSequences)
+            FATAL_ERROR("\"%s\" is a corrupt compiled charmap.\n", filename.c_str());
+    }
+
+    if (!ReadU32(in, pos, numEdges))
+        FATAL_ERROR("\"%s\" is a corrupt compiled charmap.\n", filename.c_str());
+
+    m_trieEdges.resize(numEdges);
+
+    for (TrieEdge& edge : m_trieEdges)
+    {
+        std::uint32_t c;
+
+        if (!ReadU32(in, pos, c) || !ReadU32(in, pos, edge.node) || edge.node >= numNodes)
+            FATAL_ERROR("\"%s\" is a corrupt compiled charmap.\n", filename.c_str());
+
+        edge.c = c;
+    }
+
+    for (const TrieNode& node : m_trieNodes)
+    {
+        if ((std::uint64_t)node.firstEdge + node.numEdges > numEdges)
+            FATAL_ERROR("\"%s\" is a corrupt compiled charmap.\n", filename.c_str());
+    }
+
+    return true;
 }
@@ -26,39 +26,72 @@
 #include <map>
 #include <vector>
 
+// The charmap is compiled into flat tables once it has been read:
+// - byte sequences are stored in one table and referred to by index, with
+//   index 0 being the empty sequence that is returned for unmapped input,
+// - chars below kDenseCharLimit are looked up directly by code point,
+// - constants are looked up in a trie keyed on their identifier characters,
+//   so a lookup walks the name once without building a std::string.
+// The tables can be saved to a binary file with Save(), and the constructor
+// loads such a file directly instead of parsing charmap syntax.
 class Charmap
 {
 public:
     Charmap(std::string filename);
 
-    std::string Char(std::int32_t code)
+    const std::string& Char(std::int32_t code) const
     {
-        auto it = m_chars.find(code);
+        if (code >= 0 && code < kDenseCharLimit)
+            return m_sequences[m_denseChars[code]];
 
-        if (it == m_chars.end())
-            return std::string();
+        auto it = m_sparseChars.find(code);
 
-        return it->second;
+        if (it == m_sparseChars.end())
+            return m_sequences[0];
+
+        return m_sequences[it->second];
     }
 
-    std::string Escape(unsigned char code)
+    const std::string& Escape(unsigned char code) const
     {
-        return m_escapes[code];
+        return m_sequences[m_escapes[code]];
     }
 
-    std::string Constant(std::string identifier)
+    const std::string& Constant(const char *name, std::size_t length) const;
+
+    const std::string& Constant(const std::string& identifier) const
     {
-        auto it = m_constants.find(identifier);
+        return Constant(identifier.data(), identifier.length());
+    }
 
-        if (it == m_constants.end())
-            return std::string();
+    void Save(std::string filename) const;
 
-        return it->second;
-    }
 private:
-    std::map<std::int32_t, std::string> m_chars;
-    std::string m_escapes[128];
-    std::map<std::string, std::string> m_constants;
+    static const std::int32_t kDenseCharLimit = 0x10000;
+
+    struct TrieNode
+    {
+        std::uint32_t sequence;
+        std::uint32_t firstEdge;
+        std::uint32_t numEdges;
+    };
+
+    struct TrieEdge
+    {
+        unsigned char c;
+        std::uint32_t node;
+    };
+
+    std::vector<std::string> m_sequences;
+    std::vector<std::uint16_t> m_denseChars;
+    std::map<std::int32_t, std::uint32_t> m_sparseChars;
+    std::uint32_t m_escapes[128];
+    std::vector<TrieNode> m_trieNodes;
+    std::vector<TrieEdge> m_trieEdges;
+
+    bool Load(std::string filename);
+    std::uint32_t AddSequence(std::string sequence);
+    void BuildTrie(const std::map<std::string, std::uint32_t>& constants);
 };
 
 #endif // CHARMAP_H
@@ -18,36 +18,65 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <string>
 #include <stack>
+#include <thread>
+#include <vector>
 #include "preproc.h"
 #include "asm_file.h"
 #include "c_file.h"
 #include "charmap.h"
+#include "tool_daemon.h"
 
 Charmap* g_charmap;
 
-void PrintAsmBytes(unsigned char *s, int length)
+// Returns the charmap at path, parsing it only if it has changed since the
+// last call. In the daemon this is called before each request is forked,
+// so requests start with the charmap already loaded.
+static Charmap* LoadCharmap(const char* path)
+{
+    static std::string s_path;
+    static FileStamp s_stamp;
+    static Charmap* s_charmap = nullptr;
+
+    FileStamp stamp = GetFileStamp(path);
+
+    if (s_charmap == nullptr || s_path != path || s_stamp != stamp)
+    {
+        delete s_charmap;
+        s_charmap = new Charmap(path);
+        s_path = path;
+        s_stamp = stamp;
+    }
+
+    return s_charmap;
+}
+
+void PrintAsmBytes(FILE *output, unsigned char *s, int length)
 {
     if (length > 0)
     {
-        std::printf("\t.byte ");
+        std::fprintf(output, "\t.byte ");
         for (int i = 0; i < length; i++)
         {
-            std::printf("0x%02X", s[i]);
+            std::fprintf(output, "0x%02X", s[i]);
 
             if (i < length - 1)
-                std::printf(", ");
+                std::fprintf(output, ", ");
         }
-        std::putchar('\n');
+        std::fputc('\n', output);
     }
 }
 
-void PreprocAsmFile(std::string filename)
+void PreprocAsmFile(std::string filename, FILE *output)
 {
     std::stack<AsmFile> stack;
 
-    stack.push(AsmFile(filename));
+    stack.push(AsmFile(filename, output));
 
     for (;;)
     {
@@ -66,21 +95,21 @@ void PreprocAsmFile(std::string filename)
         switch (directive)
         {
         case Directive::Include:
-            stack.push(AsmFile(stack.top().ReadPath()));
+            stack.push(AsmFile(stack.top().ReadPath(), output));
             stack.top().OutputLocation();
             break;
         case Directive::String:
         {
             unsigned char s[kMaxStringLength];
             int length = stack.top().ReadString(s);
-            PrintAsmBytes(s, length);
+            PrintAsmBytes(output, s, length);
             break;
         }
         case Directive::Braille:
         {
             unsigned char s[kMaxStringLength];
             int length = stack.top().ReadBraille(s);
-            PrintAsmBytes(s, length);
+            PrintAsmBytes(output, s, length);
             break;
         }
         case Directive::Unknown:
@@ -90,7 +119,7 @@ void PreprocAsmFile(std::string filename)
             if (globalLabel.length() != 0)
             {
                 const char *s = globalLabel.c_str();
-                std::printf("%s: ; .global %s\n", s, s);
+                std::fprintf(output, "%s: ; .global %s\n", s, s);
             }
             else
             {
@@ -103,15 +132,15 @@ void PreprocAsmFile(std::string filename)
     }
 }
 
-void PreprocCFile(const char * filename, bool isStdin)
+void PreprocCFile(const char * filename, bool isStdin, FILE *output)
 {
-    CFile cFile(filename, isStdin);
+    CFile cFile(filename, isStdin, output);
     cFile.Preproc();
 }
 
-char* GetFileExtension(char* filename)
+const char* GetFileExtension(const char* filename)
 {
-    char* extension = filename;
+    const char* extension = filename;
 
     while (*extension != 0)
         extension++;
@@ -130,35 +159,270 @@ char* GetFileExtension(char* filename)
     return extension;
 }
 
-int main(int argc, char **argv)
+bool IsAsmFile(const char* filename)
 {
+    const char* extension = GetFileExtension(filename);
+
+    if (!extension)
+        FATAL_ERROR("\"%s\" has no file extension.\n", filename);
+
+    if ((extension[0] == 's') && extension[1] == 0)
+        return true;
+    else if ((extension[0] == 'c' || extension[0] == 'i') && extension[1] == 0)
+        return false;
+    else
+        FATAL_ERROR("\"%s\" has an unknown file extension of \"%s\".\n", filename, extension);
+}
+
+// Preprocesses srcPath into outPath and returns the time it took in milliseconds.
+double PreprocFileToPath(const std::string& srcPath, const std::string& outPath)
+{
+    auto start = std::chrono::steady_clock::now();
+    FILE *output = std::fopen(outPath.c_str(), "wb");
+
+    if (output == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", outPath.c_str());
+
+    if (IsAsmFile(srcPath.c_str()))
+        PreprocAsmFile(srcPath, output);
+    else
+        PreprocCFile(srcPath.c_str(), false, output);
+
+    if (std::fclose(output) != 0)
+        FATAL_ERROR("Failed to write \"%s\".\n", outPath.c_str());
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+#ifdef _WIN32
+#define NULL_DEVICE "NUL"
+#else
+#define NULL_DEVICE "/dev/null"
+#endif
+
+// Preprocesses each file numRuns times, discarding the output, and reports
+// the time taken. Any file that isn't assembly is treated as C, so headers
+// such as src/data/graphics/*.h can be measured directly. The first run of
+// a file includes mapping its incbins; later runs show the cost with the
+// incbins already cached, as for repeated references within a batch.
+void RunBenchmark(int numRuns, char **files, int numFiles)
+{
+    FILE *output = std::fopen(NULL_DEVICE, "wb");
+
+    if (output == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", NULL_DEVICE);
+
+    double totalFirst = 0.0;
+    double totalRest = 0.0;
+
+    for (int i = 0; i < numFiles; i++)
+    {
+        const char *extension = GetFileExtension(files[i]);
+        bool isAsm = extension != nullptr && extension[0] == 's' && extension[1] == 0;
+        double first = 0.0;
+        double rest = 0.0;
+
+        for (int run = 0; run < numRuns; run++)
+        {
+            auto start = std::chrono::steady_clock::now();
+
+            if (isAsm)
+                PreprocAsmFile(files[i], output);
+            else
+                PreprocCFile(files[i], false, output);
+
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+            if (run == 0)
+                first = elapsed.count();
+            else
+                rest += elapsed.count();
+        }
+
+        if (numRuns > 1)
+            rest /= numRuns - 1;
+
+        totalFirst += first;
+        totalRest += rest;
+        std::printf("%s: %.3f ms first run, %.3f ms later runs\n", files[i], first, rest);
+    }
+
+    std::printf("total: %.3f ms first run, %.3f ms later runs\n", totalFirst, totalRest);
+    std::fclose(output);
+}
+
+// Reads "SRC_FILE OUT_FILE" requests from stdin, one per line, and hands
+// them to a pool of workers sharing the charmap. Each finished request is
+// acknowledged on stdout with "OUT_FILE MILLISECONDS", so a client can pipe
+// requests in as it goes or feed a whole list at once and sort the replies
+// to see which files dominate.
+void RunBatch(int numThreads)
+{
+    std::deque<std::pair<std::string, std::string>> requests;
+    std::mutex mutex;
+    std::condition_variable ready;
+    bool finished = false;
+    int numFiles = 0;
+    double totalTime = 0.0;
+
+    auto worker = [&]()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        for (;;)
+        {
+            ready.wait(lock, [&]() { return finished || !requests.empty(); });
+
+            if (requests.empty())
+                return;
+
+            std::pair<std::string, std::string> request = requests.front();
+            requests.pop_front();
+
+            lock.unlock();
+            double time = PreprocFileToPath(request.first, request.second);
+            lock.lock();
+
+            numFiles++;
+            totalTime += time;
+            std::printf("%s %.3f\n", request.second.c_str(), time);
+            std::fflush(stdout);
+        }
+    };
+
+    auto wallStart = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+
+    for (int i = 0; i < numThreads; i++)
+        workers.emplace_back(worker);
+
+    char line[2 * kMaxPath + 2];
+
+    while (std::fgets(line, sizeof(line), stdin) != NULL)
+    {
+        char srcPath[kMaxPath];
+        char outPath[kMaxPath];
+
+        if (line[0] == '\n' || line[0] == '#')
+            continue;
+
+        if (std::sscanf(line, "%255s %255s", srcPath, outPath) != 2)
+            FATAL_ERROR("Expected \"SRC_FILE OUT_FILE\" but got \"%s\".\n", line);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        requests.emplace_back(srcPath, outPath);
+        ready.notify_one();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished = true;
+        ready.notify_all();
+    }
+
+    for (std::thread &thread : workers)
+        thread.join();
+
+    std::chrono::duration<double, std::milli> wallTime = std::chrono::steady_clock::now() - wallStart;
+    std::fprintf(stderr, "preproc: %d files, %.3f ms total, %.3f ms wall\n", numFiles, totalTime, wallTime.count());
+}
+
+static int RunPreproc(int argc, char **argv)
+{
+    if (argc >= 2 && std::string(argv[1]) == "--compile-charmap")
+    {
+        if (argc != 4)
+            FATAL_ERROR("Usage: %s --compile-charmap CHARMAP_FILE OUT_FILE\n", argv[0]);
+
+        Charmap charmap(argv[2]);
+        charmap.Save(argv[3]);
+        return 0;
+    }
+
+    if (argc >= 3 && std::string(argv[1]) == "--bench")
+    {
+        int numRuns = 10;
+        int argi = 3;
+
+        if (argc >= 5 && std::string(argv[3]) == "-n")
+        {
+            numRuns = std::atoi(argv[4]);
+            argi = 5;
+        }
+
+        if (argi >= argc || numRuns < 1)
+            FATAL_ERROR("Usage: %s --bench CHARMAP_FILE [-n RUNS] SRC_FILE...\n", argv[0]);
+
+        g_charmap = LoadCharmap(argv[2]);
+        RunBenchmark(numRuns, argv + argi, argc - argi);
+        return 0;
+    }
+
+    if (argc >= 3 && std::string(argv[1]) == "--batch")
+    {
+        int numThreads = std::thread::hardware_concurrency();
+
+        if (argc == 5 && std::string(argv[3]) == "-j")
+            numThreads = std::atoi(argv[4]);
+        else if (argc != 3)
+            FATAL_ERROR("Usage: %s --batch CHARMAP_FILE [-j THREADS]\n", argv[0]);
+
+        if (numThreads < 1)
+            numThreads = 1;
+
+        g_charmap = LoadCharmap(argv[2]);
+        RunBatch(numThreads);
+        return 0;
+    }
+
     if (argc < 3 || argc > 4)
     {
         std::fprintf(stderr, "Usage: %s SRC_FILE CHARMAP_FILE [-i]\nwhere -i denotes if input is from stdin\n", argv[0]);
+        std::fprintf(stderr, "       %s --batch CHARMAP_FILE [-j THREADS]\nwhich reads \"SRC_FILE OUT_FILE\" lines from stdin\n", argv[0]);
+        std::fprintf(stderr, "       %s --compile-charmap CHARMAP_FILE OUT_FILE\nwhich saves CHARMAP_FILE in a binary form that loads faster\n", argv[0]);
+        std::fprintf(stderr, "       %s --bench CHARMAP_FILE [-n RUNS] SRC_FILE...\nwhich times preprocessing each SRC_FILE\n", argv[0]);
+        std::fprintf(stderr, "       %s --daemon SOCKET_PATH\nwhich serves requests forwarded from $TOOLS_DAEMON_DIR/preproc.sock\n", argv[0]);
         return 1;
     }
 
-    g_charmap = new Charmap(argv[2]);
-
-    char* extension = GetFileExtension(argv[1]);
+    g_charmap = LoadCharmap(argv[2]);
 
-    if (!extension)
-        FATAL_ERROR("\"%s\" has no file extension.\n", argv[1]);
-
-    if ((extension[0] == 's') && extension[1] == 0)
-        PreprocAsmFile(argv[1]);
-    else if ((extension[0] == 'c' || extension[0] == 'i') && extension[1] == 0) {
-        if (argc == 4) {
-            if (argv[3][0] == '-' && argv[3][1] == 'i' && argv[3][2] == '\0') {
-                PreprocCFile(argv[1], true);
-            } else {
-                FATAL_ERROR("unknown argument flag \"%s\".\n", argv[3]);
-            }
+    if (IsAsmFile(argv[1]))
+        PreprocAsmFile(argv[1], stdout);
+    else if (argc == 4) {
+        if (argv[3][0] == '-' && argv[3][1] == 'i' && argv[3][2] == '\0') {
+            PreprocCFile(argv[1], true, stdout);
         } else {
-            PreprocCFile(argv[1], false);
+            FATAL_ERROR("unknown argument flag \"%s\".\n", argv[3]);
         }
-    } else
-        FATAL_ERROR("\"%s\" has an unknown file extension of \"%s\".\n", argv[1], extension);
+    } else {
+        PreprocCFile(argv[1], false, stdout);
+    }
 
     return 0;
 }
+
+// Loads the request's charmap in the daemon. A missing charmap is left for
+// the request itself to report.
+static void PrepareDaemonRequest(int argc, char **argv)
+{
+    if (argc < 3 || std::string(argv[1]) == "--compile-charmap")
+        return;
+
+    if (GetFileStamp(argv[2]).size >= 0)
+        LoadCharmap(argv[2]);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc == 3 && std::string(argv[1]) == "--daemon")
+        return RunToolDaemon("preproc", argv[0], argv[2], PrepareDaemonRequest, RunPreproc);
+
+    int exitCode;
+
+    if (ForwardToDaemon("preproc", argc, argv, &exitCode))
+        return exitCode;
+
+    return RunPreproc(argc, argv);
+}
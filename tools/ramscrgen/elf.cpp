@@ -2,271 +2,263 @@
 #include <cstring>
 #include <cstdint>
 #include <map>
-#include <vector>
+#include <memory>
 #include <string>
 #include "ramscrgen.h"
 #include "elf.h"
+#include "mapped_file.h"
 
 #define SHN_COMMON 0xFFF2
 
-static std::string s_elfPath;
-static std::string s_archiveFilePath;
-static std::string s_archiveObjectPath;
+#define AR_HEADER_SIZE 60
+#define ELF_HEADER_SIZE 0x34
+#define ELF_SYMBOL_SIZE 16
 
-static FILE *s_file;
-
-static std::uint32_t s_sectionHeaderOffset;
-static int s_sectionHeaderEntrySize;
-static int s_sectionCount;
-static int s_shstrtabIndex;
-
-static std::uint32_t s_symtabOffset;
-static std::uint32_t s_strtabOffset;
-
-static std::uint32_t s_symbolCount;
-static std::uint32_t s_elfFileOffset;
-
-struct Symbol
+// An ELF object, either a whole file or a member of an archive, viewed in
+// place in its mapped file.
+struct ElfImage
 {
-    std::uint32_t nameOffset;
-    std::uint32_t size;
+    std::string path;
+    const unsigned char *data;
+    std::size_t size;
 };
 
-static void Seek(long offset)
+struct ArchiveMember
 {
-    if (std::fseek(s_file, s_elfFileOffset + offset, SEEK_SET) != 0)
-        FATAL_ERROR("error: failed to seek to %ld in \"%s\"", offset, s_elfPath.c_str());
-}
+    std::size_t offset;
+    std::size_t size;
+};
 
-static void Skip(long offset)
-{
-    if (std::fseek(s_file, offset, SEEK_CUR) != 0)
-        FATAL_ERROR("error: failed to skip %ld bytes in \"%s\"", offset, s_elfPath.c_str());
-}
+// Each file is mapped once, each archive's members are located with a
+// single pass over its headers, and each object's symbol table is read
+// once, however many times they are needed in a run.
+static std::map<std::string, std::shared_ptr<const MappedFile>> s_files;
+static std::map<std::string, std::map<std::string, ArchiveMember>> s_archiveIndexes;
+static std::map<std::string, std::map<std::string, std::uint32_t>> s_commonSymbols;
 
-static std::uint32_t ReadInt8()
+static const MappedFile& OpenFile(const std::string& path)
 {
-    int c = std::fgetc(s_file);
+    auto it = s_files.find(path);
+
+    if (it == s_files.end())
+    {
+        std::shared_ptr<const MappedFile> file = MappedFile::Open(path);
+
+        if (file == nullptr)
+            FATAL_ERROR("error: failed to open \"%s\" for reading\n", path.c_str());
+
+        it = s_files.emplace(path, file).first;
+    }
 
-    if (c < 0)
-        FATAL_ERROR("error: unexpected EOF when reading ELF file \"%s\"\n", s_elfPath.c_str());
+    return *it->second;
+}
 
-    return c;
+static void CheckBounds(const ElfImage& elf, std::uint32_t offset, std::uint32_t length)
+{
+    if (offset > elf.size || length > elf.size - offset)
+        FATAL_ERROR("error: unexpected EOF when reading ELF file \"%s\"\n", elf.path.c_str());
 }
 
-static std::uint32_t ReadInt16()
+static std::uint32_t ReadInt16(const ElfImage& elf, std::uint32_t offset)
 {
-    std::uint32_t val = 0;
-    val |= ReadInt8();
-    val |= ReadInt8() << 8;
-    return val;
+    CheckBounds(elf, offset, 2);
+    const unsigned char *p = elf.data + offset;
+    return p[0] | (p[1] << 8);
 }
 
-static std::uint32_t ReadInt32()
+static std::uint32_t ReadInt32(const ElfImage& elf, std::uint32_t offset)
 {
-    std::uint32_t val = 0;
-    val |= ReadInt8();
-    val |= ReadInt8() << 8;
-    val |= ReadInt8() << 16;
-    val |= ReadInt8() << 24;
-    return val;
+    CheckBounds(elf, offset, 4);
+    const unsigned char *p = elf.data + offset;
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((std::uint32_t)p[3] << 24);
 }
 
-static std::string ReadString()
+static std::string ReadString(const ElfImage& elf, std::uint32_t offset)
 {
-    std::string s;
-    char c;
+    CheckBounds(elf, offset, 0);
+    const void *end = std::memchr(elf.data + offset, 0, elf.size - offset);
 
-    while ((c = ReadInt8()) != 0)
-        s += c;
+    if (end == nullptr)
+        FATAL_ERROR("error: unexpected EOF when reading ELF file \"%s\"\n", elf.path.c_str());
 
-    return s;
+    return std::string((const char *)elf.data + offset, (const unsigned char *)end - (elf.data + offset));
 }
 
-static void VerifyElfIdent()
+static void VerifyElfIdent(const ElfImage& elf)
 {
     char expectedMagic[4] = { 0x7F, 'E', 'L', 'F' };
-    char magic[4];
 
-    if (std::fread(magic, 4, 1, s_file) != 1)
-        FATAL_ERROR("error: failed to read ELF magic from \"%s\"\n", s_elfPath.c_str());
+    if (elf.size < ELF_HEADER_SIZE)
+        FATAL_ERROR("error: failed to read ELF header from \"%s\"\n", elf.path.c_str());
 
-    if (std::memcmp(magic, expectedMagic, 4) != 0)
-        FATAL_ERROR("error: ELF magic did not match in \"%s\"\n", s_elfPath.c_str());
+    if (std::memcmp(elf.data, expectedMagic, 4) != 0)
+        FATAL_ERROR("error: ELF magic did not match in \"%s\"\n", elf.path.c_str());
 
-    if (std::fgetc(s_file) != 1)
-        FATAL_ERROR("error: \"%s\" not 32-bit ELF\n", s_elfPath.c_str());
+    if (elf.data[4] != 1)
+        FATAL_ERROR("error: \"%s\" not 32-bit ELF\n", elf.path.c_str());
 
-    if (std::fgetc(s_file) != 1)
-        FATAL_ERROR("error: \"%s\" not little-endian ELF\n", s_elfPath.c_str());
+    if (elf.data[5] != 1)
+        FATAL_ERROR("error: \"%s\" not little-endian ELF\n", elf.path.c_str());
 }
 
-static void VerifyAr()
+static const std::map<std::string, ArchiveMember>& GetArchiveIndex(const std::string& archivePath)
 {
+    auto it = s_archiveIndexes.find(archivePath);
+
+    if (it != s_archiveIndexes.end())
+        return it->second;
+
+    const MappedFile& file = OpenFile(archivePath);
+    const unsigned char *data = file.Data();
+    std::size_t size = file.Size();
+
     char expectedMagic[8] = {'!', '<', 'a', 'r', 'c', 'h', '>', '\n'};
-    char magic[8];
+    char expectedEndMagic[2] = { 0x60, 0x0a };
 
-    if (std::fread(magic, 8, 1, s_file) != 1)
-        FATAL_ERROR("error: failed to read AR magic from \"%s\"\n", s_archiveFilePath.c_str());
+    if (size < 8)
+        FATAL_ERROR("error: failed to read AR magic from \"%s\"\n", archivePath.c_str());
 
-    if (std::memcmp(magic, expectedMagic, 8) != 0)
-        FATAL_ERROR("error: AR magic did not match in \"%s\"\n", s_archiveFilePath.c_str());
-}
+    if (std::memcmp(data, expectedMagic, 8) != 0)
+        FATAL_ERROR("error: AR magic did not match in \"%s\"\n", archivePath.c_str());
 
-static void ReadElfHeader()
-{
-    Seek(0x20);
-    s_sectionHeaderOffset = ReadInt32();
-    Seek(0x2E);
-    s_sectionHeaderEntrySize = ReadInt16();
-    s_sectionCount = ReadInt16();
-    s_shstrtabIndex = ReadInt16();
-}
+    std::map<std::string, ArchiveMember>& index = s_archiveIndexes[archivePath];
+    std::size_t pos = 8;
 
-static void FindArObj()
-{
-    char file_ident[17] = {0};
-    char filesize_s[11] = {0};
-    char expectedEndMagic[2] = { 0x60, 0x0a };
-    char end_magic[2];
-    std::size_t filesize;
-
-    Seek(8);
-    while (!std::feof(s_file)) {
-        if (std::fread(file_ident, 16, 1, s_file) != 1)
-            FATAL_ERROR("error: failed to read file ident in \"%s\"\n", s_archiveFilePath.c_str());
-        Skip(32);
-        if (std::fread(filesize_s, 10, 1, s_file) != 1)
-            FATAL_ERROR("error: failed to read filesize in \"%s\"\n", s_archiveFilePath.c_str());
-        if (std::fread(end_magic, 2, 1, s_file) != 1)
-            FATAL_ERROR("error: failed to read end sentinel in \"%s\"\n", s_archiveFilePath.c_str());
-        if (std::memcmp(end_magic, expectedEndMagic, 2) != 0)
-            FATAL_ERROR("error: corrupted archive header in \"%s\" at \"%s\"\n", s_archiveFilePath.c_str(), file_ident);
-
-        char * ptr = std::strchr(file_ident, '/');
+    while (pos < size)
+    {
+        if (size - pos < AR_HEADER_SIZE)
+            FATAL_ERROR("error: truncated archive header in \"%s\"\n", archivePath.c_str());
+
+        const char *header = (const char *)data + pos;
+        char file_ident[17] = {0};
+        char filesize_s[11] = {0};
+
+        std::memcpy(file_ident, header, 16);
+        std::memcpy(filesize_s, header + 48, 10);
+
+        if (std::memcmp(header + 58, expectedEndMagic, 2) != 0)
+            FATAL_ERROR("error: corrupted archive header in \"%s\" at \"%s\"\n", archivePath.c_str(), file_ident);
+
+        char *ptr = std::strchr(file_ident, '/');
         if (ptr != nullptr)
             *ptr = 0;
-        filesize = std::strtoul(filesize_s, nullptr, 10);
-        if (std::strncmp(s_archiveObjectPath.c_str(), file_ident, 16) == 0) {
-            s_elfFileOffset = std::ftell(s_file);
-            return;
-        }
-        Skip(filesize);
+
+        ArchiveMember member;
+        member.offset = pos + AR_HEADER_SIZE;
+        member.size = std::strtoul(filesize_s, nullptr, 10);
+
+        if (member.size > size - member.offset)
+            FATAL_ERROR("error: member \"%s\" runs past the end of \"%s\"\n", file_ident, archivePath.c_str());
+
+        // The first member with a given name is the one that gets used.
+        index.emplace(file_ident, member);
+
+        // Members are padded to an even offset.
+        pos = member.offset + member.size + (member.size & 1);
     }
 
-    FATAL_ERROR("error: could not find object \"%s\" in archive \"%s\"\n", s_archiveObjectPath.c_str(), s_archiveFilePath.c_str());
+    return index;
 }
 
-static std::string GetSectionName(std::uint32_t shstrtabOffset, int index)
+static ElfImage GetArchiveObject(const std::string& archivePath, const std::string& objectPath, const std::string& elfPath)
 {
-    Seek(s_sectionHeaderOffset + s_sectionHeaderEntrySize * index);
-    std::uint32_t nameOffset = ReadInt32();
-    Seek(shstrtabOffset + nameOffset);
-    return ReadString();
+    const std::map<std::string, ArchiveMember>& index = GetArchiveIndex(archivePath);
+
+    // Member names are at most 16 characters.
+    auto it = index.find(objectPath.substr(0, 16));
+
+    if (it == index.end())
+        FATAL_ERROR("error: could not find object \"%s\" in archive \"%s\"\n", objectPath.c_str(), archivePath.c_str());
+
+    ElfImage elf;
+    elf.path = elfPath;
+    elf.data = OpenFile(archivePath).Data() + it->second.offset;
+    elf.size = it->second.size;
+    return elf;
 }
 
-static void FindTableOffsets()
+static std::map<std::string, std::uint32_t> ReadCommonSymbols(const ElfImage& elf)
 {
-    s_symtabOffset = 0;
-    s_strtabOffset = 0;
+    VerifyElfIdent(elf);
+
+    std::uint32_t sectionHeaderOffset = ReadInt32(elf, 0x20);
+    std::uint32_t sectionHeaderEntrySize = ReadInt16(elf, 0x2E);
+    std::uint32_t sectionCount = ReadInt16(elf, 0x30);
+    std::uint32_t shstrtabIndex = ReadInt16(elf, 0x32);
 
-    Seek(s_sectionHeaderOffset + s_sectionHeaderEntrySize * s_shstrtabIndex + 0x10);
-    std::uint32_t shstrtabOffset = ReadInt32();
+    std::uint32_t shstrtabOffset = ReadInt32(elf, sectionHeaderOffset + sectionHeaderEntrySize * shstrtabIndex + 0x10);
+    std::uint32_t symtabOffset = 0;
+    std::uint32_t strtabOffset = 0;
+    std::uint32_t symbolCount = 0;
 
-    for (int i = 0; i < s_sectionCount; i++)
+    for (std::uint32_t i = 0; i < sectionCount; i++)
     {
-        std::string name = GetSectionName(shstrtabOffset, i);
+        std::uint32_t sectionHeader = sectionHeaderOffset + sectionHeaderEntrySize * i;
+        std::string name = ReadString(elf, shstrtabOffset + ReadInt32(elf, sectionHeader));
 
         if (name == ".symtab")
         {
-            if (s_symtabOffset)
-                FATAL_ERROR("error: mutiple .symtab sections found in \"%s\"\n", s_elfPath.c_str());
-            Seek(s_sectionHeaderOffset + s_sectionHeaderEntrySize * i + 0x10);
-            s_symtabOffset = ReadInt32();
-            std::uint32_t size = ReadInt32();
-            s_symbolCount = size / 16;
+            if (symtabOffset)
+                FATAL_ERROR("error: mutiple .symtab sections found in \"%s\"\n", elf.path.c_str());
+            symtabOffset = ReadInt32(elf, sectionHeader + 0x10);
+            symbolCount = ReadInt32(elf, sectionHeader + 0x14) / ELF_SYMBOL_SIZE;
         }
         else if (name == ".strtab")
         {
-            if (s_strtabOffset)
-                FATAL_ERROR("error: mutiple .strtab sections found in \"%s\"\n", s_elfPath.c_str());
-            Seek(s_sectionHeaderOffset + s_sectionHeaderEntrySize * i + 0x10);
-            s_strtabOffset = ReadInt32();
+            if (strtabOffset)
+                FATAL_ERROR("error: mutiple .strtab sections found in \"%s\"\n", elf.path.c_str());
+            strtabOffset = ReadInt32(elf, sectionHeader + 0x10);
         }
     }
 
-    if (!s_symtabOffset)
-        FATAL_ERROR("error: couldn't find .symtab section in \"%s\"\n", s_elfPath.c_str());
+    if (!symtabOffset)
+        FATAL_ERROR("error: couldn't find .symtab section in \"%s\"\n", elf.path.c_str());
 
-    if (!s_strtabOffset)
-        FATAL_ERROR("error: couldn't find .strtab section in \"%s\"\n", s_elfPath.c_str());
-}
+    if (!strtabOffset)
+        FATAL_ERROR("error: couldn't find .strtab section in \"%s\"\n", elf.path.c_str());
 
-static std::map<std::string, std::uint32_t> GetCommonSymbols_Shared()
-{
-    VerifyElfIdent();
-    ReadElfHeader();
-    FindTableOffsets();
+    CheckBounds(elf, symtabOffset, symbolCount * ELF_SYMBOL_SIZE);
 
     std::map<std::string, std::uint32_t> commonSymbols;
 
-    std::vector<Symbol> commonSymbolVec;
-
-    Seek(s_symtabOffset);
-
-    for (std::uint32_t i = 0; i < s_symbolCount; i++)
+    for (std::uint32_t i = 0; i < symbolCount; i++)
     {
-        Symbol sym;
-        sym.nameOffset = ReadInt32();
-        Skip(4);
-        sym.size = ReadInt32();
-        Skip(2);
-        std::uint16_t sectionIndex = ReadInt16();
-        if (sectionIndex == SHN_COMMON)
-            commonSymbolVec.push_back(sym);
-    }
+        std::uint32_t symbol = symtabOffset + i * ELF_SYMBOL_SIZE;
 
-    for (const Symbol& sym : commonSymbolVec)
-    {
-        Seek(s_strtabOffset + sym.nameOffset);
-        std::string name = ReadString();
-        commonSymbols[name] = sym.size;
+        if (ReadInt16(elf, symbol + 14) == SHN_COMMON)
+            commonSymbols[ReadString(elf, strtabOffset + ReadInt32(elf, symbol))] = ReadInt32(elf, symbol + 8);
     }
 
     return commonSymbols;
 }
 
-std::map<std::string, std::uint32_t> GetCommonSymbolsFromLib(std::string sourcePath, std::string libpath)
+const std::map<std::string, std::uint32_t>& GetCommonSymbols(std::string sourcePath, std::string path)
 {
-    std::size_t colonPos = libpath.find(':');
-    if (colonPos == std::string::npos)
-        FATAL_ERROR("error: missing colon separator in libfile \"%s\"\n", s_elfPath.c_str());
-
-    s_archiveObjectPath = libpath.substr(colonPos + 1);
-    s_archiveFilePath = sourcePath + "/" + libpath.substr(1, colonPos - 1);
-    s_elfPath = sourcePath + "/" + libpath.substr(1);
+    std::string elfPath = sourcePath + "/" + (path[0] == '*' ? path.substr(1) : path);
 
-    s_file = std::fopen(s_archiveFilePath.c_str(), "rb");
+    auto it = s_commonSymbols.find(elfPath);
 
-    if (s_file == NULL)
-        FATAL_ERROR("error: failed to open \"%s\" for reading\n", s_archiveFilePath.c_str());
+    if (it != s_commonSymbols.end())
+        return it->second;
 
-    VerifyAr();
-    FindArObj();
-    return GetCommonSymbols_Shared();
-}
+    ElfImage elf;
 
-std::map<std::string, std::uint32_t> GetCommonSymbols(std::string sourcePath, std::string path)
-{
-    s_elfFileOffset = 0;
     if (path[0] == '*')
-        return GetCommonSymbolsFromLib(sourcePath, path);
-
-    s_elfPath = sourcePath + "/" + path;
-    s_file = std::fopen(s_elfPath.c_str(), "rb");
+    {
+        std::size_t colonPos = path.find(':');
+        if (colonPos == std::string::npos)
+            FATAL_ERROR("error: missing colon separator in libfile \"%s\"\n", path.c_str());
 
-    if (s_file == NULL)
-        FATAL_ERROR("error: failed to open \"%s\" for reading\n", path.c_str());
+        std::string archivePath = sourcePath + "/" + path.substr(1, colonPos - 1);
+        elf = GetArchiveObject(archivePath, path.substr(colonPos + 1), elfPath);
+    }
+    else
+    {
+        const MappedFile& file = OpenFile(elfPath);
+        elf.path = elfPath;
+        elf.data = file.Data();
+        elf.size = file.Size();
+    }
 
-    return GetCommonSymbols_Shared();
+    return s_commonSymbols[elfPath] = ReadCommonSymbols(elf);
 }
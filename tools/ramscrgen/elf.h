@@ -25,6 +25,9 @@
 #include <map>
 #include <string>
 
-std::map<std::string, std::uint32_t> GetCommonSymbols(std::string sourcePath, std::string path);
+// Returns the size of each common symbol in an object file, given either as
+// a path or as "*ARCHIVE:OBJECT" for a member of an archive. The result is
+// cached, so asking for the same object again is cheap.
+const std::map<std::string, std::uint32_t>& GetCommonSymbols(std::string sourcePath, std::string path);
 
 #endif // ELF_H
@@ -20,14 +20,38 @@
 
 #include <cstdio>
 #include <cstring>
+#include <cstdarg>
 #include <string>
+#include <vector>
 #include "ramscrgen.h"
 #include "sym_file.h"
 #include "elf.h"
+#include "write_if_changed.h"
+
+// The linker script is built up in memory so that, with -o, the output file
+// can be left alone when it hasn't changed.
+static std::string s_output;
+
+static void Emit(const char *format, ...)
+{
+    std::va_list args;
+    va_start(args, format);
+    int length = std::vsnprintf(NULL, 0, format, args);
+    va_end(args);
+
+    std::size_t pos = s_output.size();
+    s_output.resize(pos + length + 1);
+
+    va_start(args, format);
+    std::vsnprintf(&s_output[pos], length + 1, format, args);
+    va_end(args);
+
+    s_output.resize(pos + length);
+}
 
 void HandleCommonInclude(std::string filename, std::string sourcePath, std::string symOrderPath, std::string lang)
 {
-    auto commonSymbols = GetCommonSymbols(sourcePath, filename);
+    const auto& commonSymbols = GetCommonSymbols(sourcePath, filename);
     std::size_t dotIndex;
 
     if (filename[0] == '*') {
@@ -57,22 +81,23 @@ void HandleCommonInclude(std::string filename, std::string sourcePath, std::stri
             {
                 if (length & 3)
                     symFile.RaiseWarning("gap length %d is not multiple of 4", length);
-                printf(". += 0x%lX;\n", length);
+                Emit(". += 0x%lX;\n", length);
             }
         }
         else
         {
-            if (commonSymbols.count(label) == 0)
+            auto it = commonSymbols.find(label);
+            if (it == commonSymbols.end())
                 symFile.RaiseError("no common symbol named \"%s\"", label.c_str());
-            unsigned long size = commonSymbols[label];
+            unsigned long size = it->second;
             int alignment = 4;
             if (size > 4)
                 alignment = 8;
             if (size > 8)
                 alignment = 16;
-            printf(". = ALIGN(%d);\n", alignment);
-            printf("%s = .;\n", label.c_str());
-            printf(". += 0x%lX;\n", size);
+            Emit(". = ALIGN(%d);\n", alignment);
+            Emit("%s = .;\n", label.c_str());
+            Emit(". += 0x%lX;\n", size);
         }
 
         symFile.ExpectEmptyRestOfLine();
@@ -95,11 +120,11 @@ void ConvertSymFile(std::string filename, std::string sectionName, std::string l
         {
             std::string incFilename = symFile.ReadPath();
             symFile.ExpectEmptyRestOfLine();
-            printf(". = ALIGN(4);\n");
+            Emit(". = ALIGN(4);\n");
             if (common)
                 HandleCommonInclude(incFilename, incFilename[0] == '*' ? libSourcePath : sourcePath, commonSymPath, lang);
             else
-                printf("%s(%s);\n", incFilename.c_str(), sectionName.c_str());
+                Emit("%s(%s);\n", incFilename.c_str(), sectionName.c_str());
             break;
         }
         case Directive::Space:
@@ -108,7 +133,7 @@ void ConvertSymFile(std::string filename, std::string sectionName, std::string l
             if (!symFile.ReadInteger(length))
                 symFile.RaiseError("expected integer after .space directive");
             symFile.ExpectEmptyRestOfLine();
-            printf(". += 0x%lX;\n", length);
+            Emit(". += 0x%lX;\n", length);
             break;
         }
         case Directive::Align:
@@ -120,7 +145,7 @@ void ConvertSymFile(std::string filename, std::string sectionName, std::string l
                 symFile.RaiseError("max alignment amount is 4");
             amount = 1UL << amount;
             symFile.ExpectEmptyRestOfLine();
-            printf(". = ALIGN(%lu);\n", amount);
+            Emit(". = ALIGN(%lu);\n", amount);
             break;
         }
         case Directive::Unknown:
@@ -129,7 +154,7 @@ void ConvertSymFile(std::string filename, std::string sectionName, std::string l
 
             if (label.length() != 0)
             {
-                printf("%s = .;\n", label.c_str());
+                Emit("%s = .;\n", label.c_str());
             }
 
             symFile.ExpectEmptyRestOfLine();
@@ -140,48 +165,102 @@ void ConvertSymFile(std::string filename, std::string sectionName, std::string l
     }
 }
 
-int main(int argc, char **argv)
+struct Job
 {
-    if (argc < 4)
-    {
-        fprintf(stderr, "Usage: %s SECTION_NAME SYM_FILE LANG [-c SRC_PATH,COMMON_SYM_PATH]", argv[0]);
-        return 1;
-    }
-
+    std::string sectionName;
+    std::string symFileName;
+    std::string lang;
     bool common = false;
-    std::string sectionName = std::string(argv[1]);
-    std::string symFileName = std::string(argv[2]);
-    std::string lang = std::string(argv[3]);
     std::string sourcePath;
     std::string commonSymPath;
     std::string libSourcePath;
+    std::string outputPath;
+};
+
+// Parses one SECTION_NAME SYM_FILE LANG [options] group, stopping at the
+// "--" that separates it from the next one.
+static int ParseJob(int argc, char **argv, int i, Job& job)
+{
+    if (argc - i < 3)
+        FATAL_ERROR("error: expected SECTION_NAME SYM_FILE LANG\n");
+
+    job.sectionName = std::string(argv[i]);
+    job.symFileName = std::string(argv[i + 1]);
+    job.lang = std::string(argv[i + 2]);
 
-    if (argc > 4)
+    for (i += 3; i < argc && std::strcmp(argv[i], "--") != 0; i += 2)
     {
-        if (std::strcmp(argv[4], "-c") != 0)
-            FATAL_ERROR("error: unrecognized argument \"%s\"\n", argv[4]);
+        if (std::strcmp(argv[i], "-o") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("error: missing OUTPUT_FILE after \"-o\"\n");
+
+            job.outputPath = argv[i + 1];
+            continue;
+        }
 
-        if (argc < 6)
+        if (std::strcmp(argv[i], "-c") != 0)
+            FATAL_ERROR("error: unrecognized argument \"%s\"\n", argv[i]);
+
+        if (i + 1 >= argc)
             FATAL_ERROR("error: missing SRC_PATH,COMMON_SYM_PATH after \"-c\"\n");
 
-        common = true;
-        std::string paths = std::string(argv[5]);
+        job.common = true;
+        std::string paths = std::string(argv[i + 1]);
         std::size_t commaPos = paths.find(',');
 
         if (commaPos == std::string::npos)
             FATAL_ERROR("error: missing comma in argument after \"-c\"\n");
 
-        sourcePath = paths.substr(0, commaPos);
-        commonSymPath = paths.substr(commaPos + 1);
-        commaPos = commonSymPath.find(',');
+        job.sourcePath = paths.substr(0, commaPos);
+        job.commonSymPath = paths.substr(commaPos + 1);
+        commaPos = job.commonSymPath.find(',');
         if (commaPos == std::string::npos) {
-            libSourcePath = "tools/agbcc/lib";
+            job.libSourcePath = "tools/agbcc/lib";
         } else {
-            libSourcePath = commonSymPath.substr(commaPos + 1);
-            commonSymPath = commonSymPath.substr(0, commaPos);
+            job.libSourcePath = job.commonSymPath.substr(commaPos + 1);
+            job.commonSymPath = job.commonSymPath.substr(0, commaPos);
         }
     }
 
-    ConvertSymFile(symFileName, sectionName, lang, common, sourcePath, commonSymPath, libSourcePath);
+    return i;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 4)
+    {
+        fprintf(stderr, "Usage: %s SECTION_NAME SYM_FILE LANG [-c SRC_PATH,COMMON_SYM_PATH] [-o OUTPUT_FILE] [-- SECTION_NAME SYM_FILE LANG ...]", argv[0]);
+        return 1;
+    }
+
+    // Several sections can be generated in one run by separating them with
+    // "--". Objects and archives read for one section are reused by the rest.
+    std::vector<Job> jobs;
+
+    for (int i = 1; i < argc; i++)
+    {
+        jobs.emplace_back();
+        i = ParseJob(argc, argv, i, jobs.back());
+    }
+
+    for (const Job& job : jobs)
+    {
+        if (jobs.size() > 1 && job.outputPath.empty())
+            FATAL_ERROR("error: \"-o\" is required when generating more than one section\n");
+    }
+
+    for (const Job& job : jobs)
+    {
+        s_output.clear();
+
+        ConvertSymFile(job.symFileName, job.sectionName, job.lang, job.common, job.sourcePath, job.commonSymPath, job.libSourcePath);
+
+        if (job.outputPath.empty())
+            std::fwrite(s_output.data(), 1, s_output.size(), stdout);
+        else if (!WriteFileIfChanged(job.outputPath, s_output))
+            FATAL_ERROR("error: failed to write \"%s\"\n", job.outputPath.c_str());
+    }
+
     return 0;
 }
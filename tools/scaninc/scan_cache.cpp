@@ -0,0 +1,223 @@
+#include <cstdio>
+#include <fstream>
+#include <queue>
+#include <sys/stat.h>
+#include "scan_cache.h"
+
+bool CanOpenFile(std::string path);
+
+static const char *const CACHE_MAGIC = "scaninc cache 1";
+
+static bool GetFileStamp(const std::string& path, long long& mtime, long long& size)
+{
+    struct stat st;
+
+    if (stat(path.c_str(), &st) != 0)
+        return false;
+
+#if defined(__APPLE__)
+    mtime = (long long)st.st_mtimespec.tv_sec * 1000000000 + st.st_mtimespec.tv_nsec;
+#elif defined(_WIN32)
+    mtime = (long long)st.st_mtime * 1000000000;
+#else
+    mtime = (long long)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+    size = st.st_size;
+    return true;
+}
+
+// The cache file is line based. Each file starts with an "F" line holding
+// its type, mtime, size and path, followed by one "B" line per incbin and
+// one "I" line per include.
+void ScanCache::Load(const std::string& cachePath)
+{
+    std::ifstream in(cachePath);
+    std::string line;
+
+    if (!in || !std::getline(in, line) || line != CACHE_MAGIC)
+        return;
+
+    std::shared_ptr<ScannedFile> file;
+    std::string path;
+
+    while (std::getline(in, line))
+    {
+        if (line.size() < 2)
+            continue;
+
+        std::string value = line.substr(2);
+
+        if (line[0] == 'F')
+        {
+            int type;
+            long long mtime, size;
+            int pathStart;
+
+            if (std::sscanf(value.c_str(), "%d %lld %lld %n", &type, &mtime, &size, &pathStart) != 3)
+                return;
+
+            path = value.substr(pathStart);
+            file = std::make_shared<ScannedFile>();
+            file->type = static_cast<SourceFileType>(type);
+            file->srcDir = GetDir(path);
+            file->mtime = mtime;
+            file->size = size;
+            m_files[path] = file;
+        }
+        else if (file && line[0] == 'B')
+        {
+            file->incbins.insert(value);
+        }
+        else if (file && line[0] == 'I')
+        {
+            file->includes.insert(value);
+        }
+    }
+}
+
+void ScanCache::Save(const std::string& cachePath)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_dirty)
+        return;
+
+    std::string tempPath = cachePath + ".tmp";
+    FILE *fp = std::fopen(tempPath.c_str(), "wb");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", tempPath.c_str());
+
+    std::fprintf(fp, "%s\n", CACHE_MAGIC);
+
+    for (const auto& entry : m_files)
+    {
+        const ScannedFile& file = *entry.second;
+
+        std::fprintf(fp, "F %d %lld %lld %s\n", static_cast<int>(file.type), file.mtime, file.size, entry.first.c_str());
+
+        for (const std::string& incbin : file.incbins)
+            std::fprintf(fp, "B %s\n", incbin.c_str());
+
+        for (const std::string& include : file.includes)
+            std::fprintf(fp, "I %s\n", include.c_str());
+    }
+
+    std::fclose(fp);
+
+    std::remove(cachePath.c_str());
+
+    if (std::rename(tempPath.c_str(), cachePath.c_str()) != 0)
+        FATAL_ERROR("Failed to write \"%s\".\n", cachePath.c_str());
+
+    m_dirty = false;
+}
+
+std::shared_ptr<const ScannedFile> ScanCache::GetFile(const std::string& path)
+{
+    std::shared_ptr<const ScannedFile> cached;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_files.find(path);
+
+        if (it != m_files.end())
+        {
+            if (m_verified.count(path))
+                return it->second;
+
+            cached = it->second;
+        }
+    }
+
+    long long mtime = -1, size = -1;
+
+    GetFileStamp(path, mtime, size);
+
+    if (cached && cached->mtime == mtime && cached->size == size)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_verified.insert(path);
+        return cached;
+    }
+
+    SourceFile source(path);
+    auto file = std::make_shared<ScannedFile>();
+
+    file->type = source.FileType();
+    file->srcDir = source.GetSrcDir();
+    file->incbins = source.GetIncbins();
+    file->includes = source.GetIncludes();
+    file->mtime = mtime;
+    file->size = size;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_files[path] = file;
+    m_verified.insert(path);
+    m_dirty = true;
+    return file;
+}
+
+bool ScanCache::CanOpen(const std::string& path)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_canOpen.find(path);
+
+        if (it != m_canOpen.end())
+            return it->second;
+    }
+
+    bool canOpen = CanOpenFile(path);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_canOpen[path] = canOpen;
+    return canOpen;
+}
+
+std::set<std::string> ScanDependencies(const std::string& initialPath, std::vector<std::string> includeDirs, ScanCache& cache)
+{
+    std::queue<std::string> filesToProcess;
+    std::set<std::string> dependencies;
+
+    filesToProcess.push(initialPath);
+
+    while (!filesToProcess.empty())
+    {
+        std::string filePath = filesToProcess.front();
+        std::shared_ptr<const ScannedFile> file = cache.GetFile(filePath);
+        filesToProcess.pop();
+
+        includeDirs.push_back(file->srcDir);
+        for (auto incbin : file->incbins)
+        {
+            dependencies.insert(incbin);
+        }
+        for (auto include : file->includes)
+        {
+            bool exists = false;
+            std::string path("");
+            for (auto includeDir : includeDirs)
+            {
+                path = includeDir + include;
+                if (cache.CanOpen(path))
+                {
+                    exists = true;
+                    break;
+                }
+            }
+            if (!exists && (file->type == SourceFileType::Asm || file->type == SourceFileType::Inc))
+            {
+                path = include;
+            }
+            bool inserted = dependencies.insert(path).second;
+            if (inserted && exists)
+            {
+                filesToProcess.push(path);
+            }
+        }
+        includeDirs.pop_back();
+    }
+
+    return dependencies;
+}
@@ -0,0 +1,44 @@
+#ifndef SCAN_CACHE_H
+#define SCAN_CACHE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include "source_file.h"
+
+// The directives found in one file, plus the stat() data they were read at.
+struct ScannedFile
+{
+    SourceFileType type;
+    std::string srcDir;
+    std::set<std::string> incbins;
+    std::set<std::string> includes;
+    long long mtime;
+    long long size;
+};
+
+// Memoizes SourceFile parses and include path probes across every file
+// scanned in one run, and optionally across runs through a cache file.
+// Cached parses are reused as long as the file's mtime and size match.
+// All methods are safe to call from multiple threads.
+class ScanCache
+{
+public:
+    void Load(const std::string& cachePath);
+    void Save(const std::string& cachePath);
+    std::shared_ptr<const ScannedFile> GetFile(const std::string& path);
+    bool CanOpen(const std::string& path);
+
+private:
+    std::mutex m_mutex;
+    std::map<std::string, std::shared_ptr<const ScannedFile>> m_files;
+    std::set<std::string> m_verified;
+    std::map<std::string, bool> m_canOpen;
+    bool m_dirty = false;
+};
+
+std::set<std::string> ScanDependencies(const std::string& initialPath, std::vector<std::string> includeDirs, ScanCache& cache);
+
+#endif // SCAN_CACHE_H
@@ -18,14 +18,17 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
-#include <list>
-#include <queue>
 #include <set>
 #include <string>
+#include <thread>
+#include <vector>
 #include "scaninc.h"
 #include "source_file.h"
+#include "scan_cache.h"
+#include "tool_daemon.h"
 
 bool CanOpenFile(std::string path)
 {
@@ -38,19 +41,110 @@ bool CanOpenFile(std::string path)
     return true;
 }
 
-const char *const USAGE = "Usage: scaninc [-I INCLUDE_PATH] FILE_PATH\n";
+const char *const USAGE =
+    "Usage: scaninc [-I INCLUDE_PATH] FILE_PATH\n"
+    "       scaninc [-I INCLUDE_PATH] [-c CACHE_FILE] [-j THREADS] -M OBJ_DIR FILE_PATH...\n"
+    "       scaninc --daemon SOCKET_PATH\n";
 
-int main(int argc, char **argv)
+// Replaces the extension of path with the given one.
+static std::string ReplaceExtension(const std::string& path, const std::string& extension)
+{
+    std::size_t dot = path.find_last_of('.');
+    std::size_t slash = path.find_last_of('/');
+
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+        return path + extension;
+
+    return path.substr(0, dot) + extension;
+}
+
+// Writes "OBJ_DIR/file.o: file deps..." to OBJ_DIR/file.d, leaving the .d
+// file untouched if its contents would not change.
+static void WriteDepFile(const std::string& objDir, const std::string& sourcePath, const std::set<std::string>& dependencies)
+{
+    std::string objPath = objDir + "/" + ReplaceExtension(sourcePath, ".o");
+    std::string depPath = objDir + "/" + ReplaceExtension(sourcePath, ".d");
+    std::string contents = objPath + ": " + sourcePath;
+
+    for (const std::string& path : dependencies)
+        contents += " " + path;
+
+    contents += "\n";
+
+    FILE *fp = std::fopen(depPath.c_str(), "rb");
+
+    if (fp != NULL)
+    {
+        std::string existing;
+        char buffer[4096];
+        std::size_t count;
+
+        while ((count = std::fread(buffer, 1, sizeof(buffer), fp)) > 0)
+            existing.append(buffer, count);
+
+        std::fclose(fp);
+
+        if (existing == contents)
+            return;
+    }
+
+    fp = std::fopen(depPath.c_str(), "wb");
+
+    if (fp == NULL)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", depPath.c_str());
+
+    if (std::fwrite(contents.data(), contents.size(), 1, fp) != 1)
+        FATAL_ERROR("Failed to write \"%s\".\n", depPath.c_str());
+
+    std::fclose(fp);
+}
+
+// Returns the cache loaded from cachePath, reading the file only if it has
+// changed since the last call. In the daemon this is called before each
+// request is forked, so a run that changes nothing starts with every parse
+// already in memory and doesn't rewrite the file.
+static ScanCache& LoadScanCache(const std::string& cachePath)
 {
-    std::queue<std::string> filesToProcess;
-    std::set<std::string> dependencies;
+    static std::string s_path;
+    static FileStamp s_stamp;
+    static ScanCache* s_cache = nullptr;
 
+    FileStamp stamp = GetFileStamp(cachePath);
+
+    if (s_cache == nullptr || s_path != cachePath || s_stamp != stamp)
+    {
+        delete s_cache;
+        s_cache = new ScanCache();
+        s_cache->Load(cachePath);
+        s_path = cachePath;
+        s_stamp = stamp;
+    }
+
+    return *s_cache;
+}
+
+static void PrepareDaemonRequest(int argc, char **argv)
+{
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (std::string(argv[i]) == "-c")
+            LoadScanCache(argv[i + 1]);
+    }
+}
+
+static int RunScaninc(int argc, char **argv)
+{
     std::vector<std::string> includeDirs;
+    std::vector<std::string> files;
+    std::string objDir;
+    std::string cachePath;
+    bool depFiles = false;
+    int numThreads = std::thread::hardware_concurrency();
 
     argc--;
     argv++;
 
-    while (argc > 1)
+    while (argc > 0)
     {
         std::string arg(argv[0]);
         if (arg.substr(0, 2) == "-I")
@@ -58,6 +152,8 @@ int main(int argc, char **argv)
             std::string includeDir = arg.substr(2);
             if (includeDir.empty())
             {
+                if (argc < 2)
+                    FATAL_ERROR(USAGE);
                 argc--;
                 argv++;
                 includeDir = std::string(argv[0]);
@@ -68,61 +164,90 @@ int main(int argc, char **argv)
             }
             includeDirs.push_back(includeDir);
         }
-        else
+        else if (arg == "-M" || arg == "-c" || arg == "-j")
+        {
+            if (argc < 2)
+                FATAL_ERROR(USAGE);
+            argc--;
+            argv++;
+            if (arg == "-M")
+            {
+                objDir = argv[0];
+                depFiles = true;
+            }
+            else if (arg == "-c")
+            {
+                cachePath = argv[0];
+            }
+            else
+            {
+                numThreads = std::atoi(argv[0]);
+            }
+        }
+        else if (arg[0] == '-')
         {
             FATAL_ERROR(USAGE);
         }
+        else
+        {
+            files.push_back(arg);
+        }
         argc--;
         argv++;
     }
 
-    if (argc != 1) {
+    if (files.empty() || (!depFiles && files.size() != 1))
         FATAL_ERROR(USAGE);
-    }
-
-    std::string initialPath(argv[0]);
 
-    filesToProcess.push(initialPath);
+    ScanCache uncached;
+    ScanCache& cache = cachePath.empty() ? uncached : LoadScanCache(cachePath);
 
-    while (!filesToProcess.empty())
+    if (!depFiles)
     {
-        std::string filePath = filesToProcess.front();
-        SourceFile file(filePath);
-        filesToProcess.pop();
-
-        includeDirs.push_back(file.GetSrcDir());
-        for (auto incbin : file.GetIncbins())
+        for (const std::string &path : ScanDependencies(files[0], includeDirs, cache))
         {
-            dependencies.insert(incbin);
+            std::printf("%s\n", path.c_str());
         }
-        for (auto include : file.GetIncludes())
-        {
-            bool exists = false;
-            std::string path("");
-            for (auto includeDir : includeDirs)
-            {
-                path = includeDir + include;
-                if (CanOpenFile(path))
-                {
-                    exists = true;
-                    break;
-                }
-            }
-            if (!exists && (file.FileType() == SourceFileType::Asm || file.FileType() == SourceFileType::Inc))
-            {
-                path = include;
-            }
-            bool inserted = dependencies.insert(path).second;
-            if (inserted && exists)
-            {
-                filesToProcess.push(path);
-            }
-        }
-        includeDirs.pop_back();
     }
-
-    for (const std::string &path : dependencies)
+    else
     {
-        std::printf("%s\n", path.c_str());
+        std::atomic<std::size_t> next(0);
+        std::vector<std::thread> workers;
+
+        auto worker = [&]()
+        {
+            std::size_t i;
+            while ((i = next++) < files.size())
+                WriteDepFile(objDir, files[i], ScanDependencies(files[i], includeDirs, cache));
+        };
+
+        if (numThreads < 1)
+            numThreads = 1;
+
+        for (int i = 1; i < numThreads && (std::size_t)i < files.size(); i++)
+            workers.emplace_back(worker);
+
+        worker();
+
+        for (std::thread &thread : workers)
+            thread.join();
     }
+
+    if (!cachePath.empty())
+        cache.Save(cachePath);
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc == 3 && std::string(argv[1]) == "--daemon")
+        return RunToolDaemon("scaninc", argv[0], argv[2], PrepareDaemonRequest, RunScaninc);
+
+    int exitCode;
+
+    if (ForwardToDaemon("scaninc", argc, argv, &exitCode))
+        return exitCode;
+
+    return RunScaninc(argc, argv);
 }